@@ -0,0 +1,183 @@
+#include "ConnectedComponents.h"
+#include "Algorithms/Graphs/UndirectedGraphs/ListGraph.h"
+#include "Algorithms/Graphs/UndirectedGraphs/MatrixGraph.h"
+#include "Algorithms/MST/DSU.h"
+
+#include <atomic>
+
+namespace ConnectedComponents
+{
+
+constexpr uint32_t NO_COMPONENT = UINT32_MAX;
+
+/**
+ * Renumbers representatives, which are vertices of the components, to consecutive ids
+ */
+template<typename F>
+[[nodiscard]] Result MakeResult(uint32_t order, F&& getRepresentative);
+
+void LowerLabel(std::atomic<Graph::Vertex>& label, Graph::Vertex newLabel) noexcept;
+
+template<typename T, UndirectedGraph::isUndirectedGraph<T>>
+Result FindWithDsuOf(const T& graph)
+{
+    DSU forest(graph.GetOrder());
+
+    graph.VisitEdges([&forest](const UndirectedGraph::EdgeData& edge) {
+        forest.Union(edge.vertices.first, edge.vertices.second);
+    });
+
+    return MakeResult(graph.GetOrder(), [&forest](Graph::Vertex vertex) {
+        return forest.Find(vertex);
+    });
+}
+
+template<typename T, UndirectedGraph::isUndirectedGraph<T>>
+Result FindWithBfsOf(const T& graph)
+{
+    const auto order = graph.GetOrder();
+    Result result{DynamicArray<uint32_t>(order, NO_COMPONENT), 0};
+    DynamicArray<Graph::Vertex> queue(order);
+
+    for (Graph::Vertex source = 0; source < order; source++)
+    {
+        if (result.componentIds[source] != NO_COMPONENT)
+        {
+            continue;
+        }
+
+        const auto component = result.numberOfComponents++;
+        uint32_t head = 0;
+        uint32_t tail = 0;
+        queue[tail++] = source;
+        result.componentIds[source] = component;
+
+        while (head < tail)
+        {
+            auto vertex = queue[head++];
+            graph.VisitNeighboursOf(vertex, [&result, &queue, &tail, component](Graph::Neighbour neighbour) {
+                if (result.componentIds[neighbour.vertex] == NO_COMPONENT)
+                {
+                    result.componentIds[neighbour.vertex] = component;
+                    queue[tail++] = neighbour.vertex;
+                }
+            });
+        }
+    }
+
+    return result;
+}
+
+Result FindWithLabelPropagationOf(const UndirectedGraph& graph, uint32_t numberOfThreads)
+{
+    const auto order = graph.GetOrder();
+    const auto edges = graph.GetEdges();
+    const auto numberOfEdges = edges.Size();
+    numberOfThreads = Utils::Max(numberOfThreads, 1u);
+
+    DynamicArray<std::atomic<Graph::Vertex>> labels(order);
+    for (Graph::Vertex vertex = 0; vertex < order; vertex++)
+    {
+        labels[vertex].store(vertex, std::memory_order_relaxed);
+    }
+
+    std::atomic<bool> isChanged = true;
+    while (isChanged)
+    {
+        isChanged = false;
+
+        Utils::ParallelFor(numberOfThreads, [&](uint32_t thread) {
+            bool isChangedByThread = false;
+            for (auto i = Utils::GetPartBegin(numberOfEdges, thread, numberOfThreads);
+                 i < Utils::GetPartBegin(numberOfEdges, thread + 1, numberOfThreads);
+                 i++)
+            {
+                auto& firstLabel = labels[edges[i].vertices.first];
+                auto& secondLabel = labels[edges[i].vertices.second];
+                auto first = firstLabel.load(std::memory_order_relaxed);
+                auto second = secondLabel.load(std::memory_order_relaxed);
+
+                if (first < second)
+                {
+                    LowerLabel(secondLabel, first);
+                    isChangedByThread = true;
+                }
+                else if (second < first)
+                {
+                    LowerLabel(firstLabel, second);
+                    isChangedByThread = true;
+                }
+            }
+            if (isChangedByThread)
+            {
+                isChanged = true;
+            }
+        });
+
+        Utils::ParallelFor(numberOfThreads, [&](uint32_t thread) {
+            for (auto vertex = Utils::GetPartBegin(order, thread, numberOfThreads);
+                 vertex < Utils::GetPartBegin(order, thread + 1, numberOfThreads);
+                 vertex++)
+            {
+                auto label = labels[vertex].load(std::memory_order_relaxed);
+                auto labelOfLabel = labels[label].load(std::memory_order_relaxed);
+                while (labelOfLabel < label)
+                {
+                    label = labelOfLabel;
+                    labelOfLabel = labels[label].load(std::memory_order_relaxed);
+                }
+                LowerLabel(labels[vertex], label);
+            }
+        });
+    }
+
+    return MakeResult(order, [&labels](Graph::Vertex vertex) {
+        return labels[vertex].load(std::memory_order_relaxed);
+    });
+}
+
+template<typename F>
+Result MakeResult(uint32_t order, F&& getRepresentative)
+{
+    Result result{DynamicArray<uint32_t>(order, NO_COMPONENT), 0};
+    DynamicArray<uint32_t> componentOfRepresentative(order, NO_COMPONENT);
+
+    for (Graph::Vertex vertex = 0; vertex < order; vertex++)
+    {
+        auto& component = componentOfRepresentative[getRepresentative(vertex)];
+        if (component == NO_COMPONENT)
+        {
+            component = result.numberOfComponents++;
+        }
+        result.componentIds[vertex] = component;
+    }
+
+    return result;
+}
+
+void LowerLabel(std::atomic<Graph::Vertex>& label, Graph::Vertex newLabel) noexcept
+{
+    auto current = label.load(std::memory_order_relaxed);
+    while (newLabel < current && !label.compare_exchange_weak(current, newLabel, std::memory_order_relaxed))
+    { }
+}
+
+template
+Result FindWithDsuOf<UndirectedGraph, true>(const UndirectedGraph& graph);
+
+template
+Result FindWithDsuOf<ListGraph, true>(const ListGraph& graph);
+
+template
+Result FindWithDsuOf<MatrixGraph, true>(const MatrixGraph& graph);
+
+template
+Result FindWithBfsOf<UndirectedGraph, true>(const UndirectedGraph& graph);
+
+template
+Result FindWithBfsOf<ListGraph, true>(const ListGraph& graph);
+
+template
+Result FindWithBfsOf<MatrixGraph, true>(const MatrixGraph& graph);
+
+}
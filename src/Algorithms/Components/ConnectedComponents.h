@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Algorithms/Graphs/UndirectedGraphs/UndirectedGraph.h"
+#include "Utils/Parallel.h"
+
+namespace ConnectedComponents
+{
+
+/**
+ * Components are numbered from 0 in order of their smallest vertices, so all variants give the same result
+ */
+struct Result
+{
+    DynamicArray<uint32_t> componentIds;
+    uint32_t numberOfComponents;
+};
+
+/**
+ * Unites ends of every edge in DSU, O(E α(V))
+ */
+template<typename T, UndirectedGraph::isUndirectedGraph<T> = true>
+[[nodiscard]] Result FindWithDsuOf(const T& graph);
+
+/**
+ * Breadth-first search started from every vertex not reached yet, O(V + E)
+ */
+template<typename T, UndirectedGraph::isUndirectedGraph<T> = true>
+[[nodiscard]] Result FindWithBfsOf(const T& graph);
+
+/**
+ * Every vertex takes the minimal label of its neighbours, edges are split between threads.
+ * Labels are shortcut to the label of their label after each round, so the number of rounds stays small
+ */
+[[nodiscard]] Result FindWithLabelPropagationOf(const UndirectedGraph& graph,
+                                                uint32_t numberOfThreads = Utils::GetNumberOfThreads());
+
+}
@@ -0,0 +1,316 @@
+#include "StronglyConnectedComponents.h"
+#include "Algorithms/Graphs/DirectedGraphs/DirectedMatrixGraph.h"
+
+namespace StronglyConnectedComponents
+{
+
+constexpr uint32_t NO_COMPONENT = UINT32_MAX;
+
+/**
+ * Offsets and sources of incoming edges of every vertex
+ */
+struct TransposedGraph
+{
+    DynamicArray<size_t> offsets;
+    DynamicArray<Graph::Vertex> sources;
+};
+
+template<typename T>
+[[nodiscard]] TransposedGraph Transpose(const T& graph);
+
+template<typename T, DirectedGraph::isDirectedGraph<T>>
+Result FindWithTarjanOf(const T& graph, Traversal::Scratch<T>& scratch)
+{
+    const auto order = graph.GetOrder();
+    Result result{DynamicArray<uint32_t>(order, NO_COMPONENT), 0};
+    DynamicArray<uint32_t> indices(order);
+    DynamicArray<uint32_t> lowLinks(order);
+
+    scratch.Prepare(order);
+    auto& frames = scratch.frames;
+    // vertices visited but not assigned to a component yet
+    auto& stack = scratch.frontier;
+    size_t stackSize = 0;
+    uint32_t index = 0;
+
+    auto discover = [&](Graph::Vertex vertex, size_t& depth) {
+        scratch.visited.Set(vertex);
+        indices[vertex] = index;
+        lowLinks[vertex] = index;
+        index++;
+        stack[stackSize++] = vertex;
+        auto range = graph.GetNeighbourRangeOf(vertex);
+        frames[depth++] = {vertex, range.begin(), range.end()};
+    };
+
+    for (Graph::Vertex root = 0; root < order; root++)
+    {
+        if (scratch.visited.Test(root))
+        {
+            continue;
+        }
+
+        size_t depth = 0;
+        discover(root, depth);
+        while (depth > 0)
+        {
+            auto& frame = frames[depth - 1];
+            if (frame.current != frame.end)
+            {
+                auto next = (*frame.current).vertex;
+                ++frame.current;
+                if (!scratch.visited.Test(next))
+                {
+                    discover(next, depth);
+                }
+                else if (result.componentIds[next] == NO_COMPONENT)
+                {
+                    lowLinks[frame.vertex] = Utils::Min(lowLinks[frame.vertex], indices[next]);
+                }
+                continue;
+            }
+
+            const auto vertex = frame.vertex;
+            depth--;
+            if (depth > 0)
+            {
+                const auto parent = frames[depth - 1].vertex;
+                lowLinks[parent] = Utils::Min(lowLinks[parent], lowLinks[vertex]);
+            }
+            if (lowLinks[vertex] == indices[vertex])
+            {
+                Graph::Vertex member;
+                do
+                {
+                    member = stack[--stackSize];
+                    result.componentIds[member] = result.numberOfComponents;
+                } while (member != vertex);
+                result.numberOfComponents++;
+            }
+        }
+    }
+
+    // components are completed in reverse topological order
+    for (auto& componentId : result.componentIds)
+    {
+        componentId = result.numberOfComponents - 1 - componentId;
+    }
+
+    return result;
+}
+
+template<typename T, DirectedGraph::isDirectedGraph<T>>
+Result FindWithTarjanOf(const T& graph)
+{
+    Traversal::Scratch<T> scratch;
+    return FindWithTarjanOf(graph, scratch);
+}
+
+template<typename T, DirectedGraph::isDirectedGraph<T>>
+Result FindWithKosarajuOf(const T& graph, Traversal::Scratch<T>& scratch)
+{
+    const auto order = graph.GetOrder();
+    Result result{DynamicArray<uint32_t>(order, NO_COMPONENT), 0};
+    DynamicArray<Graph::Vertex> finishOrder(order);
+    size_t numberOfFinished = 0;
+
+    Traversal::DepthFirstSearchAll(graph, scratch, Traversal::NoOp(), [&finishOrder, &numberOfFinished](Graph::Vertex vertex) {
+        finishOrder[numberOfFinished++] = vertex;
+    });
+
+    const auto transposed = Transpose(graph);
+    auto& stack = scratch.frontier;
+
+    for (size_t i = order; i > 0; i--)
+    {
+        const auto root = finishOrder[i - 1];
+        if (result.componentIds[root] != NO_COMPONENT)
+        {
+            continue;
+        }
+
+        size_t stackSize = 0;
+        stack[stackSize++] = root;
+        result.componentIds[root] = result.numberOfComponents;
+        while (stackSize > 0)
+        {
+            const auto vertex = stack[--stackSize];
+            for (size_t j = transposed.offsets[vertex]; j < transposed.offsets[vertex + 1]; j++)
+            {
+                const auto source = transposed.sources[j];
+                if (result.componentIds[source] == NO_COMPONENT)
+                {
+                    result.componentIds[source] = result.numberOfComponents;
+                    stack[stackSize++] = source;
+                }
+            }
+        }
+        result.numberOfComponents++;
+    }
+
+    return result;
+}
+
+template<typename T, DirectedGraph::isDirectedGraph<T>>
+Result FindWithKosarajuOf(const T& graph)
+{
+    Traversal::Scratch<T> scratch;
+    return FindWithKosarajuOf(graph, scratch);
+}
+
+template<typename T, DirectedGraph::isDirectedGraph<T>>
+DirectedListGraph GetCondensationOf(const T& graph, const Result& components)
+{
+    const auto vertices = GetVerticesInOrderOf(components);
+    DynamicArray<uint32_t> lastSources(components.numberOfComponents, NO_COMPONENT);
+    DynamicArray<Graph::Weight> weights(components.numberOfComponents);
+    DynamicArray<uint32_t> targets(components.numberOfComponents);
+    DynamicArray<DirectedGraph::DirectedEdgeData> edges(graph.GetSize());
+    size_t numberOfEdges = 0;
+
+    size_t position = 0;
+    for (uint32_t component = 0; component < components.numberOfComponents; component++)
+    {
+        uint32_t numberOfTargets = 0;
+        for (; position < vertices.Size() && components.componentIds[vertices[position]] == component; position++)
+        {
+            graph.VisitNeighboursOf(vertices[position], [&](Graph::Neighbour neighbour) {
+                const auto target = components.componentIds[neighbour.vertex];
+                if (target == component)
+                {
+                    return;
+                }
+                if (lastSources[target] != component)
+                {
+                    lastSources[target] = component;
+                    weights[target] = neighbour.weight;
+                    targets[numberOfTargets++] = target;
+                }
+                else
+                {
+                    weights[target] = Utils::Min(weights[target], neighbour.weight);
+                }
+            });
+        }
+
+        for (uint32_t i = 0; i < numberOfTargets; i++)
+        {
+            edges[numberOfEdges++] = {{component, targets[i]}, weights[targets[i]]};
+        }
+    }
+
+    DynamicArray<DirectedGraph::DirectedEdgeData> condensationEdges(numberOfEdges);
+    for (size_t i = 0; i < numberOfEdges; i++)
+    {
+        condensationEdges[i] = edges[i];
+    }
+
+    DirectedListGraph condensation;
+    condensation.AddVertices(components.numberOfComponents);
+    condensation.AddDirectedEdgesBulk(condensationEdges, Graph::BulkPolicy::TRUST_INPUT);
+    return condensation;
+}
+
+DynamicArray<Graph::Vertex> GetVerticesInOrderOf(const Result& components)
+{
+    DynamicArray<size_t> offsets(static_cast<size_t>(components.numberOfComponents) + 1, 0);
+    for (auto componentId : components.componentIds)
+    {
+        offsets[componentId + 1]++;
+    }
+    for (uint32_t i = 0; i < components.numberOfComponents; i++)
+    {
+        offsets[i + 1] += offsets[i];
+    }
+
+    DynamicArray<Graph::Vertex> vertices(components.componentIds.Size());
+    for (Graph::Vertex vertex = 0; vertex < vertices.Size(); vertex++)
+    {
+        vertices[offsets[components.componentIds[vertex]]++] = vertex;
+    }
+    return vertices;
+}
+
+template<typename T, DirectedGraph::isDirectedGraph<T>>
+std::optional<DynamicArray<Graph::Vertex>> GetTopologicalOrderOf(const T& graph)
+{
+    const auto components = FindWithTarjanOf(graph);
+    if (components.numberOfComponents != graph.GetOrder())
+    {
+        return {};
+    }
+    return GetVerticesInOrderOf(components);
+}
+
+template<typename T>
+TransposedGraph Transpose(const T& graph)
+{
+    const auto order = graph.GetOrder();
+    TransposedGraph transposed{DynamicArray<size_t>(static_cast<size_t>(order) + 1, 0),
+                               DynamicArray<Graph::Vertex>(graph.GetSize())};
+
+    for (Graph::Vertex vertex = 0; vertex < order; vertex++)
+    {
+        graph.VisitNeighboursOf(vertex, [&transposed](Graph::Neighbour neighbour) {
+            transposed.offsets[neighbour.vertex + 1]++;
+        });
+    }
+    for (Graph::Vertex vertex = 0; vertex < order; vertex++)
+    {
+        transposed.offsets[vertex + 1] += transposed.offsets[vertex];
+    }
+
+    DynamicArray<size_t> positions = transposed.offsets;
+    for (Graph::Vertex vertex = 0; vertex < order; vertex++)
+    {
+        graph.VisitNeighboursOf(vertex, [&transposed, &positions, vertex](Graph::Neighbour neighbour) {
+            transposed.sources[positions[neighbour.vertex]++] = vertex;
+        });
+    }
+
+    return transposed;
+}
+
+template
+Result FindWithTarjanOf<DirectedListGraph, true>(const DirectedListGraph& graph,
+                                                 Traversal::Scratch<DirectedListGraph>& scratch);
+
+template
+Result FindWithTarjanOf<DirectedMatrixGraph, true>(const DirectedMatrixGraph& graph,
+                                                   Traversal::Scratch<DirectedMatrixGraph>& scratch);
+
+template
+Result FindWithTarjanOf<DirectedListGraph, true>(const DirectedListGraph& graph);
+
+template
+Result FindWithTarjanOf<DirectedMatrixGraph, true>(const DirectedMatrixGraph& graph);
+
+template
+Result FindWithKosarajuOf<DirectedListGraph, true>(const DirectedListGraph& graph,
+                                                   Traversal::Scratch<DirectedListGraph>& scratch);
+
+template
+Result FindWithKosarajuOf<DirectedMatrixGraph, true>(const DirectedMatrixGraph& graph,
+                                                     Traversal::Scratch<DirectedMatrixGraph>& scratch);
+
+template
+Result FindWithKosarajuOf<DirectedListGraph, true>(const DirectedListGraph& graph);
+
+template
+Result FindWithKosarajuOf<DirectedMatrixGraph, true>(const DirectedMatrixGraph& graph);
+
+template
+DirectedListGraph GetCondensationOf<DirectedListGraph, true>(const DirectedListGraph& graph, const Result& components);
+
+template
+DirectedListGraph GetCondensationOf<DirectedMatrixGraph, true>(const DirectedMatrixGraph& graph,
+                                                               const Result& components);
+
+template
+std::optional<DynamicArray<Graph::Vertex>> GetTopologicalOrderOf<DirectedListGraph, true>(const DirectedListGraph& graph);
+
+template
+std::optional<DynamicArray<Graph::Vertex>>
+GetTopologicalOrderOf<DirectedMatrixGraph, true>(const DirectedMatrixGraph& graph);
+
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Algorithms/Graphs/DirectedGraphs/DirectedListGraph.h"
+#include "Algorithms/Traversal/Traversal.h"
+
+namespace StronglyConnectedComponents
+{
+
+/**
+ * Components are numbered in topological order of the condensation, every edge between
+ * different components goes from a lower id to a higher one
+ */
+struct Result
+{
+    DynamicArray<uint32_t> componentIds;
+    uint32_t numberOfComponents;
+};
+
+/**
+ * Iterative Tarjan's algorithm, a single depth-first search with low-links, O(V + E)
+ */
+template<typename T, DirectedGraph::isDirectedGraph<T> = true>
+[[nodiscard]] Result FindWithTarjanOf(const T& graph, Traversal::Scratch<T>& scratch);
+
+template<typename T, DirectedGraph::isDirectedGraph<T> = true>
+[[nodiscard]] Result FindWithTarjanOf(const T& graph);
+
+/**
+ * Kosaraju's algorithm, depth-first search on the graph followed by searches on the transposed graph, O(V + E)
+ */
+template<typename T, DirectedGraph::isDirectedGraph<T> = true>
+[[nodiscard]] Result FindWithKosarajuOf(const T& graph, Traversal::Scratch<T>& scratch);
+
+template<typename T, DirectedGraph::isDirectedGraph<T> = true>
+[[nodiscard]] Result FindWithKosarajuOf(const T& graph);
+
+/**
+ * Graph with a vertex for every component and the lightest edge for every pair of connected components
+ */
+template<typename T, DirectedGraph::isDirectedGraph<T> = true>
+[[nodiscard]] DirectedListGraph GetCondensationOf(const T& graph, const Result& components);
+
+/**
+ * Vertices grouped by components, in order of component ids
+ */
+[[nodiscard]] DynamicArray<Graph::Vertex> GetVerticesInOrderOf(const Result& components);
+
+/**
+ * @return vertices ordered so that every edge goes forward or std::nullopt if the graph has a cycle
+ */
+template<typename T, DirectedGraph::isDirectedGraph<T> = true>
+[[nodiscard]] std::optional<DynamicArray<Graph::Vertex>> GetTopologicalOrderOf(const T& graph);
+
+}
\ No newline at end of file
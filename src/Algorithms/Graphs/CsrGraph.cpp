@@ -0,0 +1,186 @@
+#include "CsrGraph.h"
+#include "GraphParser.h"
+#include "DirectedGraphs/DirectedListGraph.h"
+#include "UndirectedGraphs/ListGraph.h"
+
+#include <cstring>
+#include <fstream>
+
+static_assert(sizeof(Graph::Neighbour) == 8 && std::is_trivially_copyable_v<Graph::Neighbour>);
+
+std::optional<CsrGraph> CsrGraph::Load(const std::string& path, LoadPolicy policy)
+{
+    auto file = Utils::MappedFile::Open(path);
+    if (!file.has_value() || file->Size() < sizeof(Header))
+    {
+        return {};
+    }
+
+    const auto* header = reinterpret_cast<const Header*>(file->Data());
+    if (std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0 || header->version != VERSION)
+    {
+        return {};
+    }
+
+    const uint64_t offsetsBytes = (static_cast<uint64_t>(header->order) + 1) * sizeof(uint64_t);
+    const uint64_t availableBytes = file->Size() - sizeof(Header);
+    if (offsetsBytes > availableBytes)
+    {
+        return {};
+    }
+
+    const uint64_t neighboursBytes = availableBytes - offsetsBytes;
+    if (neighboursBytes % sizeof(Neighbour) != 0 || header->entries != neighboursBytes / sizeof(Neighbour))
+    {
+        return {};
+    }
+
+    const bool isDirected = (header->flags & DIRECTED_FLAG) != 0;
+    if (header->entries != (isDirected ? header->size : 2 * header->size))
+    {
+        return {};
+    }
+
+    const auto* offsets = reinterpret_cast<const uint64_t*>(file->Data() + sizeof(Header));
+    if (offsets[0] != 0 || offsets[header->order] != header->entries)
+    {
+        return {};
+    }
+    for (Vertex i = 0; i < header->order; i++)
+    {
+        if (offsets[i] > offsets[i + 1])
+        {
+            return {};
+        }
+    }
+
+    if (policy == LoadPolicy::VALIDATE_NEIGHBOURS)
+    {
+        const auto* neighbours = reinterpret_cast<const Neighbour*>(offsets + header->order + 1);
+        for (uint64_t i = 0; i < header->entries; i++)
+        {
+            if (neighbours[i].vertex >= header->order)
+            {
+                return {};
+            }
+        }
+    }
+
+    return CsrGraph(std::move(*file));
+}
+
+bool CsrGraph::Save(const std::string& path, const DirectedGraph& graph)
+{
+    return Write(path, graph, graph.GetSize(), true);
+}
+
+bool CsrGraph::Save(const std::string& path, const UndirectedGraph& graph)
+{
+    return Write(path, graph, graph.GetSize(), false);
+}
+
+bool CsrGraph::ConvertTextFile(const std::string& textPath, const std::string& binaryPath, bool isDirected)
+{
+    const auto format = GraphParser::DetectFormat(textPath);
+    const auto numberOfThreads = Utils::GetNumberOfThreads();
+
+    if (isDirected)
+    {
+        auto graph = GraphParser::LoadGraph<DirectedListGraph>(textPath, format, numberOfThreads);
+        return graph.has_value() && Save(binaryPath, *graph);
+    }
+
+    auto graph = GraphParser::LoadGraph<ListGraph>(textPath, format, numberOfThreads);
+    return graph.has_value() && Save(binaryPath, *graph);
+}
+
+uint32_t CsrGraph::GetOrder() const noexcept
+{
+    return header->order;
+}
+
+size_t CsrGraph::GetSize() const noexcept
+{
+    return header->size;
+}
+
+bool CsrGraph::IsDirected() const noexcept
+{
+    return (header->flags & DIRECTED_FLAG) != 0;
+}
+
+uint32_t CsrGraph::GetNumberOfNeighboursOf(Vertex vertex) const noexcept
+{
+    if (!DoesExist(vertex))
+    {
+        return 0;
+    }
+    return static_cast<uint32_t>(offsets[vertex + 1] - offsets[vertex]);
+}
+
+bool CsrGraph::DoesExist(Vertex vertex) const noexcept
+{
+    return vertex < GetOrder();
+}
+
+CsrGraph::NeighbourRange CsrGraph::GetNeighbourRangeOf(Vertex vertex) const noexcept
+{
+    if (!DoesExist(vertex))
+    {
+        return {neighbours, neighbours};
+    }
+    return {neighbours + offsets[vertex], neighbours + offsets[vertex + 1]};
+}
+
+Graph::VertexRange CsrGraph::GetVertexRange() const noexcept
+{
+    return {Graph::VertexIterator{0}, Graph::VertexIterator{GetOrder()}};
+}
+
+CsrGraph::CsrGraph(Utils::MappedFile file) noexcept
+    : file(std::move(file))
+{
+    header = reinterpret_cast<const Header*>(this->file.Data());
+    offsets = reinterpret_cast<const uint64_t*>(this->file.Data() + sizeof(Header));
+    neighbours = reinterpret_cast<const Neighbour*>(offsets + header->order + 1);
+}
+
+bool CsrGraph::Write(const std::string& path, const Graph& graph, uint64_t size, bool isDirected)
+{
+    const uint32_t order = graph.GetOrder();
+
+    DynamicArray<uint64_t> offsets(static_cast<size_t>(order) + 1);
+    offsets[0] = 0;
+    for (Vertex i = 0; i < order; i++)
+    {
+        offsets[i + 1] = offsets[i] + graph.GetNumberOfNeighboursOf(i);
+    }
+
+    DynamicArray<Neighbour> neighbours(offsets[order]);
+    for (Vertex i = 0; i < order; i++)
+    {
+        auto position = offsets[i];
+        graph.VisitNeighboursOf(i, [&neighbours, &position](Neighbour neighbour) {
+            neighbours[position++] = neighbour;
+        });
+    }
+
+    Header header{{MAGIC[0], MAGIC[1], MAGIC[2], MAGIC[3]},
+                  VERSION,
+                  order,
+                  isDirected ? DIRECTED_FLAG : 0u,
+                  size,
+                  offsets[order]};
+
+    std::ofstream fout(path, std::ios::binary);
+    fout.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    fout.write(reinterpret_cast<const char*>(&offsets[0]),
+               static_cast<std::streamsize>(offsets.Size() * sizeof(uint64_t)));
+    if (neighbours.Size() > 0)
+    {
+        fout.write(reinterpret_cast<const char*>(&neighbours[0]),
+                   static_cast<std::streamsize>(neighbours.Size() * sizeof(Neighbour)));
+    }
+
+    return !fout.fail();
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "DirectedGraphs/DirectedGraph.h"
+#include "UndirectedGraphs/UndirectedGraph.h"
+#include "Utils/MappedFile.h"
+
+/**
+ * Read-only graph in compressed sparse row layout, viewed directly in a memory-mapped binary file.
+ *
+ * File layout (native byte order):
+ * Header | uint64_t offsets[order + 1] | Neighbour neighbours[offsets[order]]
+ * Neighbours of v are neighbours[offsets[v]..offsets[v + 1]). Undirected edges are stored in both directions.
+ */
+class CsrGraph
+{
+public:
+    using Vertex = Graph::Vertex;
+    using Weight = Graph::Weight;
+    using Neighbour = Graph::Neighbour;
+    using NeighbourRange = Utils::Range<const Neighbour*>;
+
+    /**
+     * Whether Load should check every neighbour or trust that the file was written by Save
+     */
+    enum class LoadPolicy : uint8_t
+    {
+        TRUST_NEIGHBOURS,
+        VALIDATE_NEIGHBOURS
+    };
+
+    static constexpr uint32_t VERSION = 1;
+
+    /**
+     * Maps the file and checks the header and offsets in O(order), so only that part of the mapping is read.
+     * With LoadPolicy::VALIDATE_NEIGHBOURS every neighbour is also checked to be a vertex of the graph,
+     * which takes O(size) and reads the whole file. Files not written by Save should be loaded this way
+     * @return graph or std::nullopt if the file cannot be mapped or is not a valid graph file
+     */
+    [[nodiscard]] static std::optional<CsrGraph> Load(const std::string& path,
+                                                      LoadPolicy policy = LoadPolicy::TRUST_NEIGHBOURS);
+
+    static bool Save(const std::string& path, const DirectedGraph& graph);
+    static bool Save(const std::string& path, const UndirectedGraph& graph);
+
+    /**
+     * Converts a text graph file into the binary format, the text format is detected by GraphParser::DetectFormat
+     */
+    static bool ConvertTextFile(const std::string& textPath, const std::string& binaryPath, bool isDirected);
+
+    [[nodiscard]] uint32_t GetOrder() const noexcept;
+    [[nodiscard]] size_t GetSize() const noexcept;
+    [[nodiscard]] bool IsDirected() const noexcept;
+    [[nodiscard]] uint32_t GetNumberOfNeighboursOf(Vertex vertex) const noexcept;
+    [[nodiscard]] bool DoesExist(Vertex vertex) const noexcept;
+
+    [[nodiscard]] NeighbourRange GetNeighbourRangeOf(Vertex vertex) const noexcept;
+    [[nodiscard]] Graph::VertexRange GetVertexRange() const noexcept;
+
+    template<typename F>
+    bool VisitNeighboursOf(Vertex vertex, F&& visitor) const;
+
+    template<typename F>
+    void VisitVertices(F&& visitor) const;
+
+private:
+    struct Header
+    {
+        char magic[4];
+        uint32_t version;
+        uint32_t order;
+        uint32_t flags;
+        uint64_t size;
+        uint64_t entries;
+    };
+
+    static constexpr char MAGIC[4] = {'D', 'S', 'G', 'R'};
+    static constexpr uint32_t DIRECTED_FLAG = 1u;
+
+    explicit CsrGraph(Utils::MappedFile file) noexcept;
+
+    static bool Write(const std::string& path, const Graph& graph, uint64_t size, bool isDirected);
+
+    Utils::MappedFile file;
+    const Header* header;
+    const uint64_t* offsets;
+    const Neighbour* neighbours;
+};
+
+template<typename F>
+bool CsrGraph::VisitNeighboursOf(Vertex vertex, F&& visitor) const
+{
+    if (!DoesExist(vertex))
+    {
+        return false;
+    }
+
+    for (const auto& neighbour : GetNeighbourRangeOf(vertex))
+    {
+        visitor(neighbour);
+    }
+
+    return true;
+}
+
+template<typename F>
+void CsrGraph::VisitVertices(F&& visitor) const
+{
+    for (Vertex i = 0; i < GetOrder(); i++)
+    {
+        visitor(i);
+    }
+}
@@ -1,10 +1,43 @@
 #include "DirectedGraph.h"
 
+DirectedGraph::DirectedGraph() noexcept
+{
+    MarkAsModified();
+}
+
+DirectedGraph::DirectedGraph(const DirectedGraph& rhs) noexcept
+    : Graph(rhs)
+{
+    MarkAsModified();
+}
+
+DirectedGraph::DirectedGraph(DirectedGraph&& rhs) noexcept
+    : Graph(std::move(rhs))
+{
+    MarkAsModified();
+    rhs.MarkAsModified();                                           // Przeniesiony graf też się zmienia
+}
+
+DirectedGraph& DirectedGraph::operator=(const DirectedGraph& rhs) noexcept
+{
+    Graph::operator=(rhs);
+    MarkAsModified();
+    return *this;
+}
+
+DirectedGraph& DirectedGraph::operator=(DirectedGraph&& rhs) noexcept
+{
+    Graph::operator=(std::move(rhs));
+    MarkAsModified();
+    rhs.MarkAsModified();
+    return *this;
+}
+
 float DirectedGraph::GetDensity() const noexcept
 {
     const uint32_t order = GetOrder();
     const uint64_t size  = GetSize();
-    return static_cast<float>(size) / static_cast<float>((order * (order - 1)));
+    return static_cast<float>(size) / static_cast<float>(static_cast<uint64_t>(order) * (order - 1));
 }
 
 bool DirectedGraph::DirectedEdgeData::operator==(const DirectedEdgeData& rhs) const noexcept
@@ -27,24 +60,121 @@ void DirectedGraph::Serialize(std::ostream& os) const
 
 void DirectedGraph::Deserialize(std::istream& is)
 {
-    size_t size;
-    uint32_t order;
+    size_t size = 0;
+    uint32_t order = 0;
 
     is >> size >> order;
+    if (order > MAX_DESERIALIZED_ORDER)
+    {
+        is.setstate(std::ios::failbit);
+        return;
+    }
+
+    DynamicArray<DirectedEdgeData> buffer;                          // Liczba krawędzi nie jest sprawdzona, więc tablica
+    size_t count = 0;                                               // rośnie wraz z odczytem krawędzi
+    DirectedEdgeData edge;
+    while (count < size && is >> edge.vertices.first >> edge.vertices.second >> edge.weight)
+    {
+        if (edge.vertices.first >= order || edge.vertices.second >= order)
+        {
+            is.setstate(std::ios::failbit);
+            break;
+        }
+        if (count == buffer.Size())
+        {
+            buffer.Resize(Utils::Max(size_t {16}, 2 * count));
+        }
+        buffer[count++] = edge;
+    }
+    if (is.fail())                                                  // Obcięty lub błędny strumień - graf
+    {                                                               // pozostaje bez zmian
+        return;
+    }
+
+    DynamicArray<DirectedEdgeData> edges(count);
+    std::copy(buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(count), edges.begin());
+
+    AddVertices(order);
+    AddDirectedEdgesBulk(edges);
+}
+
+size_t DirectedGraph::AddDirectedEdgesBulk(const DynamicArray<DirectedEdgeData>& edges, BulkPolicy policy)
+{
+    size_t numberOfValidEdges = 0;
+    for (const auto& edge : edges)
+    {
+        if (CanBeAdded(edge))
+        {
+            numberOfValidEdges++;
+        }
+    }
+
+    DynamicArray<DirectedEdgeData> validEdges(numberOfValidEdges);
+    size_t i = 0;
+    for (const auto& edge : edges)
+    {
+        if (CanBeAdded(edge))
+        {
+            validEdges[i++] = edge;
+        }
+    }
 
-    for (uint32_t i = 0; i < order; i++)
+    if (policy == BulkPolicy::TRUST_INPUT)
     {
-        AddVertex();
+        AppendDirectedEdges(validEdges);
+        MarkAsModified();
+        return validEdges.Size();
     }
 
-    for (size_t i = 0; i < size; i++)
+    DynamicArray<Utils::Pair<Vertex, Vertex>> pairs(validEdges.Size());
+    for (i = 0; i < validEdges.Size(); i++)
     {
-        Graph::Vertex first;
-        Graph::Vertex second;
-        Graph::Weight weight;
+        const auto& vertices = validEdges[i].vertices;
+        pairs[i] = {vertices.first, vertices.second};
+    }
 
-        is >> first >> second >> weight;
+    auto firstOccurrences = MarkFirstOccurrences(GetOrder(), pairs);
+    const bool isEmpty = GetSize() == 0;
 
-        AddDirectedEdge({{first, second}, weight});
+    size_t numberOfNewEdges = 0;
+    for (i = 0; i < validEdges.Size(); i++)
+    {
+        firstOccurrences[i] = firstOccurrences[i] && (isEmpty || !DoesExist(validEdges[i].vertices));
+        if (firstOccurrences[i])
+        {
+            numberOfNewEdges++;
+        }
     }
+
+    DynamicArray<DirectedEdgeData> newEdges(numberOfNewEdges);
+    numberOfNewEdges = 0;
+    for (i = 0; i < validEdges.Size(); i++)
+    {
+        if (firstOccurrences[i])
+        {
+            newEdges[numberOfNewEdges++] = validEdges[i];
+        }
+    }
+
+    AppendDirectedEdges(newEdges);
+    MarkAsModified();
+    return newEdges.Size();
+}
+
+uint64_t DirectedGraph::GetVersion() const noexcept
+{
+    return version;
+}
+
+void DirectedGraph::MarkAsModified() noexcept
+{
+    version = lastVersion.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+bool DirectedGraph::CanBeAdded(const DirectedEdgeData& edge) const
+{
+    return edge.vertices.first != edge.vertices.second &&
+           DoesExist(edge.vertices.first) &&
+           DoesExist(edge.vertices.second) &&
+           IsValidWeight(edge.weight);
 }
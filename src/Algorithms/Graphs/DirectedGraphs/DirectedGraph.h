@@ -3,6 +3,8 @@
 #include "Algorithms/Graphs/Graph.h"
 #include "Utils/Pair.h"
 
+#include <atomic>
+
 class DirectedGraph : public Graph
 {
 public:
@@ -22,9 +24,24 @@ public:
         [[nodiscard]] bool operator!=(const DirectedEdgeData& rhs) const noexcept;
     };
 
+    DirectedGraph() noexcept;
+    DirectedGraph(const DirectedGraph& rhs) noexcept;
+    DirectedGraph(DirectedGraph&& rhs) noexcept;
+    DirectedGraph& operator=(const DirectedGraph& rhs) noexcept;
+    DirectedGraph& operator=(DirectedGraph&& rhs) noexcept;
+    ~DirectedGraph() override = default;
+
     using Graph::DoesExist;
 
     virtual bool AddDirectedEdge(const DirectedEdgeData& edge) = 0;
+
+    /**
+     * Adds all edges at once. Loops, edges with non-existing vertices and, for matrices,
+     * zero weights are always skipped, duplicates only with BulkPolicy::DEDUPLICATE
+     * @return number of added edges
+     */
+    size_t AddDirectedEdgesBulk(const DynamicArray<DirectedEdgeData>& edges,
+                                BulkPolicy policy = BulkPolicy::DEDUPLICATE);
     virtual bool RemoveDirectedEdge(DirectedEdge edge) = 0;
 
     [[nodiscard]] virtual std::optional<Weight> GetWeight(DirectedEdge edge) const = 0;
@@ -36,7 +53,36 @@ public:
 
     virtual void ForEachDirectedEdge(DirectedEdgePredicate predicate) const = 0;
 
+    /**
+     * Changes with every modification of vertices, edges or weights and with assignment, so results computed for an older version
+     * can be detected. Versions are unique in the process, so two graphs never have the same one
+     */
+    [[nodiscard]] uint64_t GetVersion() const noexcept;
+
+    template<typename F>
+    void VisitDirectedEdges(F&& visitor) const;
+
 protected:
     void Serialize(std::ostream& os) const override;
     void Deserialize(std::istream& is) override;
-};
\ No newline at end of file
+
+    /**
+     * Appends edges which are known to be valid and not present in the graph yet
+     */
+    virtual void AppendDirectedEdges(const DynamicArray<DirectedEdgeData>& edges) = 0;
+
+    void MarkAsModified() noexcept;
+
+private:
+    [[nodiscard]] bool CanBeAdded(const DirectedEdgeData& edge) const;
+
+    inline static std::atomic<uint64_t> lastVersion = 0;
+
+    uint64_t version;
+};
+
+template<typename F>
+void DirectedGraph::VisitDirectedEdges(F&& visitor) const
+{
+    ForEachDirectedEdge(std::forward<F>(visitor));
+}
\ No newline at end of file
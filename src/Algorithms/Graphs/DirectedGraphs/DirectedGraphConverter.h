@@ -10,14 +10,8 @@ T convert(const DirectedGraph& graph)
 {
     T newGraph;
 
-    for (uint32_t i = 0; i < graph.GetOrder(); i++)
-    {
-        newGraph.AddVertex();
-    }
-
-    graph.ForEachDirectedEdge([&newGraph](const DirectedGraph::DirectedEdgeData& edge) {
-        newGraph.AddDirectedEdge(edge);
-    });
+    newGraph.AddVertices(graph.GetOrder());
+    newGraph.AddDirectedEdgesBulk(graph.GetDirectedEdges(), Graph::BulkPolicy::TRUST_INPUT);
 
     return newGraph;
 }
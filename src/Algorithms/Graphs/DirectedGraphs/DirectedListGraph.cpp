@@ -8,16 +8,50 @@ Graph::Vertex DirectedListGraph::AddVertex()
     }
 
     graph.PushBack(List<Neighbour>());
+    MarkAsModified();
 
     Vertex newVertex = GetOrder() - 1;
 
     return newVertex;
 }
 
+void DirectedListGraph::AddVertices(uint32_t count)
+{
+    if (count > MAX_SIZE - GetOrder())
+    {
+        throw std::runtime_error("Max number of vertices has been reached!");
+    }
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        graph.PushBack(List<Neighbour>());
+    }
+    MarkAsModified();
+}
+
+void DirectedListGraph::AppendDirectedEdges(const DynamicArray<DirectedEdgeData>& edges)
+{
+    // List::operator[] walks the list, so every row is looked up only once
+    DynamicArray<List<Neighbour>*> rows(GetOrder());
+    Vertex i = 0;
+    for (auto& neighbours : graph)
+    {
+        rows[i++] = &neighbours;
+    }
+
+    for (const auto& edge : edges)
+    {
+        rows[edge.vertices.first]->PushBack({edge.vertices.second, edge.weight});
+    }
+
+    size += edges.Size();
+}
+
 void DirectedListGraph::Clear()
 {
     graph.Clear();
     size = 0;
+    MarkAsModified();
 }
 
 bool DirectedListGraph::AddDirectedEdge(const DirectedEdgeData& edge)
@@ -40,6 +74,7 @@ bool DirectedListGraph::AddDirectedEdge(const DirectedEdgeData& edge)
     graph[edge.vertices.first].PushBack({edge.vertices.second, edge.weight});
 
     size++;
+    MarkAsModified();
     return true;
 }
 
@@ -59,6 +94,7 @@ bool DirectedListGraph::RemoveDirectedEdge(DirectedEdge directedEdge)
         {
             edges.RemoveAt(it);
             size--;
+            MarkAsModified();
             found = true;
             break;
         }
@@ -89,6 +125,7 @@ bool DirectedListGraph::SetWeight(DirectedEdge directedEdge, Weight weight)
     }
 
     neighbour->weight = weight;
+    MarkAsModified();
 
     return true;
 }
@@ -143,6 +180,17 @@ std::optional<DynamicArray<Graph::Neighbour>> DirectedListGraph::GetNeighboursOf
     return neighboursVertices;
 }
 
+DirectedListGraph::NeighbourRange DirectedListGraph::GetNeighbourRangeOf(Vertex vertex) const
+{
+    if (!DoesExist(vertex))
+    {
+        return {{nullptr, nullptr}, {nullptr, nullptr}};
+    }
+
+    const auto& neighbours = graph[vertex];
+    return {neighbours.begin(), neighbours.end()};
+}
+
 DynamicArray<Graph::Vertex> DirectedListGraph::GetVertices() const
 {
     DynamicArray<Vertex> result(GetOrder());
@@ -175,41 +223,17 @@ DynamicArray<DirectedGraph::DirectedEdgeData> DirectedListGraph::GetDirectedEdge
 
 bool DirectedListGraph::ForEachNeighbourOf(Vertex vertex, NeighbourPredicate predicate) const
 {
-    if (!DoesExist(vertex))
-    {
-        return false;
-    }
-
-    const auto& neighbours = graph[vertex];
-
-    for (const auto& neighbour : neighbours)
-    {
-        predicate(neighbour);
-    }
-
-    return true;
+    return VisitNeighboursOf(vertex, predicate);
 }
 
 void DirectedListGraph::ForEachVertex(VertexPredicate predicate) const
 {
-    for (Vertex i = 0; i < GetOrder(); i++)
-    {
-        predicate(i);
-    }
+    VisitVertices(predicate);
 }
 
 void DirectedListGraph::ForEachDirectedEdge(DirectedEdgePredicate predicate) const
 {
-    uint32_t i = 0;
-    for (const auto& neighbours : graph)
-    {
-        for (const auto& neighbour : neighbours)
-        {
-            DirectedEdge edge = {i, neighbour.vertex};
-            predicate({edge, neighbour.weight});
-        }
-        i++;
-    }
+    VisitDirectedEdges(predicate);
 }
 
 DirectedListGraph::Neighbour* DirectedListGraph::GetNeighbourOfFirst(DirectedEdge directedEdge)
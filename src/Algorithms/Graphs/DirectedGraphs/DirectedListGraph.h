@@ -6,7 +6,10 @@
 class DirectedListGraph : public DirectedGraph
 {
 public:
+    using NeighbourRange = Utils::Range<List<Neighbour>::ConstIterator>;
+
     Vertex AddVertex() override;
+    void AddVertices(uint32_t count) override;
     void Clear() override;
 
     bool AddDirectedEdge(const DirectedEdgeData& edge) override;
@@ -25,16 +28,73 @@ public:
     [[nodiscard]] DynamicArray<Vertex> GetVertices() const override;
     [[nodiscard]] DynamicArray<DirectedEdgeData> GetDirectedEdges() const override;
 
+    /**
+     * View of the adjacency list of the vertex, empty if the vertex does not exist
+     */
+    [[nodiscard]] NeighbourRange GetNeighbourRangeOf(Vertex vertex) const;
+
     bool ForEachNeighbourOf(Vertex vertex, NeighbourPredicate predicate) const override;
     void ForEachVertex(VertexPredicate predicate) const override;
     void ForEachDirectedEdge(DirectedEdgePredicate predicate) const override;
 
+    template<typename F>
+    bool VisitNeighboursOf(Vertex vertex, F&& visitor) const;
+
+    template<typename F>
+    void VisitVertices(F&& visitor) const;
+
+    template<typename F>
+    void VisitDirectedEdges(F&& visitor) const;
+
     [[nodiscard]] std::string ToString() const override;
 
+protected:
+    void AppendDirectedEdges(const DynamicArray<DirectedEdgeData>& edges) override;
+
 private:
     [[nodiscard]] const Neighbour* GetNeighbourOfFirst(DirectedEdge DirectedEdge) const;
     [[nodiscard]] Neighbour* GetNeighbourOfFirst(DirectedEdge DirectedEdge);
 
     List<List<Neighbour>> graph;
     uint64_t size = 0;
-};
\ No newline at end of file
+};
+
+template<typename F>
+bool DirectedListGraph::VisitNeighboursOf(Vertex vertex, F&& visitor) const
+{
+    if (!DoesExist(vertex))
+    {
+        return false;
+    }
+
+    for (const auto& neighbour : GetNeighbourRangeOf(vertex))
+    {
+        visitor(neighbour);
+    }
+
+    return true;
+}
+
+template<typename F>
+void DirectedListGraph::VisitVertices(F&& visitor) const
+{
+    for (Vertex i = 0; i < GetOrder(); i++)
+    {
+        visitor(i);
+    }
+}
+
+template<typename F>
+void DirectedListGraph::VisitDirectedEdges(F&& visitor) const
+{
+    uint32_t i = 0;
+    for (const auto& neighbours : graph)
+    {
+        for (const auto& neighbour : neighbours)
+        {
+            DirectedEdge edge = {i, neighbour.vertex};
+            visitor(DirectedEdgeData{edge, neighbour.weight});
+        }
+        i++;
+    }
+}
\ No newline at end of file
@@ -10,14 +10,67 @@ Graph::Vertex DirectedMatrixGraph::AddVertex()
     Vertex newVertex = GetOrder() - 1;
 
     graph.PushBack(DynamicArray<DirectedWeight>(GetSize(), Graph::INFINITY_WEIGHT));
+    MarkAsModified();
 
     return newVertex;
 }
 
+void DirectedMatrixGraph::AddVertices(uint32_t count)
+{
+    if (count > MAX_SIZE - GetOrder())
+    {
+        throw std::runtime_error("Max number of vertices has been reached!");
+    }
+
+    DynamicArray<DynamicArray<DirectedWeight>> newGraph(static_cast<size_t>(GetOrder()) + count);
+
+    for (Vertex i = 0; i < GetOrder(); i++)
+    {
+        newGraph[i] = std::move(graph[i]);
+    }
+    for (size_t i = GetOrder(); i < newGraph.Size(); i++)
+    {
+        newGraph[i] = DynamicArray<DirectedWeight>(GetSize(), Graph::INFINITY_WEIGHT);
+    }
+
+    graph = std::move(newGraph);
+    MarkAsModified();
+}
+
+void DirectedMatrixGraph::AppendDirectedEdges(const DynamicArray<DirectedEdgeData>& edges)
+{
+    const size_t oldSize = GetSize();
+
+    for (Vertex i = 0; i < GetOrder(); i++)
+    {
+        DynamicArray<DirectedWeight> row(oldSize + edges.Size(), Graph::INFINITY_WEIGHT);
+        for (size_t edgeNumber = 0; edgeNumber < oldSize; edgeNumber++)
+        {
+            row[edgeNumber] = graph[i][edgeNumber];
+        }
+        graph[i] = std::move(row);
+    }
+
+    for (size_t i = 0; i < edges.Size(); i++)
+    {
+        const auto& edge = edges[i];
+        graph[edge.vertices.first][oldSize + i] = edge.weight;
+        graph[edge.vertices.second][oldSize + i] = -static_cast<DirectedWeight>(edge.weight);
+    }
+
+    size += edges.Size();
+}
+
+bool DirectedMatrixGraph::IsValidWeight(Weight weight) const noexcept
+{
+    return weight != 0;
+}
+
 void DirectedMatrixGraph::Clear()
 {
     graph.Clear();
     size = 0;
+    MarkAsModified();
 }
 
 
@@ -60,6 +113,7 @@ bool DirectedMatrixGraph::AddDirectedEdge(const DirectedEdgeData& edge)
     }
 
     size++;
+    MarkAsModified();
 
     return true;
 }
@@ -94,6 +148,7 @@ bool DirectedMatrixGraph::RemoveDirectedEdge(DirectedEdge directedEdge)
     }
 
     size--;
+    MarkAsModified();
 
     return true;
 }
@@ -148,6 +203,7 @@ bool DirectedMatrixGraph::SetWeight(DirectedEdge directedEdge, Weight weight)
         {
             graph[directedEdge.first][edgeNumber] = weight;
             graph[directedEdge.second][edgeNumber] = -static_cast<DirectedWeight>(weight);
+            MarkAsModified();
             return true;
         }
     }
@@ -245,6 +301,16 @@ std::optional<DynamicArray<Graph::Neighbour>> DirectedMatrixGraph::GetNeighbours
     return result;
 }
 
+DirectedMatrixGraph::NeighbourRange DirectedMatrixGraph::GetNeighbourRangeOf(Vertex vertex) const
+{
+    if (!DoesExist(vertex))
+    {
+        return {NeighbourIterator{this, vertex, GetSize()}, NeighbourIterator{this, vertex, GetSize()}};
+    }
+
+    return {NeighbourIterator{this, vertex, 0}, NeighbourIterator{this, vertex, GetSize()}};
+}
+
 DynamicArray<Graph::Vertex> DirectedMatrixGraph::GetVertices() const
 {
     DynamicArray<Vertex> result(GetOrder());
@@ -287,61 +353,17 @@ DynamicArray<DirectedGraph::DirectedEdgeData> DirectedMatrixGraph::GetDirectedEd
 
 bool DirectedMatrixGraph::ForEachNeighbourOf(Vertex vertex, NeighbourPredicate predicate) const
 {
-    if (!DoesExist(vertex))
-    {
-        return false;
-    }
-
-    for (size_t edgeNumber = 0; edgeNumber < GetSize(); edgeNumber++)
-    {
-        if (graph[vertex][edgeNumber] > 0 && graph[vertex][edgeNumber] != INFINITY_WEIGHT)
-        {
-            for (Vertex i = 0; i < GetOrder(); i++)
-            {
-                if (i == vertex)
-                {
-                    continue;
-                }
-                if (graph[i][edgeNumber] < 0)
-                {
-                    predicate({i, static_cast<Weight>(-graph[i][edgeNumber])});
-                }
-            }
-        }
-    }
-
-    return true;
+    return VisitNeighboursOf(vertex, predicate);
 }
 
 void DirectedMatrixGraph::ForEachVertex(VertexPredicate predicate) const
 {
-    for (Vertex i = 0; i < GetOrder(); i++)
-    {
-        predicate(i);
-    }
+    VisitVertices(predicate);
 }
 
 void DirectedMatrixGraph::ForEachDirectedEdge(DirectedEdgePredicate predicate) const
 {
-    for (size_t edge = 0; edge < GetSize(); edge++)
-    {
-        DirectedEdge currentEdge;
-        for (Vertex i = 0; i < GetOrder(); i++)
-        {
-            if (graph[i][edge] != INFINITY_WEIGHT)
-            {
-                if (graph[i][edge] > 0)
-                {
-                    currentEdge.first = i;
-                }
-                else
-                {
-                    currentEdge.second = i;
-                }
-            }
-        }
-        predicate({currentEdge, static_cast<Weight>(Utils::Abs(graph[currentEdge.first][edge]))});
-    }
+    VisitDirectedEdges(predicate);
 }
 
 std::string DirectedMatrixGraph::ToString() const
@@ -519,4 +541,30 @@ std::string DirectedMatrixGraph::OpeningSeparator(size_t columns, size_t columnW
         }
     }
     return result;
+}
+
+DirectedMatrixGraph::NeighbourIterator::NeighbourIterator(const DirectedMatrixGraph* parent, Vertex vertex, size_t edge) noexcept
+    : parent(parent)
+    , vertex(vertex)
+    , edge(edge)
+{
+    Seek();
+}
+
+void DirectedMatrixGraph::NeighbourIterator::Seek() noexcept
+{
+    for (; edge < parent->GetSize(); edge++)
+    {
+        if (parent->graph[vertex][edge] > 0 && parent->graph[vertex][edge] != INFINITY_WEIGHT)
+        {
+            for (Vertex i = 0; i < parent->GetOrder(); i++)
+            {
+                if (i != vertex && parent->graph[i][edge] < 0)
+                {
+                    other = i;
+                    return;
+                }
+            }
+        }
+    }
 }
\ No newline at end of file
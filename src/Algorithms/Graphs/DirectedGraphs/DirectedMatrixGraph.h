@@ -5,7 +5,11 @@
 class DirectedMatrixGraph : public DirectedGraph
 {
 public:
+    class NeighbourIterator;
+    using NeighbourRange = Utils::Range<NeighbourIterator>;
+
     Vertex AddVertex() override;
+    void AddVertices(uint32_t count) override;
     void Clear() override;
     bool AddDirectedEdge(const DirectedEdgeData& edge) override;
     bool RemoveDirectedEdge(DirectedEdge DirectedEdge) override;
@@ -23,12 +27,30 @@ public:
     [[nodiscard]] DynamicArray<Vertex> GetVertices() const override;
     [[nodiscard]] DynamicArray<DirectedEdgeData> GetDirectedEdges() const override;
 
+    /**
+     * Lazily scans the incidence matrix, nothing is copied
+     */
+    [[nodiscard]] NeighbourRange GetNeighbourRangeOf(Vertex vertex) const;
+
     bool ForEachNeighbourOf(Vertex vertex, NeighbourPredicate predicate) const override;
     void ForEachVertex(VertexPredicate predicate) const override;
     void ForEachDirectedEdge(DirectedEdgePredicate predicate) const override;
 
+    template<typename F>
+    bool VisitNeighboursOf(Vertex vertex, F&& visitor) const;
+
+    template<typename F>
+    void VisitVertices(F&& visitor) const;
+
+    template<typename F>
+    void VisitDirectedEdges(F&& visitor) const;
+
     [[nodiscard]] std::string ToString() const override;
 
+protected:
+    void AppendDirectedEdges(const DynamicArray<DirectedEdgeData>& edges) override;
+    [[nodiscard]] bool IsValidWeight(Weight weight) const noexcept override;
+
 private:
     using DirectedWeight = int64_t;
 
@@ -39,4 +61,116 @@ private:
 
     DynamicArray<DynamicArray<DirectedWeight>> graph;
     uint64_t size = 0;
-};
\ No newline at end of file
+};
+
+class DirectedMatrixGraph::NeighbourIterator
+{
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = Neighbour;
+    using pointer = const Neighbour*;
+    using reference = Neighbour;
+
+    NeighbourIterator() = default;
+    NeighbourIterator(const DirectedMatrixGraph* parent, Vertex vertex, size_t edge) noexcept;
+
+    [[nodiscard]] Neighbour operator*() const noexcept
+    {
+        return {other, static_cast<Weight>(-parent->graph[other][edge])};
+    }
+
+    NeighbourIterator& operator++() noexcept
+    {
+        ++edge;
+        Seek();
+        return *this;
+    }
+
+    NeighbourIterator operator++(int) noexcept
+    {
+        auto copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    [[nodiscard]] bool operator==(const NeighbourIterator& rhs) const noexcept
+    {
+        return edge == rhs.edge;
+    }
+
+    [[nodiscard]] bool operator!=(const NeighbourIterator& rhs) const noexcept
+    {
+        return edge != rhs.edge;
+    }
+
+private:
+    void Seek() noexcept;
+
+    const DirectedMatrixGraph* parent = nullptr;
+    Vertex vertex = 0;
+    size_t edge = 0;
+    Vertex other = 0;
+};
+
+template<typename F>
+bool DirectedMatrixGraph::VisitNeighboursOf(Vertex vertex, F&& visitor) const
+{
+    if (!DoesExist(vertex))
+    {
+        return false;
+    }
+
+    for (size_t edgeNumber = 0; edgeNumber < GetSize(); edgeNumber++)
+    {
+        if (graph[vertex][edgeNumber] > 0 && graph[vertex][edgeNumber] != INFINITY_WEIGHT)
+        {
+            for (Vertex i = 0; i < GetOrder(); i++)
+            {
+                if (i == vertex)
+                {
+                    continue;
+                }
+                if (graph[i][edgeNumber] < 0)
+                {
+                    visitor(Neighbour{i, static_cast<Weight>(-graph[i][edgeNumber])});
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+template<typename F>
+void DirectedMatrixGraph::VisitVertices(F&& visitor) const
+{
+    for (Vertex i = 0; i < GetOrder(); i++)
+    {
+        visitor(i);
+    }
+}
+
+template<typename F>
+void DirectedMatrixGraph::VisitDirectedEdges(F&& visitor) const
+{
+    for (size_t edge = 0; edge < GetSize(); edge++)
+    {
+        DirectedEdge currentEdge;
+        for (Vertex i = 0; i < GetOrder(); i++)
+        {
+            if (graph[i][edge] != INFINITY_WEIGHT)
+            {
+                if (graph[i][edge] > 0)
+                {
+                    currentEdge.first = i;
+                }
+                else
+                {
+                    currentEdge.second = i;
+                }
+            }
+        }
+        visitor(DirectedEdgeData{currentEdge, static_cast<Weight>(Utils::Abs(graph[currentEdge.first][edge]))});
+    }
+}
\ No newline at end of file
@@ -10,4 +10,43 @@ std::istream& operator>>(std::istream& is,Graph& graph)
 {
     graph.Deserialize(is);
     return is;
+}
+
+bool Graph::IsValidWeight([[maybe_unused]] Weight weight) const noexcept
+{
+    return true;
+}
+
+DynamicArray<bool> Graph::MarkFirstOccurrences(uint32_t order, const DynamicArray<Utils::Pair<Vertex, Vertex>>& edges)
+{
+    DynamicArray<size_t> offsets(static_cast<size_t>(order) + 1, 0);
+    for (const auto& edge : edges)
+    {
+        offsets[edge.first + 1]++;
+    }
+    for (size_t i = 0; i < order; i++)
+    {
+        offsets[i + 1] += offsets[i];
+    }
+
+    // stable, so the first occurrence of a pair stays first in its bucket
+    DynamicArray<size_t> sorted(edges.Size());
+    for (size_t i = 0; i < edges.Size(); i++)
+    {
+        sorted[offsets[edges[i].first]++] = i;
+    }
+
+    DynamicArray<bool> firstOccurrences(edges.Size(), false);
+    DynamicArray<Vertex> stamps(order, MAX_SIZE);
+    for (const auto index : sorted)
+    {
+        const auto& edge = edges[index];
+        if (stamps[edge.second] != edge.first)
+        {
+            stamps[edge.second] = edge.first;
+            firstOccurrences[index] = true;
+        }
+    }
+
+    return firstOccurrences;
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Containers/DynamicArray.h"
+#include "Utils/Pair.h"
+#include "Utils/Range.h"
 
 #include <functional>
 
@@ -22,9 +24,28 @@ public:
         Weight weight;
     };
 
+    class VertexIterator;
+    using VertexRange = Utils::Range<VertexIterator>;
+
+    /**
+     * Whether bulk insertion should look for duplicated edges (in the input and in the graph)
+     * or trust the caller that there are none
+     */
+    enum class BulkPolicy : uint8_t
+    {
+        DEDUPLICATE,
+        TRUST_INPUT
+    };
+
     static constexpr Weight INFINITY_WEIGHT = UINT32_MAX;
     static constexpr Vertex MAX_SIZE = UINT32_MAX;
 
+    /**
+     * Biggest order operator>> accepts. The header of a stream cannot be checked against its contents, because isolated
+     * vertices are not written, so bigger orders are rejected instead of allocated
+     */
+    static constexpr uint32_t MAX_DESERIALIZED_ORDER = 1u << 24u;
+
     Graph() = default;
     Graph(const Graph&) = default;
     Graph(Graph&&) = default;
@@ -35,6 +56,7 @@ public:
     virtual void Clear() = 0;
 
     virtual Vertex AddVertex() = 0;
+    virtual void AddVertices(uint32_t count) = 0;
 
     [[nodiscard]] virtual uint32_t GetOrder() const = 0;
     [[nodiscard]] virtual size_t GetSize() const = 0;
@@ -46,9 +68,24 @@ public:
     [[nodiscard]] virtual std::optional<DynamicArray<Neighbour>> GetNeighboursOf(Vertex vertex) const = 0;
     [[nodiscard]] virtual DynamicArray<Vertex> GetVertices() const = 0;
 
+    /**
+     * Vertices are always numbered 0..order-1, so the range is only a pair of counters
+     */
+    [[nodiscard]] VertexRange GetVertexRange() const;
+
     virtual bool ForEachNeighbourOf(Vertex vertex, NeighbourPredicate predicate) const = 0;
     virtual void ForEachVertex(VertexPredicate predicate) const = 0;
 
+    /**
+     * Compile-time counterparts of ForEach methods. Concrete graphs hide them with
+     * implementations which can be inlined, here they fall back to the virtual calls
+     */
+    template<typename F>
+    bool VisitNeighboursOf(Vertex vertex, F&& visitor) const;
+
+    template<typename F>
+    void VisitVertices(F&& visitor) const;
+
     [[nodiscard]] virtual std::string ToString() const = 0;
     friend std::ostream& operator<<(std::ostream& os, const Graph& graph);
     friend std::istream& operator>>(std::istream& os, Graph& graph);
@@ -56,4 +93,76 @@ public:
 protected:
     virtual void Serialize(std::ostream& os) const = 0;
     virtual void Deserialize(std::istream& is) = 0;
+
+    [[nodiscard]] virtual bool IsValidWeight(Weight weight) const noexcept;
+
+    /**
+     * @param order number of vertices, every vertex in edges has to be smaller
+     * @param edges pairs of vertices, duplicates are detected in O(order + edges) with a counting sort
+     * @return flags telling which edges are the first occurrence of their pair
+     */
+    [[nodiscard]] static DynamicArray<bool> MarkFirstOccurrences(uint32_t order,
+                                                                 const DynamicArray<Utils::Pair<Vertex, Vertex>>& edges);
+};
+
+class Graph::VertexIterator
+{
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = Vertex;
+    using pointer = const Vertex*;
+    using reference = Vertex;
+
+    constexpr explicit VertexIterator(Vertex vertex) noexcept
+        : vertex(vertex)
+    { }
+
+    [[nodiscard]] constexpr Vertex operator*() const noexcept
+    {
+        return vertex;
+    }
+
+    constexpr VertexIterator& operator++() noexcept
+    {
+        ++vertex;
+        return *this;
+    }
+
+    constexpr VertexIterator operator++(int) noexcept
+    {
+        auto copy = *this;
+        ++vertex;
+        return copy;
+    }
+
+    [[nodiscard]] constexpr bool operator==(const VertexIterator& rhs) const noexcept
+    {
+        return vertex == rhs.vertex;
+    }
+
+    [[nodiscard]] constexpr bool operator!=(const VertexIterator& rhs) const noexcept
+    {
+        return vertex != rhs.vertex;
+    }
+
+private:
+    Vertex vertex;
 };
+
+inline Graph::VertexRange Graph::GetVertexRange() const
+{
+    return {VertexIterator{0}, VertexIterator{GetOrder()}};
+}
+
+template<typename F>
+bool Graph::VisitNeighboursOf(Vertex vertex, F&& visitor) const
+{
+    return ForEachNeighbourOf(vertex, std::forward<F>(visitor));
+}
+
+template<typename F>
+void Graph::VisitVertices(F&& visitor) const
+{
+    ForEachVertex(std::forward<F>(visitor));
+}
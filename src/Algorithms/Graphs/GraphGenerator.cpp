@@ -9,7 +9,7 @@
 namespace Generator
 {
 
-[[nodiscard]] Utils::Pair<Graph::Vertex, Graph::Vertex> DrawEdge(const DynamicArray<Graph::Vertex>& vertices);
+[[nodiscard]] Utils::Pair<Graph::Vertex, Graph::Vertex> DrawEdge(uint32_t order);
 
 template<typename T, Graph::isGraph<T> = true>
 [[nodiscard]] T GenerateGraph(uint32_t order);
@@ -80,17 +80,15 @@ T GenerateGraph(uint32_t order)
     return graph;
 }
 
-Utils::Pair<Graph::Vertex, Graph::Vertex> DrawEdge(const DynamicArray<Graph::Vertex>& vertices)
+Utils::Pair<Graph::Vertex, Graph::Vertex> DrawEdge(uint32_t order)
 {
-    auto randomIndex = static_cast<size_t>(Utils::GetRandomNumber<size_t>(0, vertices.Size() - 1));
-    Graph::Vertex first = vertices[randomIndex];
+    Graph::Vertex first = Utils::GetRandomNumber<Graph::Vertex>(0, order - 1);
 
     Graph::Vertex second;
 
     do
     {
-        randomIndex = static_cast<size_t>(Utils::GetRandomNumber<size_t>(0, vertices.Size() - 1));
-        second = vertices[randomIndex];
+        second = Utils::GetRandomNumber<Graph::Vertex>(0, order - 1);
     } while (first == second);
 
     return {first, second};
@@ -101,11 +99,9 @@ T GenerateSparseGraph(const GraphConfiguration& configuration, size_t size)
 {
     T graph = GenerateSpanningTree<T>(configuration);
 
-    auto vertices = graph.GetVertices();
-
     while (graph.GetSize() < size)
     {
-        auto pair = DrawEdge(vertices);
+        auto pair = DrawEdge(graph.GetOrder());
         auto weight = Utils::GetRandomNumber<Graph::Weight>(configuration.minimalWeight,
                                                             configuration.maximumWeight);
 
@@ -120,11 +116,9 @@ T GenerateDenseGraph(const GraphConfiguration& configuration, size_t size)
 {
     T graph = GenerateGraph<T>(configuration.order);
 
-    auto vertices = graph.GetVertices();
-
-    for (uint32_t i = 0; i < vertices.Size(); i++)
+    for (uint32_t i = 0; i < graph.GetOrder(); i++)
     {
-        for (uint32_t j = 0; j < vertices.Size(); j++)
+        for (uint32_t j = 0; j < graph.GetOrder(); j++)
         {
             if (i != j)
             {
@@ -138,7 +132,7 @@ T GenerateDenseGraph(const GraphConfiguration& configuration, size_t size)
 
     while (graph.GetSize() > size)
     {
-        auto pair = DrawEdge(vertices);
+        auto pair = DrawEdge(graph.GetOrder());
 
         graph.RemoveDirectedEdge({pair.first, pair.second});
 
@@ -157,13 +151,11 @@ T GenerateSpanningTree(const GraphConfiguration& configuration)
 {
     T graph = GenerateGraph<T>(configuration.order);
 
-    auto vertices = graph.GetVertices();
-
     for (uint32_t i = 0; i < graph.GetOrder() - 1; i++)
     {
         auto weight = Utils::GetRandomNumber<Graph::Weight>(configuration.minimalWeight,
                                                             configuration.maximumWeight);
-        graph.AddDirectedEdge({{vertices[i], vertices[i + 1]}, weight});
+        graph.AddDirectedEdge({{i, i + 1}, weight});
     }
 
     return graph;
@@ -182,11 +174,9 @@ T GenerateSparseGraph(const GraphConfiguration& configuration, size_t size)
 {
     T graph = GenerateSpanningTree<T>(configuration);
 
-    auto vertices = graph.GetVertices();
-
     while (graph.GetSize() < size)
     {
-        auto pair = DrawEdge(vertices);
+        auto pair = DrawEdge(graph.GetOrder());
         auto weight = Utils::GetRandomNumber<Graph::Weight>(configuration.minimalWeight,
                                                             configuration.maximumWeight);
 
@@ -201,11 +191,9 @@ T GenerateDenseGraph(const GraphConfiguration& configuration, size_t size)
 {
     T graph = GenerateGraph<T>(configuration.order);
 
-    auto vertices = graph.GetVertices();
-
-    for (uint32_t i = 0; i < vertices.Size(); i++)
+    for (uint32_t i = 0; i < graph.GetOrder(); i++)
     {
-        for (uint32_t j = 0; j < vertices.Size(); j++)
+        for (uint32_t j = 0; j < graph.GetOrder(); j++)
         {
             if (i != j)
             {
@@ -219,7 +207,7 @@ T GenerateDenseGraph(const GraphConfiguration& configuration, size_t size)
 
     while (graph.GetSize() > size)
     {
-        auto pair = DrawEdge(vertices);
+        auto pair = DrawEdge(graph.GetOrder());
 
         graph.RemoveEdge({pair.first, pair.second});
 
@@ -240,13 +228,11 @@ T GenerateSpanningTree(const GraphConfiguration& configuration)
 {
     T graph = GenerateGraph<T>(configuration.order);
 
-    auto vertices = graph.GetVertices();
-
     for (uint32_t i = 0; i < graph.GetOrder() - 1; i++)
     {
         auto weight = Utils::GetRandomNumber<Graph::Weight>(configuration.minimalWeight,
                                                             configuration.maximumWeight);
-        graph.AddEdge({{vertices[i], vertices[i + 1]}, weight});
+        graph.AddEdge({{i, i + 1}, weight});
     }
 
     return graph;
@@ -0,0 +1,364 @@
+#include "GraphParser.h"
+#include "DirectedGraphs/DirectedListGraph.h"
+#include "DirectedGraphs/DirectedMatrixGraph.h"
+#include "UndirectedGraphs/ListGraph.h"
+#include "UndirectedGraphs/MatrixGraph.h"
+#include "Utils/MappedFile.h"
+
+#include <charconv>
+#include <cstring>
+#include <filesystem>
+
+namespace GraphParser
+{
+
+struct Cursor
+{
+    const char* position;
+    const char* end;
+};
+
+struct ChunkResult
+{
+    DynamicArray<DirectedGraph::DirectedEdgeData> edges;
+    size_t numberOfEdges = 0;
+    Graph::Vertex maxVertex = 0;
+    bool isValid = true;
+};
+
+void SkipSpaces(Cursor& cursor) noexcept;
+void SkipLine(Cursor& cursor) noexcept;
+[[nodiscard]] bool IsLineEnd(Cursor& cursor) noexcept;
+
+template<typename T>
+[[nodiscard]] bool ReadNumber(Cursor& cursor, T& value) noexcept;
+
+[[nodiscard]] bool ReadHeader(Cursor& cursor, Format format, ParsedGraph& graph, uint64_t& expectedSize);
+[[nodiscard]] bool ParseLine(Cursor& cursor, Format format, ChunkResult& result);
+void ParseChunk(const char* begin, const char* end, Format format, ChunkResult& result);
+
+[[nodiscard]] DynamicArray<const char*> SplitIntoChunks(const char* begin, const char* end, uint32_t numberOfChunks);
+
+Format DetectFormat(const std::string& path)
+{
+    auto extension = std::filesystem::path(path).extension().string();
+
+    if (extension == ".gr")
+    {
+        return Format::DIMACS;
+    }
+    if (extension == ".el" || extension == ".edges")
+    {
+        return Format::EDGE_LIST;
+    }
+    return Format::NATIVE;
+}
+
+std::optional<ParsedGraph> Parse(const char* begin, const char* end, Format format, uint32_t numberOfThreads)
+{
+    ParsedGraph graph{0, {}};
+    uint64_t expectedSize = 0;
+
+    Cursor cursor{begin, end};
+    if (!ReadHeader(cursor, format, graph, expectedSize))
+    {
+        return {};
+    }
+
+    auto boundaries = SplitIntoChunks(cursor.position, end, Utils::Max(numberOfThreads, 1u));
+    const auto numberOfChunks = static_cast<uint32_t>(boundaries.Size() - 1);
+    DynamicArray<ChunkResult> chunks(numberOfChunks);
+
+    Utils::ParallelFor(numberOfChunks, [&boundaries, &chunks, format](uint32_t i) {
+        ParseChunk(boundaries[i], boundaries[i + 1], format, chunks[i]);
+    });
+
+    size_t numberOfEdges = 0;
+    Graph::Vertex maxVertex = 0;
+    for (const auto& chunk : chunks)
+    {
+        if (!chunk.isValid)
+        {
+            return {};
+        }
+        numberOfEdges += chunk.numberOfEdges;
+        maxVertex = Utils::Max(maxVertex, chunk.maxVertex);
+    }
+
+    if (format == Format::NATIVE && numberOfEdges != expectedSize)
+    {
+        return {};
+    }
+    if (format == Format::EDGE_LIST && numberOfEdges > 0)
+    {
+        if (maxVertex == Graph::MAX_SIZE)
+        {
+            return {};
+        }
+        graph.order = maxVertex + 1;
+    }
+
+    graph.edges = DynamicArray<DirectedGraph::DirectedEdgeData>(numberOfEdges);
+    size_t position = 0;
+    for (const auto& chunk : chunks)
+    {
+        for (size_t i = 0; i < chunk.numberOfEdges; i++)
+        {
+            graph.edges[position++] = chunk.edges[i];
+        }
+    }
+
+    return graph;
+}
+
+std::optional<ParsedGraph> ParseFile(const std::string& path, Format format, uint32_t numberOfThreads)
+{
+    auto file = Utils::MappedFile::Open(path);
+    if (!file.has_value())
+    {
+        return {};
+    }
+
+    const auto* begin = reinterpret_cast<const char*>(file->Data());
+    return Parse(begin, begin + file->Size(), format, numberOfThreads);
+}
+
+template<typename T, Graph::isGraph<T>>
+std::optional<T> LoadGraph(const std::string& path, Format format, uint32_t numberOfThreads)
+{
+    auto parsedGraph = ParseFile(path, format, numberOfThreads);
+    if (!parsedGraph.has_value())
+    {
+        return {};
+    }
+
+    T graph;
+    graph.AddVertices(parsedGraph->order);
+
+    if constexpr (Utils::DerivedFrom<T, DirectedGraph>::Value)
+    {
+        graph.AddDirectedEdgesBulk(parsedGraph->edges);
+    }
+    else
+    {
+        DynamicArray<UndirectedGraph::EdgeData> edges(parsedGraph->edges.Size());
+        for (size_t i = 0; i < edges.Size(); i++)
+        {
+            const auto& edge = parsedGraph->edges[i];
+            edges[i] = {{edge.vertices.first, edge.vertices.second}, edge.weight};
+        }
+        graph.AddEdgesBulk(edges);
+    }
+
+    return graph;
+}
+
+void SkipSpaces(Cursor& cursor) noexcept
+{
+    while (cursor.position != cursor.end &&
+           (*cursor.position == ' ' || *cursor.position == '\t' || *cursor.position == '\r'))
+    {
+        cursor.position++;
+    }
+}
+
+void SkipLine(Cursor& cursor) noexcept
+{
+    const auto* newLine = static_cast<const char*>(std::memchr(cursor.position, '\n',
+                                                               static_cast<size_t>(cursor.end - cursor.position)));
+    cursor.position = newLine == nullptr ? cursor.end : newLine + 1;
+}
+
+bool IsLineEnd(Cursor& cursor) noexcept
+{
+    SkipSpaces(cursor);
+    return cursor.position == cursor.end || *cursor.position == '\n';
+}
+
+template<typename T>
+bool ReadNumber(Cursor& cursor, T& value) noexcept
+{
+    SkipSpaces(cursor);
+    auto[pointer, error] = std::from_chars(cursor.position, cursor.end, value);
+    if (error != std::errc())
+    {
+        return false;
+    }
+    cursor.position = pointer;
+    return true;
+}
+
+bool ReadHeader(Cursor& cursor, Format format, ParsedGraph& graph, uint64_t& expectedSize)
+{
+    switch (format)
+    {
+    case Format::NATIVE:
+        while (cursor.position != cursor.end && IsLineEnd(cursor))
+        {
+            SkipLine(cursor);
+        }
+        if (!ReadNumber(cursor, expectedSize) || !ReadNumber(cursor, graph.order) || !IsLineEnd(cursor))
+        {
+            return false;
+        }
+        SkipLine(cursor);
+        return true;
+    case Format::DIMACS:
+        while (cursor.position != cursor.end)
+        {
+            if (IsLineEnd(cursor) || *cursor.position == 'c')
+            {
+                SkipLine(cursor);
+                continue;
+            }
+            if (*cursor.position != 'p')
+            {
+                return false;
+            }
+            cursor.position++;
+            SkipSpaces(cursor);
+            while (cursor.position != cursor.end && *cursor.position >= 'a' && *cursor.position <= 'z')
+            {
+                cursor.position++;
+            }
+            if (!ReadNumber(cursor, graph.order) || !ReadNumber(cursor, expectedSize) || !IsLineEnd(cursor))
+            {
+                return false;
+            }
+            SkipLine(cursor);
+            return true;
+        }
+        return false;
+    case Format::EDGE_LIST:
+        return true;
+    }
+    return false;
+}
+
+bool ParseLine(Cursor& cursor, Format format, ChunkResult& result)
+{
+    if (IsLineEnd(cursor))
+    {
+        return true;
+    }
+
+    DirectedGraph::DirectedEdgeData edge{};
+
+    switch (format)
+    {
+    case Format::NATIVE:
+        if (!ReadNumber(cursor, edge.vertices.first) ||
+            !ReadNumber(cursor, edge.vertices.second) ||
+            !ReadNumber(cursor, edge.weight))
+        {
+            return false;
+        }
+        break;
+    case Format::DIMACS:
+        if (*cursor.position == 'c')
+        {
+            return true;
+        }
+        if (*cursor.position != 'a')
+        {
+            return false;
+        }
+        cursor.position++;
+        if (!ReadNumber(cursor, edge.vertices.first) ||
+            !ReadNumber(cursor, edge.vertices.second) ||
+            !ReadNumber(cursor, edge.weight) ||
+            edge.vertices.first == 0 || edge.vertices.second == 0)
+        {
+            return false;
+        }
+        edge.vertices.first--;
+        edge.vertices.second--;
+        break;
+    case Format::EDGE_LIST:
+        if (*cursor.position == '#' || *cursor.position == '%')
+        {
+            return true;
+        }
+        if (!ReadNumber(cursor, edge.vertices.first) || !ReadNumber(cursor, edge.vertices.second))
+        {
+            return false;
+        }
+        edge.weight = 1;
+        if (!IsLineEnd(cursor) && !ReadNumber(cursor, edge.weight))
+        {
+            return false;
+        }
+        break;
+    }
+
+    if (!IsLineEnd(cursor))
+    {
+        return false;
+    }
+
+    result.maxVertex = Utils::Max(result.maxVertex, Utils::Max(edge.vertices.first, edge.vertices.second));
+    result.edges[result.numberOfEdges++] = edge;
+    return true;
+}
+
+void ParseChunk(const char* begin, const char* end, Format format, ChunkResult& result)
+{
+    size_t numberOfLines = 1;
+    for (const auto* it = begin; it != end; it++)
+    {
+        if (*it == '\n')
+        {
+            numberOfLines++;
+        }
+    }
+    result.edges = DynamicArray<DirectedGraph::DirectedEdgeData>(numberOfLines);
+
+    Cursor cursor{begin, end};
+    while (cursor.position != cursor.end)
+    {
+        if (!ParseLine(cursor, format, result))
+        {
+            result.isValid = false;
+            return;
+        }
+        SkipLine(cursor);
+    }
+}
+
+DynamicArray<const char*> SplitIntoChunks(const char* begin, const char* end, uint32_t numberOfChunks)
+{
+    const auto length = static_cast<size_t>(end - begin);
+    DynamicArray<const char*> boundaries(static_cast<size_t>(numberOfChunks) + 1);
+
+    boundaries[0] = begin;
+    for (uint32_t i = 1; i < numberOfChunks; i++)
+    {
+        Cursor cursor{Utils::Max(begin + length / numberOfChunks * i, boundaries[i - 1]), end};
+        if (cursor.position != begin && *(cursor.position - 1) != '\n')
+        {
+            SkipLine(cursor);
+        }
+        boundaries[i] = cursor.position;
+    }
+    boundaries[numberOfChunks] = end;
+
+    return boundaries;
+}
+
+template
+std::optional<DirectedListGraph>
+LoadGraph<DirectedListGraph, true>(const std::string& path, Format format, uint32_t numberOfThreads);
+
+template
+std::optional<DirectedMatrixGraph>
+LoadGraph<DirectedMatrixGraph, true>(const std::string& path, Format format, uint32_t numberOfThreads);
+
+template
+std::optional<ListGraph>
+LoadGraph<ListGraph, true>(const std::string& path, Format format, uint32_t numberOfThreads);
+
+template
+std::optional<MatrixGraph>
+LoadGraph<MatrixGraph, true>(const std::string& path, Format format, uint32_t numberOfThreads);
+
+}
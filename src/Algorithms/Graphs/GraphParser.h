@@ -0,0 +1,49 @@
+#pragma once
+
+#include "DirectedGraphs/DirectedGraph.h"
+#include "UndirectedGraphs/UndirectedGraph.h"
+#include "Utils/Parallel.h"
+
+namespace GraphParser
+{
+
+enum class Format : uint8_t
+{
+    /** "size order" header followed by "first second weight" lines, as written by operator<< */
+    NATIVE,
+    /** DIMACS shortest path format (.gr): "c" comments, "p sp order size" and "a first second weight" with 1-based vertices */
+    DIMACS,
+    /** "first second [weight]" lines, "#" and "%" comments, order is the biggest vertex + 1, default weight is 1 */
+    EDGE_LIST
+};
+
+struct ParsedGraph
+{
+    uint32_t order;
+    DynamicArray<DirectedGraph::DirectedEdgeData> edges;
+};
+
+/**
+ * @return Format::DIMACS for .gr files, Format::EDGE_LIST for .el and .edges files, otherwise Format::NATIVE
+ */
+[[nodiscard]] Format DetectFormat(const std::string& path);
+
+/**
+ * Parses text with std::from_chars. With more than one thread the edge lines are split
+ * into chunks at line boundaries and parsed in parallel
+ * @return parsed graph or std::nullopt if the text is malformed
+ */
+[[nodiscard]] std::optional<ParsedGraph> Parse(const char* begin, const char* end, Format format, uint32_t numberOfThreads = 1);
+
+/**
+ * Maps the file into memory and parses it without copying
+ */
+[[nodiscard]] std::optional<ParsedGraph> ParseFile(const std::string& path, Format format, uint32_t numberOfThreads = 1);
+
+/**
+ * Parses the file and builds the graph with the bulk insertion path
+ */
+template<typename T, Graph::isGraph<T> = true>
+[[nodiscard]] std::optional<T> LoadGraph(const std::string& path, Format format, uint32_t numberOfThreads = 1);
+
+}
@@ -14,6 +14,38 @@ Graph::Vertex ListGraph::AddVertex()
     return newVertex;
 }
 
+void ListGraph::AddVertices(uint32_t count)
+{
+    if (count > MAX_SIZE - GetOrder())
+    {
+        throw std::runtime_error("Max number of vertices has been reached!");
+    }
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        graph.PushBack(List<Neighbour>());
+    }
+}
+
+void ListGraph::AppendEdges(const DynamicArray<EdgeData>& edges)
+{
+    // List::operator[] walks the list, so every row is looked up only once
+    DynamicArray<List<Neighbour>*> rows(GetOrder());
+    Vertex i = 0;
+    for (auto& neighbours : graph)
+    {
+        rows[i++] = &neighbours;
+    }
+
+    for (const auto& edge : edges)
+    {
+        rows[edge.vertices.first]->PushBack({edge.vertices.second, edge.weight});
+        rows[edge.vertices.second]->PushBack({edge.vertices.first, edge.weight});
+    }
+
+    size += edges.Size();
+}
+
 void ListGraph::Clear()
 {
     graph.Clear();
@@ -163,6 +195,17 @@ std::optional<DynamicArray<Graph::Neighbour>> ListGraph::GetNeighboursOf(Vertex
     return neighboursVertices;
 }
 
+ListGraph::NeighbourRange ListGraph::GetNeighbourRangeOf(Vertex vertex) const
+{
+    if (!DoesExist(vertex))
+    {
+        return {{nullptr, nullptr}, {nullptr, nullptr}};
+    }
+
+    const auto& neighbours = graph[vertex];
+    return {neighbours.begin(), neighbours.end()};
+}
+
 DynamicArray<Graph::Vertex> ListGraph::GetVertices() const
 {
     DynamicArray<Vertex> result(GetOrder());
@@ -199,44 +242,17 @@ DynamicArray<UndirectedGraph::EdgeData> ListGraph::GetEdges() const
 
 bool ListGraph::ForEachNeighbourOf(Vertex vertex, NeighbourPredicate predicate) const
 {
-    if (!DoesExist(vertex))
-    {
-        return false;
-    }
-
-    const auto& neighbours = graph[vertex];
-
-    for (const auto& neighbour : neighbours)
-    {
-        predicate(neighbour);
-    }
-
-    return true;
+    return VisitNeighboursOf(vertex, predicate);
 }
 
 void ListGraph::ForEachVertex(Graph::VertexPredicate predicate) const
 {
-    for (Vertex i = 0; i < GetOrder(); i++)
-    {
-        predicate(i);
-    }
+    VisitVertices(predicate);
 }
 
 void ListGraph::ForEachEdge(EdgePredicate predicate) const
 {
-    uint32_t i = 0;
-    for (const auto& neighbours : graph)
-    {
-        for (const auto& neighbour : neighbours)
-        {
-            Edge edge{i, neighbour.vertex};
-            if (i > neighbour.vertex)
-            {
-                predicate({edge, neighbour.weight});
-            }
-        }
-        i++;
-    }
+    VisitEdges(predicate);
 }
 
 ListGraph::Neighbour* ListGraph::GetNeighbourOfFirst(Edge edge)
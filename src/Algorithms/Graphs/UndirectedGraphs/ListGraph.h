@@ -6,7 +6,10 @@
 class ListGraph : public UndirectedGraph
 {
 public:
+    using NeighbourRange = Utils::Range<List<Neighbour>::ConstIterator>;
+
     Vertex AddVertex() override;
+    void AddVertices(uint32_t count) override;
 
     void Clear() override;
 
@@ -26,16 +29,76 @@ public:
     [[nodiscard]] DynamicArray<Vertex> GetVertices() const override;
     [[nodiscard]] DynamicArray<EdgeData> GetEdges() const override;
 
+    /**
+     * View of the adjacency list of the vertex, empty if the vertex does not exist
+     */
+    [[nodiscard]] NeighbourRange GetNeighbourRangeOf(Vertex vertex) const;
+
     bool ForEachNeighbourOf(Vertex vertex, NeighbourPredicate predicate) const override;
     void ForEachVertex(VertexPredicate predicate) const override;
     void ForEachEdge(EdgePredicate predicate) const override;
 
+    template<typename F>
+    bool VisitNeighboursOf(Vertex vertex, F&& visitor) const;
+
+    template<typename F>
+    void VisitVertices(F&& visitor) const;
+
+    template<typename F>
+    void VisitEdges(F&& visitor) const;
+
     [[nodiscard]] std::string ToString() const override;
 
+protected:
+    void AppendEdges(const DynamicArray<EdgeData>& edges) override;
+
 private:
     [[nodiscard]] const Neighbour* GetNeighbourOfFirst(Edge edge) const;
     [[nodiscard]] Neighbour* GetNeighbourOfFirst(Edge edge);
 
     List<List<Neighbour>> graph;
     uint64_t size = 0;
-};
\ No newline at end of file
+};
+
+template<typename F>
+bool ListGraph::VisitNeighboursOf(Vertex vertex, F&& visitor) const
+{
+    if (!DoesExist(vertex))
+    {
+        return false;
+    }
+
+    for (const auto& neighbour : GetNeighbourRangeOf(vertex))
+    {
+        visitor(neighbour);
+    }
+
+    return true;
+}
+
+template<typename F>
+void ListGraph::VisitVertices(F&& visitor) const
+{
+    for (Vertex i = 0; i < GetOrder(); i++)
+    {
+        visitor(i);
+    }
+}
+
+template<typename F>
+void ListGraph::VisitEdges(F&& visitor) const
+{
+    uint32_t i = 0;
+    for (const auto& neighbours : graph)
+    {
+        for (const auto& neighbour : neighbours)
+        {
+            Edge edge{i, neighbour.vertex};
+            if (i > neighbour.vertex)
+            {
+                visitor(EdgeData{edge, neighbour.weight});
+            }
+        }
+        i++;
+    }
+}
\ No newline at end of file
@@ -14,6 +14,56 @@ Graph::Vertex MatrixGraph::AddVertex()
     return newVertex;
 }
 
+void MatrixGraph::AddVertices(uint32_t count)
+{
+    if (count > MAX_SIZE - GetOrder())
+    {
+        throw std::runtime_error("Max number of vertices has been reached!");
+    }
+
+    DynamicArray<DynamicArray<Weight>> newGraph(static_cast<size_t>(GetOrder()) + count);
+
+    for (Vertex i = 0; i < GetOrder(); i++)
+    {
+        newGraph[i] = std::move(graph[i]);
+    }
+    for (size_t i = GetOrder(); i < newGraph.Size(); i++)
+    {
+        newGraph[i] = DynamicArray<Weight>(GetSize(), Graph::INFINITY_WEIGHT);
+    }
+
+    graph = std::move(newGraph);
+}
+
+void MatrixGraph::AppendEdges(const DynamicArray<EdgeData>& edges)
+{
+    const size_t oldSize = GetSize();
+
+    for (Vertex i = 0; i < GetOrder(); i++)
+    {
+        DynamicArray<Weight> row(oldSize + edges.Size(), Graph::INFINITY_WEIGHT);
+        for (size_t edgeNumber = 0; edgeNumber < oldSize; edgeNumber++)
+        {
+            row[edgeNumber] = graph[i][edgeNumber];
+        }
+        graph[i] = std::move(row);
+    }
+
+    for (size_t i = 0; i < edges.Size(); i++)
+    {
+        const auto& edge = edges[i];
+        graph[edge.vertices.first][oldSize + i] = edge.weight;
+        graph[edge.vertices.second][oldSize + i] = edge.weight;
+    }
+
+    size += edges.Size();
+}
+
+bool MatrixGraph::IsValidWeight(Weight weight) const noexcept
+{
+    return weight != 0;
+}
+
 void MatrixGraph::Clear()
 {
     graph.Clear();
@@ -235,6 +285,16 @@ std::optional<DynamicArray<Graph::Neighbour>> MatrixGraph::GetNeighboursOf(Verte
     return result;
 }
 
+MatrixGraph::NeighbourRange MatrixGraph::GetNeighbourRangeOf(Vertex vertex) const
+{
+    if (!DoesExist(vertex))
+    {
+        return {NeighbourIterator{this, vertex, GetSize()}, NeighbourIterator{this, vertex, GetSize()}};
+    }
+
+    return {NeighbourIterator{this, vertex, 0}, NeighbourIterator{this, vertex, GetSize()}};
+}
+
 DynamicArray<Graph::Vertex> MatrixGraph::GetVertices() const
 {
     DynamicArray<Vertex> result(GetOrder());
@@ -278,61 +338,17 @@ DynamicArray<UndirectedGraph::EdgeData> MatrixGraph::GetEdges() const
 
 bool MatrixGraph::ForEachNeighbourOf(Vertex vertex, NeighbourPredicate predicate) const
 {
-    if (!DoesExist(vertex))
-    {
-        return false;
-    }
-
-    for (size_t edgeNumber = 0; edgeNumber < GetSize(); edgeNumber++)
-    {
-        if (graph[vertex][edgeNumber] != INFINITY_WEIGHT)
-        {
-            for (Vertex i = 0; i < GetOrder(); i++)
-            {
-                if (i == vertex)
-                {
-                    continue;
-                }
-                if (graph[i][edgeNumber] != INFINITY_WEIGHT)
-                {
-                    predicate({i, graph[i][edgeNumber]});
-                }
-            }
-        }
-    }
-
-    return true;
+    return VisitNeighboursOf(vertex, predicate);
 }
 
 void MatrixGraph::ForEachVertex(VertexPredicate predicate) const
 {
-    for (Vertex i = 0; i < GetOrder(); i++)
-    {
-        predicate(i);
-    }
+    VisitVertices(predicate);
 }
 
 void MatrixGraph::ForEachEdge(EdgePredicate predicate) const
 {
-    for (size_t edge = 0; edge < GetSize(); edge++)
-    {
-        Edge currentEdge = {MAX_SIZE, MAX_SIZE};
-        for (Vertex i = 0; i < GetOrder(); i++)
-        {
-            if (graph[i][edge] != INFINITY_WEIGHT)
-            {
-                if (currentEdge.first == MAX_SIZE)
-                {
-                    currentEdge.first = i;
-                }
-                else
-                {
-                    currentEdge.second = i;
-                }
-            }
-        }
-        predicate({currentEdge, graph[currentEdge.first][edge]});
-    }
+    VisitEdges(predicate);
 }
 
 std::string MatrixGraph::ToString() const
@@ -511,3 +527,29 @@ std::string MatrixGraph::OpeningSeparator(size_t columns, size_t columnWidth)
     }
     return result;
 }
+
+MatrixGraph::NeighbourIterator::NeighbourIterator(const MatrixGraph* parent, Vertex vertex, size_t edge) noexcept
+    : parent(parent)
+    , vertex(vertex)
+    , edge(edge)
+{
+    Seek();
+}
+
+void MatrixGraph::NeighbourIterator::Seek() noexcept
+{
+    for (; edge < parent->GetSize(); edge++)
+    {
+        if (parent->graph[vertex][edge] != INFINITY_WEIGHT)
+        {
+            for (Vertex i = 0; i < parent->GetOrder(); i++)
+            {
+                if (i != vertex && parent->graph[i][edge] != INFINITY_WEIGHT)
+                {
+                    other = i;
+                    return;
+                }
+            }
+        }
+    }
+}
@@ -5,7 +5,11 @@
 class MatrixGraph : public UndirectedGraph
 {
 public:
+    class NeighbourIterator;
+    using NeighbourRange = Utils::Range<NeighbourIterator>;
+
     Vertex AddVertex() override;
+    void AddVertices(uint32_t count) override;
     void Clear() override;
 
     bool AddEdge(const EdgeData& edge) override;
@@ -24,12 +28,30 @@ public:
     [[nodiscard]] DynamicArray<Vertex> GetVertices() const override;
     [[nodiscard]] DynamicArray<EdgeData> GetEdges() const override;
 
+    /**
+     * Lazily scans the incidence matrix, nothing is copied
+     */
+    [[nodiscard]] NeighbourRange GetNeighbourRangeOf(Vertex vertex) const;
+
     bool ForEachNeighbourOf(Vertex vertex, NeighbourPredicate predicate) const override;
     void ForEachVertex(VertexPredicate predicate) const override;
     void ForEachEdge(EdgePredicate predicate) const override;
 
+    template<typename F>
+    bool VisitNeighboursOf(Vertex vertex, F&& visitor) const;
+
+    template<typename F>
+    void VisitVertices(F&& visitor) const;
+
+    template<typename F>
+    void VisitEdges(F&& visitor) const;
+
     [[nodiscard]] std::string ToString() const override;
 
+protected:
+    void AppendEdges(const DynamicArray<EdgeData>& edges) override;
+    [[nodiscard]] bool IsValidWeight(Weight weight) const noexcept override;
+
 private:
     [[nodiscard]] size_t CalculateColumnWidth() const;
     [[nodiscard]] static std::string RowSeparator(size_t columns, size_t columnWidth);
@@ -38,4 +60,116 @@ private:
 
     DynamicArray<DynamicArray<Weight>> graph;
     uint64_t size = 0;
-};
\ No newline at end of file
+};
+
+class MatrixGraph::NeighbourIterator
+{
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = Neighbour;
+    using pointer = const Neighbour*;
+    using reference = Neighbour;
+
+    NeighbourIterator() = default;
+    NeighbourIterator(const MatrixGraph* parent, Vertex vertex, size_t edge) noexcept;
+
+    [[nodiscard]] Neighbour operator*() const noexcept
+    {
+        return {other, parent->graph[other][edge]};
+    }
+
+    NeighbourIterator& operator++() noexcept
+    {
+        ++edge;
+        Seek();
+        return *this;
+    }
+
+    NeighbourIterator operator++(int) noexcept
+    {
+        auto copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    [[nodiscard]] bool operator==(const NeighbourIterator& rhs) const noexcept
+    {
+        return edge == rhs.edge;
+    }
+
+    [[nodiscard]] bool operator!=(const NeighbourIterator& rhs) const noexcept
+    {
+        return edge != rhs.edge;
+    }
+
+private:
+    void Seek() noexcept;
+
+    const MatrixGraph* parent = nullptr;
+    Vertex vertex = 0;
+    size_t edge = 0;
+    Vertex other = 0;
+};
+
+template<typename F>
+bool MatrixGraph::VisitNeighboursOf(Vertex vertex, F&& visitor) const
+{
+    if (!DoesExist(vertex))
+    {
+        return false;
+    }
+
+    for (size_t edgeNumber = 0; edgeNumber < GetSize(); edgeNumber++)
+    {
+        if (graph[vertex][edgeNumber] != INFINITY_WEIGHT)
+        {
+            for (Vertex i = 0; i < GetOrder(); i++)
+            {
+                if (i == vertex)
+                {
+                    continue;
+                }
+                if (graph[i][edgeNumber] != INFINITY_WEIGHT)
+                {
+                    visitor(Neighbour{i, graph[i][edgeNumber]});
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+template<typename F>
+void MatrixGraph::VisitVertices(F&& visitor) const
+{
+    for (Vertex i = 0; i < GetOrder(); i++)
+    {
+        visitor(i);
+    }
+}
+
+template<typename F>
+void MatrixGraph::VisitEdges(F&& visitor) const
+{
+    for (size_t edge = 0; edge < GetSize(); edge++)
+    {
+        Edge currentEdge = {MAX_SIZE, MAX_SIZE};
+        for (Vertex i = 0; i < GetOrder(); i++)
+        {
+            if (graph[i][edge] != INFINITY_WEIGHT)
+            {
+                if (currentEdge.first == MAX_SIZE)
+                {
+                    currentEdge.first = i;
+                }
+                else
+                {
+                    currentEdge.second = i;
+                }
+            }
+        }
+        visitor(EdgeData{currentEdge, graph[currentEdge.first][edge]});
+    }
+}
\ No newline at end of file
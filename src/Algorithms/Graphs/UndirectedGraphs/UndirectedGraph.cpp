@@ -25,7 +25,7 @@ float UndirectedGraph::GetDensity() const noexcept
 {
     const uint32_t order = GetOrder();
     const uint64_t size  = GetSize();
-    return static_cast<float>(2 * size) / static_cast<float>((order * (order - 1)));
+    return static_cast<float>(2 * size) / static_cast<float>(static_cast<uint64_t>(order) * (order - 1));
 }
 
 void UndirectedGraph::Serialize(std::ostream& os) const
@@ -38,24 +38,109 @@ void UndirectedGraph::Serialize(std::ostream& os) const
 
 void UndirectedGraph::Deserialize(std::istream& is)
 {
-    size_t size;
-    uint32_t order;
+    size_t size = 0;
+    uint32_t order = 0;
 
     is >> size >> order;
+    if (order > MAX_DESERIALIZED_ORDER)
+    {
+        is.setstate(std::ios::failbit);
+        return;
+    }
 
-    for (uint32_t i = 0; i < order; i++)
+    DynamicArray<EdgeData> buffer;                                  // Liczba krawędzi nie jest sprawdzona, więc tablica
+    size_t count = 0;                                               // rośnie wraz z odczytem krawędzi
+    EdgeData edge;
+    while (count < size && is >> edge.vertices.first >> edge.vertices.second >> edge.weight)
     {
-        AddVertex();
+        if (edge.vertices.first >= order || edge.vertices.second >= order)
+        {
+            is.setstate(std::ios::failbit);
+            break;
+        }
+        if (count == buffer.Size())
+        {
+            buffer.Resize(Utils::Max(size_t {16}, 2 * count));
+        }
+        buffer[count++] = edge;
     }
+    if (is.fail())                                                  // Obcięty lub błędny strumień - graf
+    {                                                               // pozostaje bez zmian
+        return;
+    }
+
+    DynamicArray<EdgeData> edges(count);
+    std::copy(buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(count), edges.begin());
 
-    for (size_t i = 0; i < size; i++)
+    AddVertices(order);
+    AddEdgesBulk(edges);
+}
+
+size_t UndirectedGraph::AddEdgesBulk(const DynamicArray<EdgeData>& edges, BulkPolicy policy)
+{
+    size_t numberOfValidEdges = 0;
+    for (const auto& edge : edges)
     {
-        Graph::Vertex first;
-        Graph::Vertex second;
-        Graph::Weight weight;
+        if (CanBeAdded(edge))
+        {
+            numberOfValidEdges++;
+        }
+    }
 
-        is >> first >> second >> weight;
+    DynamicArray<EdgeData> validEdges(numberOfValidEdges);
+    size_t i = 0;
+    for (const auto& edge : edges)
+    {
+        if (CanBeAdded(edge))
+        {
+            validEdges[i++] = edge;
+        }
+    }
 
-        AddEdge({{first, second}, weight});
+    if (policy == BulkPolicy::TRUST_INPUT)
+    {
+        AppendEdges(validEdges);
+        return validEdges.Size();
     }
+
+    DynamicArray<Utils::Pair<Vertex, Vertex>> pairs(validEdges.Size());
+    for (i = 0; i < validEdges.Size(); i++)
+    {
+        const auto& vertices = validEdges[i].vertices;
+        pairs[i] = {Utils::Min(vertices.first, vertices.second), Utils::Max(vertices.first, vertices.second)};
+    }
+
+    auto firstOccurrences = MarkFirstOccurrences(GetOrder(), pairs);
+    const bool isEmpty = GetSize() == 0;
+
+    size_t numberOfNewEdges = 0;
+    for (i = 0; i < validEdges.Size(); i++)
+    {
+        firstOccurrences[i] = firstOccurrences[i] && (isEmpty || !DoesExist(validEdges[i].vertices));
+        if (firstOccurrences[i])
+        {
+            numberOfNewEdges++;
+        }
+    }
+
+    DynamicArray<EdgeData> newEdges(numberOfNewEdges);
+    numberOfNewEdges = 0;
+    for (i = 0; i < validEdges.Size(); i++)
+    {
+        if (firstOccurrences[i])
+        {
+            newEdges[numberOfNewEdges++] = validEdges[i];
+        }
+    }
+
+    AppendEdges(newEdges);
+    return newEdges.Size();
+}
+
+bool UndirectedGraph::CanBeAdded(const EdgeData& edge) const
+{
+    return edge.vertices.first != edge.vertices.second &&
+           DoesExist(edge.vertices.first) &&
+           DoesExist(edge.vertices.second) &&
+           IsValidWeight(edge.weight);
 }
\ No newline at end of file
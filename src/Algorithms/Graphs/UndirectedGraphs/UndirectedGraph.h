@@ -30,6 +30,13 @@ public:
     using Graph::DoesExist;
 
     virtual bool AddEdge(const EdgeData& edge) = 0;
+
+    /**
+     * Adds all edges at once. Loops, edges with non-existing vertices and, for matrices,
+     * zero weights are always skipped, duplicates only with BulkPolicy::DEDUPLICATE
+     * @return number of added edges
+     */
+    size_t AddEdgesBulk(const DynamicArray<EdgeData>& edges, BulkPolicy policy = BulkPolicy::DEDUPLICATE);
     virtual bool RemoveEdge(Edge edge) = 0;
 
     [[nodiscard]] virtual std::optional<Weight> GetWeight(Edge edge) const = 0;
@@ -41,7 +48,24 @@ public:
 
     virtual void ForEachEdge(EdgePredicate predicate) const = 0;
 
+    template<typename F>
+    void VisitEdges(F&& visitor) const;
+
 protected:
     void Serialize(std::ostream& os) const override;
     void Deserialize(std::istream& is) override;
-};
\ No newline at end of file
+
+    /**
+     * Appends edges which are known to be valid and not present in the graph yet
+     */
+    virtual void AppendEdges(const DynamicArray<EdgeData>& edges) = 0;
+
+private:
+    [[nodiscard]] bool CanBeAdded(const EdgeData& edge) const;
+};
+
+template<typename F>
+void UndirectedGraph::VisitEdges(F&& visitor) const
+{
+    ForEachEdge(std::forward<F>(visitor));
+}
\ No newline at end of file
@@ -10,14 +10,8 @@ T convert(const UndirectedGraph& graph)
 {
     T newGraph;
 
-    for (uint32_t i = 0; i < graph.GetOrder(); i++)
-    {
-        newGraph.AddVertex();
-    }
-
-    graph.ForEachEdge([&newGraph](const UndirectedGraph::EdgeData& edge) {
-        newGraph.AddEdge(edge);
-    });
+    newGraph.AddVertices(graph.GetOrder());
+    newGraph.AddEdgesBulk(graph.GetEdges(), Graph::BulkPolicy::TRUST_INPUT);
 
     return newGraph;
 }
@@ -0,0 +1,144 @@
+#include "Boruvka.h"
+#include "ConcurrentDSU.h"
+
+#include <atomic>
+
+namespace MST::Boruvka
+{
+
+constexpr uint64_t NO_EDGE = UINT64_MAX;
+
+/**
+ * Weight in the high half and index in the low half, so comparing keys orders edges by weight, then by index
+ */
+[[nodiscard]] uint64_t MakeKey(Graph::Weight weight, uint32_t index) noexcept;
+[[nodiscard]] uint32_t GetIndex(uint64_t key) noexcept;
+
+void ProposeEdge(std::atomic<uint64_t>& cheapest, uint64_t key) noexcept;
+
+Result FindMstOf(const UndirectedGraph& graph, uint32_t numberOfThreads)
+{
+    if (graph.GetSize() < 1 || graph.GetSize() > UINT32_MAX)
+    {
+        return {{}, 0};
+    }
+
+    const auto edges = graph.GetEdges();
+    const auto order = graph.GetOrder();
+    const auto numberOfEdges = static_cast<uint32_t>(edges.Size());
+    numberOfThreads = Utils::Max(Utils::Min(numberOfThreads, numberOfEdges), 1u);
+
+    ConcurrentDSU forest(order);
+    DynamicArray<std::atomic<uint64_t>> cheapest(order);
+    DynamicArray<bool> selectedFlags(numberOfEdges, false);
+
+    // every thread owns a fixed part of the candidates and compacts it in place when edges become internal
+    DynamicArray<uint32_t> candidates(numberOfEdges);
+    DynamicArray<uint32_t> chunkBegins(numberOfThreads);
+    DynamicArray<uint32_t> chunkEnds(numberOfThreads);
+    for (uint32_t i = 0; i < numberOfEdges; i++)
+    {
+        candidates[i] = i;
+    }
+    for (uint32_t i = 0; i < numberOfThreads; i++)
+    {
+        chunkBegins[i] = Utils::GetPartBegin(numberOfEdges, i, numberOfThreads);
+        chunkEnds[i] = Utils::GetPartBegin(numberOfEdges, i + 1, numberOfThreads);
+    }
+
+    uint32_t numberOfComponents = order;
+    while (numberOfComponents > 1)
+    {
+        Utils::ParallelFor(numberOfThreads, [&](uint32_t thread) {
+            for (auto vertex = Utils::GetPartBegin(order, thread, numberOfThreads);
+                 vertex < Utils::GetPartBegin(order, thread + 1, numberOfThreads);
+                 vertex++)
+            {
+                cheapest[vertex].store(NO_EDGE, std::memory_order_relaxed);
+            }
+        });
+
+        Utils::ParallelFor(numberOfThreads, [&](uint32_t thread) {
+            auto end = chunkBegins[thread];
+            for (auto i = chunkBegins[thread]; i < chunkEnds[thread]; i++)
+            {
+                const auto& edge = edges[candidates[i]];
+                auto firstRoot = forest.Find(edge.vertices.first);
+                auto secondRoot = forest.Find(edge.vertices.second);
+                if (firstRoot == secondRoot)
+                {
+                    continue;
+                }
+
+                auto key = MakeKey(edge.weight, candidates[i]);
+                ProposeEdge(cheapest[firstRoot], key);
+                ProposeEdge(cheapest[secondRoot], key);
+                candidates[end++] = candidates[i];
+            }
+            chunkEnds[thread] = end;
+        });
+
+        std::atomic<uint32_t> numberOfMerges = 0;
+        Utils::ParallelFor(numberOfThreads, [&](uint32_t thread) {
+            uint32_t merges = 0;
+            for (auto vertex = Utils::GetPartBegin(order, thread, numberOfThreads);
+                 vertex < Utils::GetPartBegin(order, thread + 1, numberOfThreads);
+                 vertex++)
+            {
+                auto key = cheapest[vertex].load(std::memory_order_relaxed);
+                if (key == NO_EDGE)
+                {
+                    continue;
+                }
+
+                auto index = GetIndex(key);
+                if (forest.Union(edges[index].vertices.first, edges[index].vertices.second))
+                {
+                    selectedFlags[index] = true;
+                    merges++;
+                }
+            }
+            numberOfMerges += merges;
+        });
+
+        if (numberOfMerges == 0)
+        {
+            return {{}, 0};
+        }
+        numberOfComponents -= numberOfMerges;
+    }
+
+    Result result;
+    result.weight = 0;
+    result.edges.Resize(order - 1);
+    uint32_t position = 0;
+    for (uint32_t i = 0; i < numberOfEdges; i++)
+    {
+        if (selectedFlags[i])
+        {
+            result.edges[position++] = edges[i];
+            result.weight += edges[i].weight;
+        }
+    }
+
+    return result;
+}
+
+uint64_t MakeKey(Graph::Weight weight, uint32_t index) noexcept
+{
+    return (static_cast<uint64_t>(weight) << 32u) | index;
+}
+
+uint32_t GetIndex(uint64_t key) noexcept
+{
+    return static_cast<uint32_t>(key);
+}
+
+void ProposeEdge(std::atomic<uint64_t>& cheapest, uint64_t key) noexcept
+{
+    auto current = cheapest.load(std::memory_order_relaxed);
+    while (key < current && !cheapest.compare_exchange_weak(current, key, std::memory_order_relaxed))
+    { }
+}
+
+}
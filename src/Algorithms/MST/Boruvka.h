@@ -0,0 +1,16 @@
+#pragma once
+
+#include "Result.h"
+#include "Utils/Parallel.h"
+
+namespace MST::Boruvka
+{
+
+/**
+ * Parallel Borůvka's algorithm. In every round each thread scans its part of the edges and proposes
+ * the lightest edge leaving every component, then the proposed edges are merged with ConcurrentDSU.
+ * Edges with equal weights are ordered by their index in GetEdges(), so the result has the same weight as Kruskal's
+ */
+[[nodiscard]] Result FindMstOf(const UndirectedGraph& graph, uint32_t numberOfThreads = Utils::GetNumberOfThreads());
+
+}
\ No newline at end of file
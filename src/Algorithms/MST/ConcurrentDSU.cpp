@@ -0,0 +1,74 @@
+#include "ConcurrentDSU.h"
+
+ConcurrentDSU::ConcurrentDSU(uint32_t numberOfVertices)
+    : parents(numberOfVertices)
+{
+    for (Graph::Vertex vertex = 0; vertex < numberOfVertices; vertex++)
+    {
+        parents[vertex].store(vertex, std::memory_order_relaxed);
+    }
+}
+
+Graph::Vertex ConcurrentDSU::Find(Graph::Vertex vertex)
+{
+    if (parents.Size() <= vertex)
+    {
+        return vertex;
+    }
+
+    auto parent = parents[vertex].load(std::memory_order_acquire);
+    while (parent != vertex)
+    {
+        auto grandparent = parents[parent].load(std::memory_order_acquire);
+        if (parent != grandparent)
+        {
+            parents[vertex].compare_exchange_weak(parent, grandparent, std::memory_order_release, std::memory_order_relaxed);
+        }
+        vertex = grandparent;
+        parent = parents[vertex].load(std::memory_order_acquire);
+    }
+
+    return vertex;
+}
+
+bool ConcurrentDSU::Union(Graph::Vertex u, Graph::Vertex v)
+{
+    while (true)
+    {
+        auto uRoot = Find(u);
+        auto vRoot = Find(v);
+
+        if (uRoot == vRoot)
+        {
+            return false;
+        }
+        if (uRoot < vRoot)
+        {
+            Utils::Swap(uRoot, vRoot);
+        }
+
+        auto expected = uRoot;
+        if (parents[uRoot].compare_exchange_strong(expected, vRoot, std::memory_order_acq_rel))
+        {
+            return true;
+        }
+    }
+}
+
+bool ConcurrentDSU::AreConnected(Graph::Vertex u, Graph::Vertex v)
+{
+    while (true)
+    {
+        auto uRoot = Find(u);
+        auto vRoot = Find(v);
+
+        if (uRoot == vRoot)
+        {
+            return true;
+        }
+        if (parents[uRoot].load(std::memory_order_acquire) == uRoot)
+        {
+            return false;
+        }
+    }
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Algorithms/Graphs/Graph.h"
+
+#include <atomic>
+
+/**
+ * Lock-free disjoint set union, Find and Union may be called from many threads at once.
+ * Union links the root with the bigger index under the other one with a CAS, so no cycle can appear,
+ * Find compresses paths with path halving
+ */
+class ConcurrentDSU
+{
+public:
+    explicit ConcurrentDSU(uint32_t numberOfVertices);
+
+    [[nodiscard]] Graph::Vertex Find(Graph::Vertex vertex);
+
+    /**
+     * @return true if the vertices were in different sets, false if they already were connected
+     */
+    bool Union(Graph::Vertex u, Graph::Vertex v);
+
+    [[nodiscard]] bool AreConnected(Graph::Vertex u, Graph::Vertex v);
+
+private:
+    DynamicArray<std::atomic<Graph::Vertex>> parents;
+};
\ No newline at end of file
@@ -1,56 +1,70 @@
 #include "DSU.h"
 
-DSU::DSU(const DynamicArray<Graph::Vertex>& vertices)
+DSU::DSU(uint32_t numberOfVertices)
+    : nodes(numberOfVertices)
+    , numberOfVertices(0)
 {
-    parents.Resize(vertices.Size());
-    ranks.Resize(vertices.Size());
-    for (const auto& vertex : vertices)
+    Reset(numberOfVertices);
+}
+
+void DSU::Reset(uint32_t numberOfVertices)
+{
+    if (nodes.Size() < numberOfVertices)
     {
-        AddVertex(vertex);
+        nodes = DynamicArray<Node>(numberOfVertices);
+    }
+
+    this->numberOfVertices = numberOfVertices;
+    for (Graph::Vertex vertex = 0; vertex < numberOfVertices; vertex++)
+    {
+        nodes[vertex] = {vertex, 1};
     }
 }
 
 Graph::Vertex DSU::Find(Graph::Vertex vertex)
 {
-    if (parents.Size() <= vertex)
+    if (numberOfVertices <= vertex)
     {
         return vertex;
     }
 
-    auto& parent = parents[vertex];
-    if (parent == NO_PARENT)
+    while (nodes[vertex].parent != vertex)
     {
-        return vertex;
+        auto& parent = nodes[vertex].parent;
+        parent = nodes[parent].parent;
+        vertex = parent;
     }
 
-    return parent = Find(parent);
+    return vertex;
 }
 
-void DSU::Union(Graph::Vertex u, Graph::Vertex v)
+bool DSU::Union(Graph::Vertex u, Graph::Vertex v)
 {
     auto uRoot = Find(u);
     auto vRoot = Find(v);
 
-    if (uRoot != vRoot)
+    if (uRoot == vRoot || numberOfVertices <= uRoot || numberOfVertices <= vRoot)
     {
-        auto& uRootRank = ranks[uRoot];
-        auto& vRootRank = ranks[vRoot];
-
-        if (uRootRank < vRootRank)
-        {
-            parents[uRoot] = vRoot;
-            vRootRank += uRootRank;
-        }
-        else
-        {
-            parents[vRoot] = uRoot;
-            uRootRank += vRootRank;
-        }
+        return false;
     }
+
+    if (nodes[uRoot].size < nodes[vRoot].size)
+    {
+        Utils::Swap(uRoot, vRoot);
+    }
+    nodes[vRoot].parent = uRoot;
+    nodes[uRoot].size += nodes[vRoot].size;
+
+    return true;
+}
+
+uint32_t DSU::GetSizeOf(Graph::Vertex vertex)
+{
+    auto root = Find(vertex);
+    return root < numberOfVertices ? nodes[root].size : 1;
 }
 
-void DSU::AddVertex(Graph::Vertex vertex)
+uint32_t DSU::GetNumberOfVertices() const noexcept
 {
-    parents[vertex] = NO_PARENT;
-    ranks[vertex] = 1;
+    return numberOfVertices;
 }
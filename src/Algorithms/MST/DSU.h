@@ -2,20 +2,38 @@
 
 #include "Algorithms/Graphs/Graph.h"
 
+/**
+ * Disjoint set union with union by size and iterative path halving.
+ * Parent and size of a vertex are kept next to each other in one array
+ */
 class DSU
 {
 public:
-    explicit DSU(const DynamicArray<Graph::Vertex>& vertices);
+    explicit DSU(uint32_t numberOfVertices);
+
+    /**
+     * Makes every vertex from [0, numberOfVertices) a separate set again.
+     * Memory is reallocated only if the structure has to grow
+     */
+    void Reset(uint32_t numberOfVertices);
 
     [[nodiscard]] Graph::Vertex Find(Graph::Vertex vertex);
 
-    void Union(Graph::Vertex u, Graph::Vertex v);
+    /**
+     * @return true if the vertices were in different sets, false if they already were connected
+     */
+    bool Union(Graph::Vertex u, Graph::Vertex v);
 
-private:
-    void AddVertex(Graph::Vertex vertex);
+    [[nodiscard]] uint32_t GetSizeOf(Graph::Vertex vertex);
+    [[nodiscard]] uint32_t GetNumberOfVertices() const noexcept;
 
-    static constexpr uint32_t NO_PARENT = UINT32_MAX;
+private:
+    struct Node
+    {
+        Graph::Vertex parent;
+        uint32_t size;
+    };
 
-    DynamicArray<Graph::Vertex> parents;
-    DynamicArray<uint32_t> ranks;
+    DynamicArray<Node> nodes;
+    uint32_t numberOfVertices;
 };
\ No newline at end of file
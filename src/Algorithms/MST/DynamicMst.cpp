@@ -0,0 +1,240 @@
+#include "DynamicMst.h"
+
+namespace MST
+{
+
+DynamicMst::DynamicMst(uint32_t order)
+    : order(order)
+    , forest(order)
+    , numberOfFreeIds(0)
+    , numberOfIds(0)
+    , numberOfTreeEdges(0)
+    , weight(0)
+{ }
+
+DynamicMst::DynamicMst(const UndirectedGraph& graph)
+    : DynamicMst(graph.GetOrder())
+{
+    graph.VisitEdges([this](const UndirectedGraph::EdgeData& edge) {
+        InsertEdge(edge);
+    });
+}
+
+bool DynamicMst::InsertEdge(const UndirectedGraph::EdgeData& edge)
+{
+    const auto[first, second] = edge.vertices;
+    if (first == second || first >= order || second >= order ||
+        ids.Find(MakeVerticesKey(edge.vertices)) != ids.end())
+    {
+        return false;
+    }
+
+    auto id = AllocateId();
+    records[id] = {edge, false};
+    ids.Insert({MakeVerticesKey(edge.vertices), id});
+    AddToForest(id);
+
+    return true;
+}
+
+bool DynamicMst::DeleteEdge(UndirectedGraph::Edge edge)
+{
+    auto it = ids.Find(MakeVerticesKey(edge));
+    if (it == ids.end())
+    {
+        return false;
+    }
+
+    auto id = it->second;
+    ids.Remove(it->first);
+
+    if (records[id].isInTree)
+    {
+        CutEdge(id);
+        Replace();
+    }
+    else
+    {
+        nonTreeEdges.Remove(MakeWeightKey(id));
+    }
+
+    freeIds[numberOfFreeIds++] = id;
+    return true;
+}
+
+bool DynamicMst::UpdateWeight(UndirectedGraph::Edge edge, Graph::Weight newWeight)
+{
+    auto it = ids.Find(MakeVerticesKey(edge));
+    if (it == ids.end())
+    {
+        return false;
+    }
+
+    auto id = it->second;
+    auto& record = records[id];
+
+    if (record.isInTree && newWeight <= record.data.weight)
+    {
+        weight = weight - record.data.weight + newWeight;
+        record.data.weight = newWeight;
+        forest.SetValue(GetNode(id), MakeWeightKey(id));
+    }
+    else if (record.isInTree)
+    {
+        // a heavier tree edge may be replaced by a non-tree edge crossing the same cut
+        CutEdge(id);
+        record.data.weight = newWeight;
+        Replace();
+        AddToForest(id);
+    }
+    else
+    {
+        nonTreeEdges.Remove(MakeWeightKey(id));
+        record.data.weight = newWeight;
+        AddToForest(id);
+    }
+
+    return true;
+}
+
+Result DynamicMst::GetMst() const
+{
+    if (order == 0 || numberOfTreeEdges != order - 1)
+    {
+        return {{}, 0};
+    }
+
+    Result result;
+    result.edges.Resize(numberOfTreeEdges);
+    result.weight = weight;
+
+    uint32_t position = 0;
+    for (EdgeId id = 0; id < numberOfIds; id++)
+    {
+        if (records[id].isInTree)
+        {
+            result.edges[position++] = records[id].data;
+        }
+    }
+
+    return result;
+}
+
+uint64_t DynamicMst::GetWeight() const noexcept
+{
+    return weight;
+}
+
+uint32_t DynamicMst::GetOrder() const noexcept
+{
+    return order;
+}
+
+uint32_t DynamicMst::GetNumberOfTreeEdges() const noexcept
+{
+    return numberOfTreeEdges;
+}
+
+size_t DynamicMst::GetSize() const noexcept
+{
+    return ids.Size();
+}
+
+uint64_t DynamicMst::MakeVerticesKey(UndirectedGraph::Edge edge) noexcept
+{
+    return (static_cast<uint64_t>(Utils::Min(edge.first, edge.second)) << 32u) | Utils::Max(edge.first, edge.second);
+}
+
+uint64_t DynamicMst::MakeWeightKey(EdgeId id) const noexcept
+{
+    return (static_cast<uint64_t>(records[id].data.weight) << 32u) | id;
+}
+
+LinkCutTree::Node DynamicMst::GetNode(EdgeId id) const noexcept
+{
+    return order + id;
+}
+
+DynamicMst::EdgeId DynamicMst::AllocateId()
+{
+    if (numberOfFreeIds > 0)
+    {
+        return freeIds[--numberOfFreeIds];
+    }
+
+    if (numberOfIds == records.Size())
+    {
+        const auto capacity = Utils::Max(static_cast<size_t>(16), 2 * records.Size());
+        records.Resize(capacity);
+        freeIds.Resize(capacity);
+    }
+
+    forest.AddNodes(1);
+    return numberOfIds++;
+}
+
+void DynamicMst::AddToForest(EdgeId id)
+{
+    const auto[first, second] = records[id].data.vertices;
+    if (!forest.AreConnected(first, second))
+    {
+        LinkEdge(id);
+        return;
+    }
+
+    const auto heaviestId = forest.FindPathMax(first, second) - order;
+    if (MakeWeightKey(id) < MakeWeightKey(heaviestId))
+    {
+        CutEdge(heaviestId);
+        nonTreeEdges.Insert(MakeWeightKey(heaviestId));
+        LinkEdge(id);
+    }
+    else
+    {
+        nonTreeEdges.Insert(MakeWeightKey(id));
+    }
+}
+
+void DynamicMst::LinkEdge(EdgeId id)
+{
+    auto& record = records[id];
+    const auto node = GetNode(id);
+
+    forest.SetValue(node, MakeWeightKey(id));
+    forest.Link(record.data.vertices.first, node);
+    forest.Link(node, record.data.vertices.second);
+
+    record.isInTree = true;
+    numberOfTreeEdges++;
+    weight += record.data.weight;
+}
+
+void DynamicMst::CutEdge(EdgeId id)
+{
+    auto& record = records[id];
+    const auto node = GetNode(id);
+
+    forest.Cut(record.data.vertices.first, node);
+    forest.Cut(node, record.data.vertices.second);
+
+    record.isInTree = false;
+    numberOfTreeEdges--;
+    weight -= record.data.weight;
+}
+
+void DynamicMst::Replace()
+{
+    // every non-tree edge closed a cycle, so after a cut only edges crossing it have disconnected ends
+    for (auto key : nonTreeEdges)
+    {
+        const auto id = static_cast<EdgeId>(key);
+        if (!forest.AreConnected(records[id].data.vertices.first, records[id].data.vertices.second))
+        {
+            nonTreeEdges.Remove(key);
+            LinkEdge(id);
+            return;
+        }
+    }
+}
+
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "LinkCutTree.h"
+#include "Result.h"
+#include "Containers/Map.h"
+
+namespace MST
+{
+
+/**
+ * Minimum spanning forest maintained under edge updates. Tree edges are kept in a link-cut tree,
+ * so inserting an edge replaces the heaviest edge on the cycle it closes in O(log V).
+ * Removing a tree edge or making it heavier has no polylogarithmic bound: the replacement is searched
+ * among all non-tree edges, which takes O(E log V) in the worst case, like recomputing the tree.
+ * Edges with equal weights are ordered by the order of insertion
+ */
+class DynamicMst
+{
+public:
+    explicit DynamicMst(uint32_t order);
+    explicit DynamicMst(const UndirectedGraph& graph);
+
+    /**
+     * @return false for loops, non-existing vertices and already existing edges
+     */
+    bool InsertEdge(const UndirectedGraph::EdgeData& edge);
+
+    /**
+     * Removing a non-tree edge takes O(log E). Removing a tree edge looks for the lightest replacement
+     * among the non-tree edges in order of weight, which takes O(E log V) if no edge crosses the cut
+     */
+    bool DeleteEdge(UndirectedGraph::Edge edge);
+
+    /**
+     * Takes O(log V + log E) unless a tree edge becomes heavier, then the replacement is searched
+     * as in DeleteEdge in O(E log V) in the worst case
+     */
+    bool UpdateWeight(UndirectedGraph::Edge edge, Graph::Weight weight);
+
+    /**
+     * @return minimum spanning tree or empty result if the graph is disconnected
+     */
+    [[nodiscard]] Result GetMst() const;
+
+    [[nodiscard]] uint64_t GetWeight() const noexcept;
+    [[nodiscard]] uint32_t GetOrder() const noexcept;
+    [[nodiscard]] uint32_t GetNumberOfTreeEdges() const noexcept;
+    [[nodiscard]] size_t GetSize() const noexcept;
+
+private:
+    using EdgeId = uint32_t;
+
+    struct EdgeRecord
+    {
+        UndirectedGraph::EdgeData data;
+        bool isInTree;
+    };
+
+    [[nodiscard]] static uint64_t MakeVerticesKey(UndirectedGraph::Edge edge) noexcept;
+    [[nodiscard]] uint64_t MakeWeightKey(EdgeId id) const noexcept;
+    [[nodiscard]] LinkCutTree::Node GetNode(EdgeId id) const noexcept;
+
+    [[nodiscard]] EdgeId AllocateId();
+
+    /**
+     * Makes the edge a tree edge if it is lighter than the heaviest edge on the cycle it closes
+     */
+    void AddToForest(EdgeId id);
+    void LinkEdge(EdgeId id);
+    void CutEdge(EdgeId id);
+
+    /**
+     * Links the lightest non-tree edge which reconnects the forest after a tree edge was cut
+     */
+    void Replace();
+
+    uint32_t order;
+    LinkCutTree forest;
+    DynamicArray<EdgeRecord> records;
+    DynamicArray<EdgeId> freeIds;
+    uint32_t numberOfFreeIds;
+    uint32_t numberOfIds;
+
+    Map<uint64_t, EdgeId> ids;
+    RedBlackTree<uint64_t> nonTreeEdges;
+
+    uint32_t numberOfTreeEdges;
+    uint64_t weight;
+};
+
+}
\ No newline at end of file
@@ -5,9 +5,34 @@
 namespace MST::Kruskal
 {
 
-void SortEdgesByWeight(DynamicArray<UndirectedGraph::EdgeData>& edges);
+struct State
+{
+    DSU forest;
+    Result result;
+    UndirectedGraph::Vertex numberOfEdges;
+};
+
+void SortEdgesByWeight(DynamicArray<UndirectedGraph::EdgeData>::Iterator first,
+                       DynamicArray<UndirectedGraph::EdgeData>::Iterator last);
 [[nodiscard]] uint64_t CalculateOverallWeight(const Result& result);
 
+/**
+ * Sorts edges from [first, last) and adds them to the forest until the tree is complete
+ * @return true if the tree is complete
+ */
+bool AddLightestEdges(DynamicArray<UndirectedGraph::EdgeData>& edges, size_t first, size_t last, State& state);
+
+/**
+ * Partitions [first, last) around a pivot weight, processes the light part, drops edges
+ * which became internal to a component from the heavy part and processes the rest of it
+ * @return true if the tree is complete
+ */
+bool FilterKruskal(DynamicArray<UndirectedGraph::EdgeData>& edges, size_t first, size_t last, State& state);
+
+[[nodiscard]] Graph::Weight GetPivotWeight(const DynamicArray<UndirectedGraph::EdgeData>& edges, size_t first, size_t last);
+[[nodiscard]] size_t Partition(DynamicArray<UndirectedGraph::EdgeData>& edges, size_t first, size_t last, Graph::Weight pivot);
+[[nodiscard]] size_t Filter(DynamicArray<UndirectedGraph::EdgeData>& edges, size_t first, size_t last, DSU& forest);
+
 Result FindMstOf(const UndirectedGraph& graph)
 {
     if (graph.GetSize() < 1)
@@ -15,37 +40,175 @@ Result FindMstOf(const UndirectedGraph& graph)
         return {{}, 0};
     }
 
-    auto vertices = graph.GetVertices();
     auto edges = graph.GetEdges();
-    UndirectedGraph::Vertex numberOfEdges = 0;
+    State state{DSU(graph.GetOrder()), {}, 0};
+    state.result.edges.Resize(graph.GetOrder() - 1);
 
-    DSU forest(vertices);
-    Result result;
-    result.edges.Resize(graph.GetOrder() - 1);
+    if (!AddLightestEdges(edges, 0, edges.Size(), state))
+    {
+        return {{}, 0};
+    }
 
-    SortEdgesByWeight(edges);
+    state.result.weight = CalculateOverallWeight(state.result);
+    return std::move(state.result);
+}
 
-    for (const auto& edge : edges)
+Result FindMstWithFilteringOf(const UndirectedGraph& graph)
+{
+    if (graph.GetSize() < 1)
+    {
+        return {{}, 0};
+    }
+
+    auto edges = graph.GetEdges();
+    State state{DSU(graph.GetOrder()), {}, 0};
+    state.result.edges.Resize(graph.GetOrder() - 1);
+
+    if (!FilterKruskal(edges, 0, edges.Size(), state))
     {
-        if (forest.Find(edge.vertices.first) != forest.Find(edge.vertices.second))
+        return {{}, 0};
+    }
+
+    state.result.weight = CalculateOverallWeight(state.result);
+    return std::move(state.result);
+}
+
+Forest FindMsfOf(const UndirectedGraph& graph)
+{
+    const auto order = graph.GetOrder();
+    auto edges = graph.GetEdges();
+    State state{DSU(order), {}, 0};
+    state.result.edges.Resize(order > 0 ? order - 1 : 0);
+
+    AddLightestEdges(edges, 0, edges.Size(), state);
+
+    // trees get numbers in order of their smallest vertices
+    constexpr uint32_t NO_TREE = UINT32_MAX;
+    DynamicArray<uint32_t> treeOfRoot(order, NO_TREE);
+    uint32_t numberOfTrees = 0;
+    for (Graph::Vertex vertex = 0; vertex < order; vertex++)
+    {
+        auto& tree = treeOfRoot[state.forest.Find(vertex)];
+        if (tree == NO_TREE)
         {
-            forest.Union(edge.vertices.first, edge.vertices.second);
-            result.edges[numberOfEdges++] = edge;
+            tree = numberOfTrees++;
         }
-        if (numberOfEdges >= graph.GetOrder() - 1)
+    }
+
+    Forest forest{DynamicArray<Result>(numberOfTrees), 0};
+    for (auto& tree : forest.trees)
+    {
+        tree.weight = 0;
+    }
+    for (Graph::Vertex vertex = 0; vertex < order; vertex++)
+    {
+        if (state.forest.Find(vertex) == vertex)
         {
-            result.weight = CalculateOverallWeight(result);
-            return result;
+            forest.trees[treeOfRoot[vertex]].edges.Resize(state.forest.GetSizeOf(vertex) - 1);
         }
     }
 
-    return {{}, 0};
+    DynamicArray<uint32_t> treeSizes(numberOfTrees, 0);
+    for (UndirectedGraph::Vertex i = 0; i < state.numberOfEdges; i++)
+    {
+        const auto& edge = state.result.edges[i];
+        auto tree = treeOfRoot[state.forest.Find(edge.vertices.first)];
+        forest.trees[tree].edges[treeSizes[tree]++] = edge;
+        forest.trees[tree].weight += edge.weight;
+        forest.weight += edge.weight;
+    }
+
+    return forest;
+}
+
+bool AddLightestEdges(DynamicArray<UndirectedGraph::EdgeData>& edges, size_t first, size_t last, State& state)
+{
+    const auto numberOfVertices = static_cast<UndirectedGraph::Vertex>(state.result.edges.Size() + 1);
+    if (state.numberOfEdges >= numberOfVertices - 1)
+    {
+        return true;
+    }
+
+    SortEdgesByWeight(edges.begin() + static_cast<std::ptrdiff_t>(first),
+                      edges.begin() + static_cast<std::ptrdiff_t>(last));
+
+    for (size_t i = first; i < last; i++)
+    {
+        const auto& edge = edges[i];
+        if (state.forest.Union(edge.vertices.first, edge.vertices.second))
+        {
+            state.result.edges[state.numberOfEdges++] = edge;
+        }
+        if (state.numberOfEdges >= numberOfVertices - 1)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool FilterKruskal(DynamicArray<UndirectedGraph::EdgeData>& edges, size_t first, size_t last, State& state)
+{
+    if (last - first <= state.result.edges.Size() + 1)
+    {
+        return AddLightestEdges(edges, first, last, state);
+    }
+
+    auto middle = Partition(edges, first, last, GetPivotWeight(edges, first, last));
+    if (middle == last)
+    {
+        return AddLightestEdges(edges, first, last, state);
+    }
+
+    if (FilterKruskal(edges, first, middle, state))
+    {
+        return true;
+    }
+
+    return FilterKruskal(edges, middle, Filter(edges, middle, last, state.forest), state);
+}
+
+Graph::Weight GetPivotWeight(const DynamicArray<UndirectedGraph::EdgeData>& edges, size_t first, size_t last)
+{
+    auto a = edges[first].weight;
+    auto b = edges[first + (last - first) / 2].weight;
+    auto c = edges[last - 1].weight;
+
+    return Utils::Max(Utils::Min(a, b), Utils::Min(Utils::Max(a, b), c));
+}
+
+size_t Partition(DynamicArray<UndirectedGraph::EdgeData>& edges, size_t first, size_t last, Graph::Weight pivot)
+{
+    auto middle = first;
+    for (size_t i = first; i < last; i++)
+    {
+        if (edges[i].weight <= pivot)
+        {
+            Utils::Swap(edges[middle++], edges[i]);
+        }
+    }
+    return middle;
+}
+
+size_t Filter(DynamicArray<UndirectedGraph::EdgeData>& edges, size_t first, size_t last, DSU& forest)
+{
+    auto end = first;
+    for (size_t i = first; i < last; i++)
+    {
+        if (forest.Find(edges[i].vertices.first) != forest.Find(edges[i].vertices.second))
+        {
+            edges[end++] = edges[i];
+        }
+    }
+    return end;
 }
 
-void SortEdgesByWeight(DynamicArray<UndirectedGraph::EdgeData>& edges)
+void SortEdgesByWeight(DynamicArray<UndirectedGraph::EdgeData>::Iterator first,
+                       DynamicArray<UndirectedGraph::EdgeData>::Iterator last)
 {
-    Utils::QuickSort(edges.begin(),
-                     edges.end(),
+    Utils::QuickSort(first,
+                     last,
                      [](const auto& edge1, const auto& edge2)
                      {
                          return edge1.weight < edge2.weight;
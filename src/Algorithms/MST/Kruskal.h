@@ -7,4 +7,15 @@ namespace MST::Kruskal
 
 [[nodiscard]] Result FindMstOf(const UndirectedGraph& graph);
 
+/**
+ * Filter-Kruskal, edges are partitioned around a pivot weight instead of being sorted all at once.
+ * Heavy edges connecting already connected vertices are filtered out before they get sorted
+ */
+[[nodiscard]] Result FindMstWithFilteringOf(const UndirectedGraph& graph);
+
+/**
+ * Minimum spanning forest, a tree for every connected component even if the graph is disconnected
+ */
+[[nodiscard]] Forest FindMsfOf(const UndirectedGraph& graph);
+
 }
\ No newline at end of file
@@ -0,0 +1,192 @@
+#include "LinkCutTree.h"
+
+LinkCutTree::LinkCutTree(uint32_t numberOfNodes)
+    : numberOfNodes(0)
+{
+    AddNodes(numberOfNodes);
+}
+
+void LinkCutTree::AddNodes(uint32_t count)
+{
+    const uint32_t newNumberOfNodes = numberOfNodes + count;
+    if (nodes.Size() < newNumberOfNodes)
+    {
+        const auto capacity = Utils::Max(static_cast<size_t>(newNumberOfNodes), 2 * nodes.Size());
+        nodes.Resize(capacity);
+        path.Resize(capacity);
+    }
+
+    for (Node node = numberOfNodes; node < newNumberOfNodes; node++)
+    {
+        nodes[node] = {{NONE, NONE}, NONE, node, 0, false};
+    }
+    numberOfNodes = newNumberOfNodes;
+}
+
+void LinkCutTree::SetValue(Node node, uint64_t value)
+{
+    Access(node);
+    nodes[node].value = value;
+    Update(node);
+}
+
+void LinkCutTree::Link(Node u, Node v)
+{
+    MakeRoot(u);
+    nodes[u].parent = v;
+}
+
+void LinkCutTree::Cut(Node u, Node v)
+{
+    MakeRoot(u);
+    Access(v);
+
+    nodes[v].children[0] = NONE;
+    nodes[u].parent = NONE;
+    Update(v);
+}
+
+bool LinkCutTree::AreConnected(Node u, Node v)
+{
+    return u == v || FindRoot(u) == FindRoot(v);
+}
+
+LinkCutTree::Node LinkCutTree::FindPathMax(Node u, Node v)
+{
+    MakeRoot(u);
+    Access(v);
+    return nodes[v].maxNode;
+}
+
+uint32_t LinkCutTree::GetNumberOfNodes() const noexcept
+{
+    return numberOfNodes;
+}
+
+bool LinkCutTree::IsSplayRoot(Node node) const noexcept
+{
+    const auto parent = nodes[node].parent;
+    return parent == NONE || (nodes[parent].children[0] != node && nodes[parent].children[1] != node);
+}
+
+bool LinkCutTree::GoesBefore(Node lhs, Node rhs) const noexcept
+{
+    return nodes[lhs].value < nodes[rhs].value || (nodes[lhs].value == nodes[rhs].value && lhs < rhs);
+}
+
+void LinkCutTree::Push(Node node) noexcept
+{
+    auto& data = nodes[node];
+    if (!data.isReversed)
+    {
+        return;
+    }
+
+    Utils::Swap(data.children[0], data.children[1]);
+    for (auto child : data.children)
+    {
+        if (child != NONE)
+        {
+            nodes[child].isReversed = !nodes[child].isReversed;
+        }
+    }
+    data.isReversed = false;
+}
+
+void LinkCutTree::Update(Node node) noexcept
+{
+    auto& data = nodes[node];
+    data.maxNode = node;
+    for (auto child : data.children)
+    {
+        if (child != NONE && GoesBefore(data.maxNode, nodes[child].maxNode))
+        {
+            data.maxNode = nodes[child].maxNode;
+        }
+    }
+}
+
+void LinkCutTree::Rotate(Node node) noexcept
+{
+    const auto parent = nodes[node].parent;
+    const auto grandparent = nodes[parent].parent;
+    const auto side = nodes[parent].children[1] == node ? 1 : 0;
+
+    if (!IsSplayRoot(parent))
+    {
+        nodes[grandparent].children[nodes[grandparent].children[1] == parent ? 1 : 0] = node;
+    }
+    nodes[node].parent = grandparent;
+
+    const auto child = nodes[node].children[1 - side];
+    nodes[parent].children[side] = child;
+    if (child != NONE)
+    {
+        nodes[child].parent = parent;
+    }
+
+    nodes[node].children[1 - side] = parent;
+    nodes[parent].parent = node;
+
+    Update(parent);
+    Update(node);
+}
+
+void LinkCutTree::Splay(Node node)
+{
+    // lazy reversals have to be pushed from the top of the splay tree down to the node
+    size_t depth = 0;
+    path[depth++] = node;
+    for (auto current = node; !IsSplayRoot(current); current = nodes[current].parent)
+    {
+        path[depth++] = nodes[current].parent;
+    }
+    while (depth > 0)
+    {
+        Push(path[--depth]);
+    }
+
+    while (!IsSplayRoot(node))
+    {
+        const auto parent = nodes[node].parent;
+        if (!IsSplayRoot(parent))
+        {
+            const auto grandparent = nodes[parent].parent;
+            const bool isZigZig = (nodes[parent].children[0] == node) == (nodes[grandparent].children[0] == parent);
+            Rotate(isZigZig ? parent : node);
+        }
+        Rotate(node);
+    }
+}
+
+void LinkCutTree::Access(Node node)
+{
+    Node last = NONE;
+    for (auto current = node; current != NONE; current = nodes[current].parent)
+    {
+        Splay(current);
+        nodes[current].children[1] = last;
+        Update(current);
+        last = current;
+    }
+    Splay(node);
+}
+
+void LinkCutTree::MakeRoot(Node node)
+{
+    Access(node);
+    nodes[node].isReversed = !nodes[node].isReversed;
+}
+
+LinkCutTree::Node LinkCutTree::FindRoot(Node node)
+{
+    Access(node);
+    Push(node);
+    while (nodes[node].children[0] != NONE)
+    {
+        node = nodes[node].children[0];
+        Push(node);
+    }
+    Splay(node);
+    return node;
+}
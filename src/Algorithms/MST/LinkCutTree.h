@@ -0,0 +1,69 @@
+#pragma once
+
+#include "Containers/DynamicArray.h"
+
+/**
+ * Forest of rooted trees stored as splay trees of preferred paths.
+ * Every node has a value and the node with the maximal value on a path can be found in amortized O(log n)
+ */
+class LinkCutTree
+{
+public:
+    using Node = uint32_t;
+
+    explicit LinkCutTree(uint32_t numberOfNodes);
+
+    /**
+     * Appends count separate nodes with value 0
+     */
+    void AddNodes(uint32_t count);
+
+    void SetValue(Node node, uint64_t value);
+
+    /**
+     * Connects nodes from different trees
+     */
+    void Link(Node u, Node v);
+
+    /**
+     * Removes an existing edge between u and v
+     */
+    void Cut(Node u, Node v);
+
+    [[nodiscard]] bool AreConnected(Node u, Node v);
+
+    /**
+     * Ties are broken in favour of the node with the bigger index
+     * @return node with the maximal value on the path between connected nodes u and v
+     */
+    [[nodiscard]] Node FindPathMax(Node u, Node v);
+
+    [[nodiscard]] uint32_t GetNumberOfNodes() const noexcept;
+
+private:
+    static constexpr Node NONE = UINT32_MAX;
+
+    struct Data
+    {
+        Node children[2];
+        Node parent;
+        Node maxNode;
+        uint64_t value;
+        bool isReversed;
+    };
+
+    [[nodiscard]] bool IsSplayRoot(Node node) const noexcept;
+    [[nodiscard]] bool GoesBefore(Node lhs, Node rhs) const noexcept;
+
+    void Push(Node node) noexcept;
+    void Update(Node node) noexcept;
+    void Rotate(Node node) noexcept;
+    void Splay(Node node);
+    void Access(Node node);
+    void MakeRoot(Node node);
+    [[nodiscard]] Node FindRoot(Node node);
+
+    DynamicArray<Data> nodes;
+    DynamicArray<Node> path;
+    uint32_t numberOfNodes;
+};
\ No newline at end of file
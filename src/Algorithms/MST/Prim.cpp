@@ -1,4 +1,9 @@
 #include "Prim.h"
+#include "Algorithms/Graphs/UndirectedGraphs/ListGraph.h"
+#include "Algorithms/Graphs/UndirectedGraphs/MatrixGraph.h"
+#include "Containers/IndexedHeap.h"
+
+#include <cmath>
 
 namespace MST::Prim
 {
@@ -6,6 +11,31 @@ namespace MST::Prim
 constexpr uint32_t INFINITY_PRIORITY = UINT32_MAX;
 constexpr Graph::Vertex NO_VERTEX = UINT32_MAX;
 
+struct TreeGrowth
+{
+    explicit TreeGrowth(uint32_t order)
+        : priorities(order, INFINITY_PRIORITY)
+        , parents(order, NO_VERTEX)
+        , usedFlags(order, false)
+        , heap(order)
+        , visitOrder(order)
+        , numberOfVisited(0)
+    { }
+
+    DynamicArray<uint32_t> priorities;
+    DynamicArray<Graph::Vertex> parents;
+    DynamicArray<bool> usedFlags;
+    IndexedHeap<uint32_t> heap;
+    DynamicArray<Graph::Vertex> visitOrder;
+    uint32_t numberOfVisited;
+};
+
+/**
+ * Heap based Prim's algorithm run from the root until its whole component is in the tree
+ */
+template<typename T>
+void GrowTree(const T& graph, Graph::Vertex root, TreeGrowth& growth);
+
 Graph::Vertex GetMinimalVertex(const DynamicArray<uint32_t>& priorities, const DynamicArray<bool>& usedFlags)
 {
     Graph::Vertex minimalVertex = NO_VERTEX;
@@ -22,40 +52,62 @@ Graph::Vertex GetMinimalVertex(const DynamicArray<uint32_t>& priorities, const D
     return minimalVertex;
 }
 
-Result GetMst(const UndirectedGraph& graph, const DynamicArray<Graph::Vertex>& parents)
+/**
+ * Priority of a vertex is the weight of the edge to its parent, so no weight lookup is needed
+ */
+Result GetMst(uint32_t order, const DynamicArray<Graph::Vertex>& parents, const DynamicArray<uint32_t>& priorities)
 {
     Result result;
     result.weight = 0;
-    result.edges.Resize(graph.GetOrder() - 1);
-    for (Graph::Vertex i = 1; i < graph.GetOrder(); i++)
+    result.edges.Resize(order - 1);
+    for (Graph::Vertex i = 1; i < order; i++)
     {
         if (parents[i] == NO_VERTEX)
         {
             return {{}, 0};
         }
-        UndirectedGraph::Edge edge = {parents[i], i};
-        Graph::Weight weight = graph.GetWeight(edge).value();
-        result.edges[i - 1] = {edge, weight};
-        result.weight += weight;
+        result.edges[i - 1] = {{parents[i], i}, priorities[i]};
+        result.weight += priorities[i];
     }
     return result;
 }
 
+/**
+ * Heap variant does O(E log V) work and array variant O(V^2),
+ * with density d = 2E / V^2 the array is cheaper when d * log2(V) >= 2
+ */
+bool IsDense(const UndirectedGraph& graph)
+{
+    return graph.GetDensity() * std::log2(static_cast<float>(graph.GetOrder())) >= 2.0f;
+}
+
 Result FindMstOf(const UndirectedGraph& graph)
+{
+    return FindMstOf<UndirectedGraph>(graph);
+}
+
+template<typename T, UndirectedGraph::isUndirectedGraph<T>>
+Result FindMstOf(const T& graph)
 {
     if (graph.GetSize() < 1)
     {
         return {{}, 0};
     }
 
-    DynamicArray<uint32_t> priorities(graph.GetOrder());
-    DynamicArray<Graph::Vertex> parents(graph.GetOrder());
-    DynamicArray<bool> usedFlags(graph.GetOrder(), false);
+    return IsDense(graph) ? FindMstWithArrayOf(graph) : FindMstWithHeapOf(graph);
+}
+
+template<typename T, UndirectedGraph::isUndirectedGraph<T>>
+Result FindMstWithArrayOf(const T& graph)
+{
+    if (graph.GetSize() < 1)
+    {
+        return {{}, 0};
+    }
 
-    graph.ForEachVertex([&priorities, &parents](Graph::Vertex vertex){
-       priorities[vertex] = INFINITY_PRIORITY;
-       parents[vertex] = NO_VERTEX;
-    });
+    DynamicArray<uint32_t> priorities(graph.GetOrder(), INFINITY_PRIORITY);
+    DynamicArray<Graph::Vertex> parents(graph.GetOrder(), NO_VERTEX);
+    DynamicArray<bool> usedFlags(graph.GetOrder(), false);
 
     priorities[0] = 0;
 
@@ -68,7 +120,7 @@ Result FindMstOf(const UndirectedGraph& graph)
         }
         usedFlags[vertex] = true;
 
-        graph.ForEachNeighbourOf(vertex, [&usedFlags, &priorities, &parents, vertex](Graph::Neighbour neighbour) {
+        graph.VisitNeighboursOf(vertex, [&usedFlags, &priorities, &parents, vertex](Graph::Neighbour neighbour) {
             if (usedFlags[neighbour.vertex] == false && neighbour.weight < priorities[neighbour.vertex])
             {
                 parents[neighbour.vertex] = vertex;
@@ -77,7 +129,120 @@ Result FindMstOf(const UndirectedGraph& graph)
         });
     }
 
-    return GetMst(graph, parents);
+    return GetMst(graph.GetOrder(), parents, priorities);
+}
+
+template<typename T, UndirectedGraph::isUndirectedGraph<T>>
+Result FindMstWithHeapOf(const T& graph)
+{
+    if (graph.GetSize() < 1)
+    {
+        return {{}, 0};
+    }
+
+    TreeGrowth growth(graph.GetOrder());
+    GrowTree(graph, 0, growth);
+
+    return GetMst(graph.GetOrder(), growth.parents, growth.priorities);
 }
 
+template<typename T, UndirectedGraph::isUndirectedGraph<T>>
+Forest FindMsfOf(const T& graph)
+{
+    const auto order = graph.GetOrder();
+    TreeGrowth growth(order);
+    DynamicArray<uint32_t> treeBegins(static_cast<size_t>(order) + 1);
+    uint32_t numberOfTrees = 0;
+
+    for (Graph::Vertex vertex = 0; vertex < order; vertex++)
+    {
+        if (growth.usedFlags[vertex] == false)
+        {
+            treeBegins[numberOfTrees++] = growth.numberOfVisited;
+            GrowTree(graph, vertex, growth);
+        }
+    }
+    treeBegins[numberOfTrees] = growth.numberOfVisited;
+
+    Forest forest{DynamicArray<Result>(numberOfTrees), 0};
+    for (uint32_t i = 0; i < numberOfTrees; i++)
+    {
+        auto& tree = forest.trees[i];
+        tree.weight = 0;
+        tree.edges.Resize(treeBegins[i + 1] - treeBegins[i] - 1);
+
+        for (uint32_t j = treeBegins[i] + 1; j < treeBegins[i + 1]; j++)
+        {
+            auto vertex = growth.visitOrder[j];
+            tree.edges[j - treeBegins[i] - 1] = {{growth.parents[vertex], vertex}, growth.priorities[vertex]};
+            tree.weight += growth.priorities[vertex];
+        }
+        forest.weight += tree.weight;
+    }
+
+    return forest;
+}
+
+template<typename T>
+void GrowTree(const T& graph, Graph::Vertex root, TreeGrowth& growth)
+{
+    auto& [priorities, parents, usedFlags, heap, visitOrder, numberOfVisited] = growth;
+
+    priorities[root] = 0;
+    heap.Push(root, 0);
+
+    while (!heap.IsEmpty())
+    {
+        auto vertex = heap.Top();
+        heap.Pop();
+        usedFlags[vertex] = true;
+        visitOrder[numberOfVisited++] = vertex;
+
+        graph.VisitNeighboursOf(vertex, [&usedFlags, &priorities, &parents, &heap, vertex](Graph::Neighbour neighbour) {
+            if (usedFlags[neighbour.vertex] == false && neighbour.weight < priorities[neighbour.vertex])
+            {
+                parents[neighbour.vertex] = vertex;
+                priorities[neighbour.vertex] = neighbour.weight;
+                heap.Push(neighbour.vertex, neighbour.weight);
+            }
+        });
+    }
+}
+
+template
+Result FindMstOf<UndirectedGraph, true>(const UndirectedGraph& graph);
+
+template
+Result FindMstOf<ListGraph, true>(const ListGraph& graph);
+
+template
+Result FindMstOf<MatrixGraph, true>(const MatrixGraph& graph);
+
+template
+Result FindMstWithArrayOf<UndirectedGraph, true>(const UndirectedGraph& graph);
+
+template
+Result FindMstWithArrayOf<ListGraph, true>(const ListGraph& graph);
+
+template
+Result FindMstWithArrayOf<MatrixGraph, true>(const MatrixGraph& graph);
+
+template
+Result FindMstWithHeapOf<UndirectedGraph, true>(const UndirectedGraph& graph);
+
+template
+Result FindMstWithHeapOf<ListGraph, true>(const ListGraph& graph);
+
+template
+Result FindMstWithHeapOf<MatrixGraph, true>(const MatrixGraph& graph);
+
+template
+Forest FindMsfOf<UndirectedGraph, true>(const UndirectedGraph& graph);
+
+template
+Forest FindMsfOf<ListGraph, true>(const ListGraph& graph);
+
+template
+Forest FindMsfOf<MatrixGraph, true>(const MatrixGraph& graph);
+
 }
@@ -7,4 +7,30 @@ namespace MST::Prim
 
 [[nodiscard]] Result FindMstOf(const UndirectedGraph& graph);
 
+/**
+ * Statically dispatched variant. Instantiated for ListGraph and MatrixGraph,
+ * so neighbours are visited without a virtual call per edge.
+ * Chooses FindMstWithArrayOf for dense graphs and FindMstWithHeapOf for sparse ones
+ */
+template<typename T, UndirectedGraph::isUndirectedGraph<T> = true>
+[[nodiscard]] Result FindMstOf(const T& graph);
+
+/**
+ * O(V^2) variant, the next vertex is found with a linear scan
+ */
+template<typename T, UndirectedGraph::isUndirectedGraph<T> = true>
+[[nodiscard]] Result FindMstWithArrayOf(const T& graph);
+
+/**
+ * O(E log V) variant, the next vertex is taken from IndexedHeap
+ */
+template<typename T, UndirectedGraph::isUndirectedGraph<T> = true>
+[[nodiscard]] Result FindMstWithHeapOf(const T& graph);
+
+/**
+ * Minimum spanning forest, the heap variant is restarted from the smallest vertex not reached yet
+ */
+template<typename T, UndirectedGraph::isUndirectedGraph<T> = true>
+[[nodiscard]] Forest FindMsfOf(const T& graph);
+
 }
\ No newline at end of file
@@ -10,5 +10,17 @@ std::ostream& operator<<(std::ostream& os, const MST::Result& result)
         os << "Krawędź { " << edge.vertices.first << ", " << edge.vertices.second << "}, Waga: " << edge.weight << "\n";
     }
 
+    return os;
+}
+
+std::ostream& operator<<(std::ostream& os, const MST::Forest& forest)
+{
+    os << "Waga lasu: " << forest.weight << "\n";
+
+    for (size_t i = 0; i < forest.trees.Size(); i++)
+    {
+        os << "Drzewo " << i << ":\n" << forest.trees[i];
+    }
+
     return os;
 }
\ No newline at end of file
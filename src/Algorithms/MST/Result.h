@@ -11,6 +11,17 @@ struct Result
     uint64_t weight;
 };
 
+/**
+ * Minimum spanning forest, one tree per connected component ordered by the smallest vertex of the component.
+ * Isolated vertices give trees without edges
+ */
+struct Forest
+{
+    DynamicArray<Result> trees;
+    uint64_t weight;
+};
+
 }
 
-std::ostream& operator<<(std::ostream& os, const MST::Result& result);
\ No newline at end of file
+std::ostream& operator<<(std::ostream& os, const MST::Result& result);
+std::ostream& operator<<(std::ostream& os, const MST::Forest& forest);
\ No newline at end of file
@@ -1,46 +1,53 @@
 #include "BellmanFord.h"
+#include "Algorithms/Graphs/DirectedGraphs/DirectedListGraph.h"
+#include "Algorithms/Graphs/DirectedGraphs/DirectedMatrixGraph.h"
 
 namespace ShortestPath::BellmanFord
 {
 
-constexpr uint64_t INFINITY_DISTANCE = UINT64_MAX;
-constexpr Graph::Vertex NO_VERTEX = UINT32_MAX;
+constexpr uint64_t INFINITY_DISTANCE = ShortestPathTree::INFINITY_DISTANCE;
+constexpr Graph::Vertex NO_VERTEX = ShortestPathTree::NO_VERTEX;
 
-DynamicArray<Graph::Vertex> GetShortestPath(const DynamicArray<Graph::Vertex>& parents,
-                                            Graph::Vertex from,
-                                            Graph::Vertex to)
+Result FindShortestPath(const DirectedGraph& graph, Graph::Vertex from, Graph::Vertex to)
 {
-    DynamicArray<Graph::Vertex> path;
-    while (from != to)
-    {
-        path.PushFront(to);
-        to = parents[to];
-    }
-    path.PushFront(to);
-    return path;
+    return FindShortestPath<DirectedGraph>(graph, from, to);
 }
 
-Result FindShortestPath(const DirectedGraph& graph, Graph::Vertex from, Graph::Vertex to)
+template<typename T, DirectedGraph::isDirectedGraph<T>>
+Result FindShortestPath(const T& graph, Graph::Vertex from, Graph::Vertex to)
 {
     if (!graph.DoesExist(from) || !graph.DoesExist(to))
     {
         return {{}, 0};
     }
-    Result result;
 
-    DynamicArray<uint64_t> distances(graph.GetOrder());
-    DynamicArray<Graph::Vertex> parents(graph.GetOrder());
+    auto tree = FindShortestPathTree(graph, from);
+    if (!tree.has_value())
+    {
+        return {{}, 0};
+    }
+
+    return tree->GetPathTo(to);
+}
 
-    graph.ForEachVertex([&distances, &parents](Graph::Vertex vertex){
-        distances[vertex] = INFINITY_DISTANCE;
-        parents[vertex] = NO_VERTEX;
-    });
+template<typename T, DirectedGraph::isDirectedGraph<T>>
+std::optional<ShortestPathTree> FindShortestPathTree(const T& graph, Graph::Vertex from)
+{
+    ShortestPathTree tree{from,
+                          DynamicArray<uint64_t>(graph.GetOrder(), INFINITY_DISTANCE),
+                          DynamicArray<Graph::Vertex>(graph.GetOrder(), NO_VERTEX)};
+    if (!graph.DoesExist(from))
+    {
+        return tree;
+    }
 
+    auto& distances = tree.distances;
+    auto& parents = tree.parents;
     distances[from] = 0;
 
     for (uint32_t i = 0; i < graph.GetOrder() - 1; i++)
     {
-        graph.ForEachDirectedEdge([&distances, &parents](const DirectedGraph::DirectedEdgeData& edge) {
+        graph.VisitDirectedEdges([&distances, &parents](const DirectedGraph::DirectedEdgeData& edge) {
             if (distances[edge.vertices.second] > Utils::SaturatingAdd<uint64_t>(distances[edge.vertices.first], edge.weight))
             {
                 distances[edge.vertices.second] = Utils::SaturatingAdd<uint64_t>(distances[edge.vertices.first], edge.weight);
@@ -51,19 +58,39 @@ Result FindShortestPath(const DirectedGraph& graph, Graph::Vertex from, Graph::V
 
     bool fail = false;
 
-    graph.ForEachDirectedEdge([&distances, &fail](const DirectedGraph::DirectedEdgeData& edge) {
+    graph.VisitDirectedEdges([&distances, &fail](const DirectedGraph::DirectedEdgeData& edge) {
         if (distances[edge.vertices.second] > Utils::SaturatingAdd<uint64_t>(distances[edge.vertices.first], edge.weight))
         {
             fail = true;
         }
     });
 
-    if (fail || distances[to] == INFINITY_DISTANCE)
+    if (fail)
     {
-        return {{}, 0};
+        return {};
     }
 
-    return {GetShortestPath(parents, from, to), distances[to]};
+    return tree;
 }
 
+template
+Result FindShortestPath<DirectedGraph, true>(const DirectedGraph& graph, Graph::Vertex from, Graph::Vertex to);
+
+template
+Result FindShortestPath<DirectedListGraph, true>(const DirectedListGraph& graph, Graph::Vertex from, Graph::Vertex to);
+
+template
+Result FindShortestPath<DirectedMatrixGraph, true>(const DirectedMatrixGraph& graph, Graph::Vertex from, Graph::Vertex to);
+
+template
+std::optional<ShortestPathTree> FindShortestPathTree<DirectedGraph, true>(const DirectedGraph& graph, Graph::Vertex from);
+
+template
+std::optional<ShortestPathTree>
+FindShortestPathTree<DirectedListGraph, true>(const DirectedListGraph& graph, Graph::Vertex from);
+
+template
+std::optional<ShortestPathTree>
+FindShortestPathTree<DirectedMatrixGraph, true>(const DirectedMatrixGraph& graph, Graph::Vertex from);
+
 }
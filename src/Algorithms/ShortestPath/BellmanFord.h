@@ -8,4 +8,18 @@ namespace ShortestPath::BellmanFord
 
 Result FindShortestPath(const DirectedGraph& graph, Graph::Vertex from, Graph::Vertex to);
 
+/**
+ * Statically dispatched variant. Instantiated for DirectedListGraph and DirectedMatrixGraph,
+ * so neighbours are visited without a virtual call per edge
+ */
+template<typename T, DirectedGraph::isDirectedGraph<T> = true>
+Result FindShortestPath(const T& graph, Graph::Vertex from, Graph::Vertex to);
+
+/**
+ * Shortest paths from the source to all vertices
+ * @return tree or std::nullopt if a cycle with negative weight can be reached from the source
+ */
+template<typename T, DirectedGraph::isDirectedGraph<T> = true>
+[[nodiscard]] std::optional<ShortestPathTree> FindShortestPathTree(const T& graph, Graph::Vertex from);
+
 }
\ No newline at end of file
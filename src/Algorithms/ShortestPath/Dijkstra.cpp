@@ -1,4 +1,6 @@
 #include "Dijkstra.h"
+#include "Algorithms/Graphs/DirectedGraphs/DirectedListGraph.h"
+#include "Algorithms/Graphs/DirectedGraphs/DirectedMatrixGraph.h"
 
 namespace ShortestPath::Dijkstra
 {
@@ -37,6 +39,12 @@ DynamicArray<Graph::Vertex> GetShortestPath(const DynamicArray<Graph::Vertex>& p
 }
 
 Result FindShortestPath(const DirectedGraph& graph, Graph::Vertex from, Graph::Vertex to)
+{
+    return FindShortestPath<DirectedGraph>(graph, from, to);
+}
+
+template<typename T, DirectedGraph::isDirectedGraph<T>>
+Result FindShortestPath(const T& graph, Graph::Vertex from, Graph::Vertex to)
 {
     if (!graph.DoesExist(from) || !graph.DoesExist(to))
     {
@@ -49,7 +57,7 @@ Result FindShortestPath(const DirectedGraph& graph, Graph::Vertex from, Graph::V
     DynamicArray<Graph::Vertex> parents(graph.GetOrder());
     DynamicArray<bool> usedFlags(graph.GetOrder(), false);
 
-    graph.ForEachVertex([&distances, &parents](Graph::Vertex vertex){
+    graph.VisitVertices([&distances, &parents](Graph::Vertex vertex){
         distances[vertex] = INFINITY_DISTANCE;
         parents[vertex] = NO_VERTEX;
     });
@@ -65,7 +73,7 @@ Result FindShortestPath(const DirectedGraph& graph, Graph::Vertex from, Graph::V
         }
         usedFlags[vertex] = true;
 
-        graph.ForEachNeighbourOf(vertex, [&distances, &parents, vertex](Graph::Neighbour neighbour) {
+        graph.VisitNeighboursOf(vertex, [&distances, &parents, vertex](Graph::Neighbour neighbour) {
             if (distances[neighbour.vertex] > Utils::SaturatingAdd<uint64_t>(distances[vertex], neighbour.weight))
             {
                 distances[neighbour.vertex] = Utils::SaturatingAdd<uint64_t>(distances[vertex], neighbour.weight);
@@ -82,4 +90,102 @@ Result FindShortestPath(const DirectedGraph& graph, Graph::Vertex from, Graph::V
     return {GetShortestPath(parents, from, to), distances[to]};
 }
 
+/**
+ * Dijkstra's algorithm with a binary heap, onImprove(vertex, parent) is called whenever a shorter path is found
+ */
+template<typename T, typename F>
+void RunWithHeap(const T& graph, Graph::Vertex from, IndexedHeap<uint64_t>& heap, uint64_t* distances, F&& onImprove)
+{
+    for (Graph::Vertex i = 0; i < graph.GetOrder(); i++)
+    {
+        distances[i] = INFINITY_DISTANCE;
+    }
+    if (!graph.DoesExist(from))
+    {
+        return;
+    }
+
+    heap.Clear();
+    distances[from] = 0;
+    heap.Push(from, 0);
+
+    while (!heap.IsEmpty())
+    {
+        const auto vertex = heap.Top();
+        const auto distance = heap.TopPriority();
+        heap.Pop();
+
+        graph.VisitNeighboursOf(vertex, [&heap, &onImprove, distances, distance, vertex](Graph::Neighbour neighbour) {
+            const auto newDistance = Utils::SaturatingAdd<uint64_t>(distance, neighbour.weight);
+            if (newDistance < distances[neighbour.vertex])
+            {
+                distances[neighbour.vertex] = newDistance;
+                heap.Push(neighbour.vertex, newDistance);
+                onImprove(neighbour.vertex, vertex);
+            }
+        });
+    }
+}
+
+template<typename T, DirectedGraph::isDirectedGraph<T>>
+void FindDistancesFrom(const T& graph, Graph::Vertex from, IndexedHeap<uint64_t>& heap, uint64_t* distances)
+{
+    RunWithHeap(graph, from, heap, distances, [](Graph::Vertex, Graph::Vertex) {});
+}
+
+template<typename T, DirectedGraph::isDirectedGraph<T>>
+ShortestPathTree FindShortestPathTree(const T& graph, Graph::Vertex from)
+{
+    ShortestPathTree tree{from,
+                          DynamicArray<uint64_t>(graph.GetOrder()),
+                          DynamicArray<Graph::Vertex>(graph.GetOrder(), NO_VERTEX)};
+    if (graph.GetOrder() == 0)
+    {
+        return tree;
+    }
+
+    IndexedHeap<uint64_t> heap(graph.GetOrder());
+    RunWithHeap(graph, from, heap, &tree.distances[0], [&tree](Graph::Vertex vertex, Graph::Vertex parent) {
+        tree.parents[vertex] = parent;
+    });
+
+    return tree;
+}
+
+template
+Result FindShortestPath<DirectedGraph, true>(const DirectedGraph& graph, Graph::Vertex from, Graph::Vertex to);
+
+template
+Result FindShortestPath<DirectedListGraph, true>(const DirectedListGraph& graph, Graph::Vertex from, Graph::Vertex to);
+
+template
+Result FindShortestPath<DirectedMatrixGraph, true>(const DirectedMatrixGraph& graph, Graph::Vertex from, Graph::Vertex to);
+
+template
+ShortestPathTree FindShortestPathTree<DirectedGraph, true>(const DirectedGraph& graph, Graph::Vertex from);
+
+template
+ShortestPathTree FindShortestPathTree<DirectedListGraph, true>(const DirectedListGraph& graph, Graph::Vertex from);
+
+template
+ShortestPathTree FindShortestPathTree<DirectedMatrixGraph, true>(const DirectedMatrixGraph& graph, Graph::Vertex from);
+
+template
+void FindDistancesFrom<DirectedGraph, true>(const DirectedGraph& graph,
+                                            Graph::Vertex from,
+                                            IndexedHeap<uint64_t>& heap,
+                                            uint64_t* distances);
+
+template
+void FindDistancesFrom<DirectedListGraph, true>(const DirectedListGraph& graph,
+                                                Graph::Vertex from,
+                                                IndexedHeap<uint64_t>& heap,
+                                                uint64_t* distances);
+
+template
+void FindDistancesFrom<DirectedMatrixGraph, true>(const DirectedMatrixGraph& graph,
+                                                  Graph::Vertex from,
+                                                  IndexedHeap<uint64_t>& heap,
+                                                  uint64_t* distances);
+
 }
@@ -2,10 +2,32 @@
 
 #include "Result.h"
 #include "Algorithms/Graphs/DirectedGraphs/DirectedGraph.h"
+#include "Containers/IndexedHeap.h"
 
 namespace ShortestPath::Dijkstra
 {
 
 Result FindShortestPath(const DirectedGraph& graph, Graph::Vertex from, Graph::Vertex to);
 
+/**
+ * Statically dispatched variant. Instantiated for DirectedListGraph and DirectedMatrixGraph,
+ * so neighbours are visited without a virtual call per edge
+ */
+template<typename T, DirectedGraph::isDirectedGraph<T> = true>
+Result FindShortestPath(const T& graph, Graph::Vertex from, Graph::Vertex to);
+
+/**
+ * Writes distances from the source to every vertex into distances[0..order), UINT64_MAX for unreachable ones.
+ * Vertices are taken from the heap, so it runs in O((V + E) log V). The heap, with capacity of at least
+ * the order of the graph, can be reused between calls
+ */
+template<typename T, DirectedGraph::isDirectedGraph<T> = true>
+void FindDistancesFrom(const T& graph, Graph::Vertex from, IndexedHeap<uint64_t>& heap, uint64_t* distances);
+
+/**
+ * Shortest paths from the source to all vertices, computed like FindDistancesFrom
+ */
+template<typename T, DirectedGraph::isDirectedGraph<T> = true>
+[[nodiscard]] ShortestPathTree FindShortestPathTree(const T& graph, Graph::Vertex from);
+
 }
\ No newline at end of file
@@ -0,0 +1,49 @@
+#include "Johnson.h"
+#include "Dijkstra.h"
+#include "Algorithms/Graphs/DirectedGraphs/DirectedListGraph.h"
+#include "Algorithms/Graphs/DirectedGraphs/DirectedMatrixGraph.h"
+
+#include <atomic>
+
+namespace ShortestPath::Johnson
+{
+
+uint64_t DistanceMatrix::GetDistance(Graph::Vertex from, Graph::Vertex to) const
+{
+    return distances[static_cast<size_t>(from) * order + to];
+}
+
+template<typename T, DirectedGraph::isDirectedGraph<T>>
+DistanceMatrix AllPairs(const T& graph, uint32_t numberOfThreads)
+{
+    const auto order = graph.GetOrder();
+    DistanceMatrix result{DynamicArray<uint64_t>(static_cast<size_t>(order) * order), order};
+    if (order == 0)
+    {
+        return result;
+    }
+
+    std::atomic<Graph::Vertex> nextSource = 0;
+    Utils::ParallelFor(Utils::Min(Utils::Max(numberOfThreads, 1u), order), [&graph, &result, &nextSource, order](uint32_t) {
+        IndexedHeap<uint64_t> heap(order);
+        for (auto source = nextSource.fetch_add(1, std::memory_order_relaxed);
+             source < order;
+             source = nextSource.fetch_add(1, std::memory_order_relaxed))
+        {
+            Dijkstra::FindDistancesFrom(graph, source, heap, &result.distances[static_cast<size_t>(source) * order]);
+        }
+    });
+
+    return result;
+}
+
+template
+DistanceMatrix AllPairs<DirectedGraph, true>(const DirectedGraph& graph, uint32_t numberOfThreads);
+
+template
+DistanceMatrix AllPairs<DirectedListGraph, true>(const DirectedListGraph& graph, uint32_t numberOfThreads);
+
+template
+DistanceMatrix AllPairs<DirectedMatrixGraph, true>(const DirectedMatrixGraph& graph, uint32_t numberOfThreads);
+
+}
\ No newline at end of file
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Algorithms/Graphs/DirectedGraphs/DirectedGraph.h"
+#include "Utils/Parallel.h"
+
+namespace ShortestPath::Johnson
+{
+
+/**
+ * Distances between all pairs of vertices stored row by row in one array
+ */
+struct DistanceMatrix
+{
+    static constexpr uint64_t UNREACHABLE = UINT64_MAX;
+
+    [[nodiscard]] uint64_t GetDistance(Graph::Vertex from, Graph::Vertex to) const;
+
+    DynamicArray<uint64_t> distances;
+    uint32_t order;
+};
+
+/**
+ * Johnson's algorithm, Dijkstra's algorithm with a binary heap from every vertex, O(V (V + E) log V).
+ * Weights are unsigned, so the Bellman-Ford reweighting would give zero potentials and is skipped.
+ * Sources are handed out to the threads one by one and every run writes its own row of the matrix
+ */
+template<typename T, DirectedGraph::isDirectedGraph<T> = true>
+[[nodiscard]] DistanceMatrix AllPairs(const T& graph, uint32_t numberOfThreads = Utils::GetNumberOfThreads());
+
+}
\ No newline at end of file
@@ -1,5 +1,27 @@
 #include "Result.h"
 
+ShortestPath::Result ShortestPath::ShortestPathTree::GetPathTo(Graph::Vertex to) const
+{
+    if (to >= distances.Size() || distances[to] == INFINITY_DISTANCE)
+    {
+        return {{}, 0};
+    }
+
+    size_t length = 1;
+    for (auto vertex = to; vertex != source; vertex = parents[vertex])
+    {
+        length++;
+    }
+
+    DynamicArray<Graph::Vertex> path(length);
+    for (auto vertex = to; length > 0; vertex = parents[vertex])
+    {
+        path[--length] = vertex;
+    }
+
+    return {path, distances[to]};
+}
+
 std::ostream& operator<<(std::ostream& os, const ShortestPath::Result& result)
 {
     os << "Waga ścieżki: " << result.weight << "\n";
@@ -11,6 +11,24 @@ struct Result
     uint64_t weight;
 };
 
+/**
+ * Distances from the source and parents on the shortest paths of all vertices
+ */
+struct ShortestPathTree
+{
+    static constexpr uint64_t INFINITY_DISTANCE = UINT64_MAX;
+    static constexpr Graph::Vertex NO_VERTEX = UINT32_MAX;
+
+    /**
+     * @return path from the source or an empty result if the vertex cannot be reached
+     */
+    [[nodiscard]] Result GetPathTo(Graph::Vertex to) const;
+
+    Graph::Vertex source;
+    DynamicArray<uint64_t> distances;
+    DynamicArray<Graph::Vertex> parents;
+};
+
 }
 
 std::ostream& operator<<(std::ostream& os, const ShortestPath::Result& result);
\ No newline at end of file
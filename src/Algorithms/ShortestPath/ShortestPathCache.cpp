@@ -0,0 +1,135 @@
+#include "ShortestPathCache.h"
+#include "BellmanFord.h"
+#include "Dijkstra.h"
+
+namespace ShortestPath
+{
+
+ShortestPathCache::ShortestPathCache(const DirectedGraph& graph, size_t memoryBudget, Algorithm algorithm)
+    : graph(graph)
+    , memoryBudget(memoryBudget)
+    , algorithm(algorithm)
+    , graphVersion(graph.GetVersion())
+    , clock(0)
+    , hits(0)
+    , misses(0)
+    , numberOfEntries(0)
+{
+    Clear();
+}
+
+Result ShortestPathCache::FindShortestPath(Graph::Vertex from, Graph::Vertex to)
+{
+    Validate();
+
+    if (!graph.DoesExist(from) || !graph.DoesExist(to))
+    {
+        return {{}, 0};
+    }
+
+    clock++;
+    if (entryOfSource[from] != NO_ENTRY)
+    {
+        hits++;
+        auto& entry = entries[entryOfSource[from]];
+        entry.lastUse = clock;
+        return entry.tree.GetPathTo(to);
+    }
+
+    misses++;
+    auto tree = ComputeTreeOf(from);
+    if (!tree.has_value())
+    {
+        return {{}, 0};
+    }
+
+    auto result = tree->GetPathTo(to);
+    if (entries.Size() > 0)
+    {
+        const auto index = AcquireEntry();
+        entries[index] = {std::move(*tree), clock};
+        entryOfSource[from] = index;
+    }
+    return result;
+}
+
+void ShortestPathCache::Clear()
+{
+    const auto order = graph.GetOrder();
+    const auto treeMemory = GetTreeMemory(order);
+    const auto sourcesMemory = static_cast<size_t>(order) * sizeof(size_t);
+    const auto capacity = memoryBudget > sourcesMemory ? (memoryBudget - sourcesMemory) / treeMemory : 0;
+
+    entries = DynamicArray<Entry>(Utils::Min(capacity, static_cast<size_t>(order)));
+    entryOfSource = DynamicArray<size_t>(order, NO_ENTRY);
+    numberOfEntries = 0;
+    graphVersion = graph.GetVersion();
+}
+
+size_t ShortestPathCache::GetNumberOfTrees() const noexcept
+{
+    return numberOfEntries;
+}
+
+size_t ShortestPathCache::GetMemoryUsage() const noexcept
+{
+    return numberOfEntries * GetTreeMemory(static_cast<uint32_t>(entryOfSource.Size())) +
+           entryOfSource.Size() * sizeof(size_t);
+}
+
+uint64_t ShortestPathCache::GetNumberOfHits() const noexcept
+{
+    return hits;
+}
+
+uint64_t ShortestPathCache::GetNumberOfMisses() const noexcept
+{
+    return misses;
+}
+
+void ShortestPathCache::Validate()
+{
+    if (graphVersion != graph.GetVersion())
+    {
+        Clear();
+    }
+}
+
+size_t ShortestPathCache::AcquireEntry()
+{
+    if (numberOfEntries < entries.Size())
+    {
+        return numberOfEntries++;
+    }
+
+    size_t leastRecentlyUsed = 0;
+    for (size_t i = 1; i < entries.Size(); i++)
+    {
+        if (entries[i].lastUse < entries[leastRecentlyUsed].lastUse)
+        {
+            leastRecentlyUsed = i;
+        }
+    }
+
+    entryOfSource[entries[leastRecentlyUsed].tree.source] = NO_ENTRY;
+    return leastRecentlyUsed;
+}
+
+std::optional<ShortestPathTree> ShortestPathCache::ComputeTreeOf(Graph::Vertex from) const
+{
+    switch (algorithm)
+    {
+    case Algorithm::DIJKSTRA:
+        return Dijkstra::FindShortestPathTree(graph, from);
+    case Algorithm::BELLMAN_FORD:
+        return BellmanFord::FindShortestPathTree(graph, from);
+    }
+    return {};
+}
+
+size_t ShortestPathCache::GetTreeMemory(uint32_t order) noexcept
+{
+    return sizeof(Entry) + static_cast<size_t>(order) * (sizeof(uint64_t) + sizeof(Graph::Vertex));
+}
+
+}
\ No newline at end of file
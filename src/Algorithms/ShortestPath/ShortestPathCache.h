@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Result.h"
+#include "Algorithms/Graphs/DirectedGraphs/DirectedGraph.h"
+
+namespace ShortestPath
+{
+
+/**
+ * Remembers shortest path trees of recently queried sources, so repeated queries only walk the tree.
+ * The least recently used tree is dropped when the next one would not fit in the memory budget.
+ * All trees are dropped when the version of the graph changes
+ */
+class ShortestPathCache
+{
+public:
+    enum class Algorithm : uint8_t
+    {
+        DIJKSTRA,
+        BELLMAN_FORD
+    };
+
+    static constexpr size_t DEFAULT_MEMORY_BUDGET = 64u * 1024u * 1024u;
+
+    explicit ShortestPathCache(const DirectedGraph& graph,
+                               size_t memoryBudget = DEFAULT_MEMORY_BUDGET,
+                               Algorithm algorithm = Algorithm::DIJKSTRA);
+
+    /**
+     * Gives the same result as FindShortestPath of the chosen algorithm
+     */
+    [[nodiscard]] Result FindShortestPath(Graph::Vertex from, Graph::Vertex to);
+    void Clear();
+
+    [[nodiscard]] size_t GetNumberOfTrees() const noexcept;
+    [[nodiscard]] size_t GetMemoryUsage() const noexcept;
+    [[nodiscard]] uint64_t GetNumberOfHits() const noexcept;
+    [[nodiscard]] uint64_t GetNumberOfMisses() const noexcept;
+
+private:
+    static constexpr size_t NO_ENTRY = SIZE_MAX;
+
+    struct Entry
+    {
+        ShortestPathTree tree;
+        uint64_t lastUse;
+    };
+
+    /**
+     * Drops all trees if the graph has been modified since they were computed
+     */
+    void Validate();
+
+    /**
+     * @return index of a free entry or of the least recently used one, which is released
+     */
+    [[nodiscard]] size_t AcquireEntry();
+    [[nodiscard]] std::optional<ShortestPathTree> ComputeTreeOf(Graph::Vertex from) const;
+    [[nodiscard]] static size_t GetTreeMemory(uint32_t order) noexcept;
+
+    const DirectedGraph& graph;
+    size_t memoryBudget;
+    Algorithm algorithm;
+
+    uint64_t graphVersion;
+    uint64_t clock;
+    uint64_t hits;
+    uint64_t misses;
+
+    DynamicArray<Entry> entries;
+    DynamicArray<size_t> entryOfSource;
+    size_t numberOfEntries;
+};
+
+}
\ No newline at end of file
@@ -0,0 +1,309 @@
+#pragma once
+
+#include "Algorithms/Graphs/Graph.h"
+#include "Algorithms/Graphs/UndirectedGraphs/UndirectedGraph.h"
+#include "Containers/Bitset.h"
+
+/**
+ * Breadth-first and depth-first traversals statically dispatched over ListGraph, MatrixGraph,
+ * DirectedListGraph, DirectedMatrixGraph and CsrGraph. Buffers live in Scratch, so repeated
+ * traversals of graphs of the same order do not allocate
+ */
+namespace Traversal
+{
+
+using Vertex = Graph::Vertex;
+
+constexpr uint32_t UNREACHABLE = UINT32_MAX;
+
+template<typename T>
+struct Scratch
+{
+    using NeighbourIterator = decltype(std::declval<const T&>().GetNeighbourRangeOf(0).begin());
+
+    struct Frame
+    {
+        Vertex vertex;
+        NeighbourIterator current;
+        NeighbourIterator end;
+    };
+
+    /**
+     * Clears visited flags and grows the buffers to the given order
+     */
+    void Prepare(uint32_t order);
+
+    Bitset visited;
+    Bitset frontierFlags;
+    DynamicArray<Vertex> frontier;
+    DynamicArray<Vertex> nextFrontier;
+    DynamicArray<Frame> frames;
+};
+
+struct NoOp
+{
+    template<typename... Args>
+    constexpr void operator()(Args&&...) const noexcept
+    { }
+};
+
+/**
+ * Level by level breadth-first search, visitor(vertex, depth) is called for every reachable vertex
+ */
+template<typename T, typename F>
+void BreadthFirstSearch(const T& graph, Vertex source, Scratch<T>& scratch, F&& visitor);
+
+/**
+ * Breadth-first search switching between top-down and bottom-up steps. Bottom-up steps look for a parent
+ * of every unvisited vertex in the frontier, which is cheaper when the frontier is big. It needs
+ * incoming edges, so directed graphs always use top-down steps
+ */
+template<typename T, typename F>
+void DirectionOptimizingBfs(const T& graph, Vertex source, Scratch<T>& scratch, F&& visitor);
+
+/**
+ * Iterative depth-first search, onDiscover(vertex) is called in preorder and onFinish(vertex) in postorder
+ */
+template<typename T, typename D, typename F = NoOp>
+void DepthFirstSearch(const T& graph, Vertex source, Scratch<T>& scratch, D&& onDiscover, F&& onFinish = F());
+
+/**
+ * Depth-first search started from every vertex not visited yet, in increasing order
+ */
+template<typename T, typename D, typename F = NoOp>
+void DepthFirstSearchAll(const T& graph, Scratch<T>& scratch, D&& onDiscover, F&& onFinish = F());
+
+/**
+ * @return number of edges on the shortest path from the source to every vertex or UNREACHABLE
+ */
+template<typename T>
+[[nodiscard]] DynamicArray<uint32_t> GetDistances(const T& graph, Vertex source);
+
+/**
+ * DEFINITIONS
+ */
+
+namespace Impl
+{
+
+constexpr uint32_t TOP_DOWN_TO_BOTTOM_UP = 14;
+constexpr uint32_t BOTTOM_UP_TO_TOP_DOWN = 24;
+
+template<typename T>
+[[nodiscard]] bool IsSymmetric(const T& graph)
+{
+    if constexpr (Utils::DerivedFrom<T, UndirectedGraph>::Value)
+    {
+        return true;
+    }
+    else if constexpr (Utils::DerivedFrom<T, Graph>::Value)
+    {
+        return false;
+    }
+    else
+    {
+        return !graph.IsDirected();
+    }
+}
+
+template<typename T, typename D, typename F>
+void Explore(const T& graph, Vertex root, Scratch<T>& scratch, D& onDiscover, F& onFinish)
+{
+    auto& frames = scratch.frames;
+    size_t depth = 0;
+
+    scratch.visited.Set(root);
+    onDiscover(root);
+    auto range = graph.GetNeighbourRangeOf(root);
+    frames[depth++] = {root, range.begin(), range.end()};
+
+    while (depth > 0)
+    {
+        auto& frame = frames[depth - 1];
+        if (frame.current == frame.end)
+        {
+            onFinish(frame.vertex);
+            depth--;
+            continue;
+        }
+
+        auto next = (*frame.current).vertex;
+        ++frame.current;
+        if (!scratch.visited.TestAndSet(next))
+        {
+            onDiscover(next);
+            auto nextRange = graph.GetNeighbourRangeOf(next);
+            frames[depth++] = {next, nextRange.begin(), nextRange.end()};
+        }
+    }
+}
+
+template<typename T>
+[[nodiscard]] uint32_t TopDownStep(const T& graph, uint32_t frontierSize, Scratch<T>& scratch)
+{
+    uint32_t nextFrontierSize = 0;
+    for (uint32_t i = 0; i < frontierSize; i++)
+    {
+        graph.VisitNeighboursOf(scratch.frontier[i], [&scratch, &nextFrontierSize](Graph::Neighbour neighbour) {
+            if (!scratch.visited.TestAndSet(neighbour.vertex))
+            {
+                scratch.nextFrontier[nextFrontierSize++] = neighbour.vertex;
+            }
+        });
+    }
+    return nextFrontierSize;
+}
+
+template<typename T>
+[[nodiscard]] uint32_t BottomUpStep(const T& graph, uint32_t frontierSize, Scratch<T>& scratch)
+{
+    scratch.frontierFlags.Clear();
+    for (uint32_t i = 0; i < frontierSize; i++)
+    {
+        scratch.frontierFlags.Set(scratch.frontier[i]);
+    }
+
+    uint32_t nextFrontierSize = 0;
+    for (Vertex vertex = 0; vertex < graph.GetOrder(); vertex++)
+    {
+        if (scratch.visited.Test(vertex))
+        {
+            continue;
+        }
+        for (const auto& neighbour : graph.GetNeighbourRangeOf(vertex))
+        {
+            if (scratch.frontierFlags.Test(neighbour.vertex))
+            {
+                scratch.visited.Set(vertex);
+                scratch.nextFrontier[nextFrontierSize++] = vertex;
+                break;
+            }
+        }
+    }
+    return nextFrontierSize;
+}
+
+}
+
+template<typename T>
+void Scratch<T>::Prepare(uint32_t order)
+{
+    visited.Reset(order);
+    frontierFlags.Reset(order);
+
+    if (frontier.Size() < order)
+    {
+        frontier = DynamicArray<Vertex>(order);
+        nextFrontier = DynamicArray<Vertex>(order);
+        frames = DynamicArray<Frame>(order);
+    }
+}
+
+template<typename T, typename F>
+void BreadthFirstSearch(const T& graph, Vertex source, Scratch<T>& scratch, F&& visitor)
+{
+    if (source >= graph.GetOrder())
+    {
+        return;
+    }
+
+    scratch.Prepare(graph.GetOrder());
+    scratch.visited.Set(source);
+    scratch.frontier[0] = source;
+
+    uint32_t frontierSize = 1;
+    for (uint32_t depth = 0; frontierSize > 0; depth++)
+    {
+        for (uint32_t i = 0; i < frontierSize; i++)
+        {
+            visitor(scratch.frontier[i], depth);
+        }
+        frontierSize = Impl::TopDownStep(graph, frontierSize, scratch);
+        Utils::Swap(scratch.frontier, scratch.nextFrontier);
+    }
+}
+
+template<typename T, typename F>
+void DirectionOptimizingBfs(const T& graph, Vertex source, Scratch<T>& scratch, F&& visitor)
+{
+    if (!Impl::IsSymmetric(graph))
+    {
+        BreadthFirstSearch(graph, source, scratch, std::forward<F>(visitor));
+        return;
+    }
+    if (source >= graph.GetOrder())
+    {
+        return;
+    }
+
+    scratch.Prepare(graph.GetOrder());
+    scratch.visited.Set(source);
+    scratch.frontier[0] = source;
+
+    uint64_t unexploredEdges = 2 * static_cast<uint64_t>(graph.GetSize());
+    bool isBottomUp = false;
+    uint32_t frontierSize = 1;
+    for (uint32_t depth = 0; frontierSize > 0; depth++)
+    {
+        uint64_t frontierEdges = 0;
+        for (uint32_t i = 0; i < frontierSize; i++)
+        {
+            visitor(scratch.frontier[i], depth);
+            frontierEdges += graph.GetNumberOfNeighboursOf(scratch.frontier[i]);
+        }
+
+        if (!isBottomUp && frontierEdges > unexploredEdges / Impl::TOP_DOWN_TO_BOTTOM_UP)
+        {
+            isBottomUp = true;
+        }
+        else if (isBottomUp && frontierSize < graph.GetOrder() / Impl::BOTTOM_UP_TO_TOP_DOWN)
+        {
+            isBottomUp = false;
+        }
+
+        frontierSize = isBottomUp ? Impl::BottomUpStep(graph, frontierSize, scratch)
+                                  : Impl::TopDownStep(graph, frontierSize, scratch);
+        unexploredEdges -= Utils::Min(frontierEdges, unexploredEdges);
+        Utils::Swap(scratch.frontier, scratch.nextFrontier);
+    }
+}
+
+template<typename T, typename D, typename F>
+void DepthFirstSearch(const T& graph, Vertex source, Scratch<T>& scratch, D&& onDiscover, F&& onFinish)
+{
+    if (source >= graph.GetOrder())
+    {
+        return;
+    }
+
+    scratch.Prepare(graph.GetOrder());
+    Impl::Explore(graph, source, scratch, onDiscover, onFinish);
+}
+
+template<typename T, typename D, typename F>
+void DepthFirstSearchAll(const T& graph, Scratch<T>& scratch, D&& onDiscover, F&& onFinish)
+{
+    scratch.Prepare(graph.GetOrder());
+    for (Vertex vertex = 0; vertex < graph.GetOrder(); vertex++)
+    {
+        if (!scratch.visited.Test(vertex))
+        {
+            Impl::Explore(graph, vertex, scratch, onDiscover, onFinish);
+        }
+    }
+}
+
+template<typename T>
+DynamicArray<uint32_t> GetDistances(const T& graph, Vertex source)
+{
+    DynamicArray<uint32_t> distances(graph.GetOrder(), UNREACHABLE);
+    Scratch<T> scratch;
+
+    DirectionOptimizingBfs(graph, source, scratch, [&distances](Vertex vertex, uint32_t depth) {
+        distances[vertex] = depth;
+    });
+
+    return distances;
+}
+
+}
\ No newline at end of file
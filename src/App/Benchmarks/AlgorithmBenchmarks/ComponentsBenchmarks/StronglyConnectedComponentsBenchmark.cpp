@@ -0,0 +1,76 @@
+#include "StronglyConnectedComponentsBenchmark.h"
+#include "Algorithms/Components/StronglyConnectedComponents.h"
+#include "Algorithms/Graphs/GraphGenerator.h"
+#include "App/Settings.h"
+#include "Utils/Timer.h"
+
+namespace StronglyConnectedComponentsBenchmark
+{
+
+DirectedListGraph GenerateGraph(uint32_t order, float density);
+
+template<typename F>
+int64_t MeasureTime(F&& algorithm);
+
+DirectedListGraph GenerateGraph(uint32_t order, float density)
+{
+    static_assert(AlgorithmSettings::Validate<DirectedListGraph>());
+
+    return Generator::GenerateConnectedGraph<DirectedListGraph>({order,
+                                                                 density,
+                                                                 AlgorithmSettings::MIN_WEIGHT,
+                                                                 AlgorithmSettings::MAX_WEIGHT}).value();
+}
+
+std::string RunBenchmark()
+{
+    std::string result = "Benchmark for strongly connected components:\n";
+
+    for (const auto& order: AlgorithmSettings::GRAPH_ORDERS)
+    {
+        for (const auto& density : AlgorithmSettings::GRAPH_DENSITIES)
+        {
+            auto graph = GenerateGraph(order, density);
+            Traversal::Scratch<DirectedListGraph> scratch;
+
+            auto tarjanTime = MeasureTime([&graph, &scratch]() {
+                return StronglyConnectedComponents::FindWithTarjanOf(graph, scratch).numberOfComponents;
+            });
+            auto kosarajuTime = MeasureTime([&graph, &scratch]() {
+                return StronglyConnectedComponents::FindWithKosarajuOf(graph, scratch).numberOfComponents;
+            });
+
+            const auto components = StronglyConnectedComponents::FindWithTarjanOf(graph, scratch);
+            auto condensationTime = MeasureTime([&graph, &components]() {
+                return StronglyConnectedComponents::GetCondensationOf(graph, components).GetSize();
+            });
+
+            result.append("Order: " + Utils::Parser::NumberToString(order) +
+                          " Density: " + Utils::Parser::NumberToString(density, 2) +
+                          ": Tarjan: " + Utils::Parser::NumberToString(tarjanTime) + "ns" +
+                          "; Kosaraju: " + Utils::Parser::NumberToString(kosarajuTime) + "ns" +
+                          "; Condensation: " + Utils::Parser::NumberToString(condensationTime) + "ns\n");
+        }
+        result += "\n";
+    }
+    return result;
+}
+
+template<typename F>
+int64_t MeasureTime(F&& algorithm)
+{
+    int64_t averageTime = 0u;
+    for (uint32_t i = 0u; i < AlgorithmSettings::NUMBER_OF_TESTS; i++)
+    {
+        Utils::Timer timer;
+        timer.Start();
+
+        [[maybe_unused]] volatile auto result = algorithm();
+
+        timer.Stop();
+        averageTime += timer.GetTimeInNanos();
+    }
+    return averageTime / AlgorithmSettings::NUMBER_OF_TESTS;
+}
+
+}
\ No newline at end of file
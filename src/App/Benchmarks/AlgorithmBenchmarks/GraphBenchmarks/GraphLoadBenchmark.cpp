@@ -0,0 +1,120 @@
+#include "GraphLoadBenchmark.h"
+#include "Algorithms/Graphs/CsrGraph.h"
+#include "Algorithms/Graphs/DirectedGraphs/DirectedListGraph.h"
+#include "Algorithms/Graphs/GraphGenerator.h"
+#include "App/Settings.h"
+#include "Utils/Timer.h"
+
+#include <filesystem>
+#include <fstream>
+
+namespace GraphLoadBenchmark
+{
+
+struct TestCaseResult
+{
+    int64_t textTime;
+    int64_t binaryTime;
+    int64_t binaryScanTime;
+};
+
+TestCaseResult TestCase(uint32_t order, float density);
+
+int64_t TextLoadTest(const std::string& path);
+
+int64_t BinaryLoadTest(const std::string& path, bool scan);
+
+std::string RunBenchmark()
+{
+    std::string result = "Benchmark for loading graphs from files (DirectedListGraph text format vs mapped CsrGraph):\n";
+
+    for (const auto& order: AlgorithmSettings::GRAPH_ORDERS)
+    {
+        for (const auto& density : AlgorithmSettings::GRAPH_DENSITIES)
+        {
+            auto[textTime, binaryTime, binaryScanTime] = TestCase(order, density);
+            result.append("Order: " + Utils::Parser::NumberToString(order) +
+                          " Density: " + Utils::Parser::NumberToString(density, 2) +
+                          ": Text: " + Utils::Parser::NumberToString(textTime) + "ns" +
+                          "; Binary: " + Utils::Parser::NumberToString(binaryTime) + "ns" +
+                          "; Binary with scan: " + Utils::Parser::NumberToString(binaryScanTime) + "ns\n");
+        }
+        result += "\n";
+    }
+    return result;
+}
+
+TestCaseResult TestCase(uint32_t order, float density)
+{
+    static_assert(AlgorithmSettings::Validate<DirectedListGraph>());
+
+    auto graph = Generator::GenerateConnectedGraph<DirectedListGraph>({order,
+                                                                       density,
+                                                                       AlgorithmSettings::MIN_WEIGHT,
+                                                                       AlgorithmSettings::MAX_WEIGHT}).value();
+
+    const auto directory = std::filesystem::temp_directory_path();
+    const auto textPath = (directory / "GraphLoadBenchmark.txt").string();
+    const auto binaryPath = (directory / "GraphLoadBenchmark.dsgr").string();
+
+    {
+        std::ofstream fout(textPath);
+        fout << graph;
+    }
+    CsrGraph::Save(binaryPath, graph);
+
+    TestCaseResult result{TextLoadTest(textPath), BinaryLoadTest(binaryPath, false), BinaryLoadTest(binaryPath, true)};
+
+    std::filesystem::remove(textPath);
+    std::filesystem::remove(binaryPath);
+
+    return result;
+}
+
+int64_t TextLoadTest(const std::string& path)
+{
+    int64_t averageTime = 0u;
+    for (uint32_t i = 0u; i < AlgorithmSettings::NUMBER_OF_TESTS; i++)
+    {
+        Utils::Timer timer;
+        timer.Start();
+
+        std::ifstream fin(path);
+        DirectedListGraph graph;
+        fin >> graph;
+
+        timer.Stop();
+        averageTime += timer.GetTimeInNanos();
+    }
+    return averageTime / AlgorithmSettings::NUMBER_OF_TESTS;
+}
+
+int64_t BinaryLoadTest(const std::string& path, bool scan)
+{
+    int64_t averageTime = 0u;
+    for (uint32_t i = 0u; i < AlgorithmSettings::NUMBER_OF_TESTS; i++)
+    {
+        Utils::Timer timer;
+        timer.Start();
+
+        auto graph = CsrGraph::Load(path);
+        if (scan && graph.has_value())
+        {
+            uint64_t weight = 0;
+            for (auto vertex : graph->GetVertexRange())
+            {
+                for (const auto& neighbour : graph->GetNeighbourRangeOf(vertex))
+                {
+                    weight += neighbour.weight;
+                }
+            }
+            [[maybe_unused]] volatile auto result = weight;
+        }
+
+        timer.Stop();
+        averageTime += timer.GetTimeInNanos();
+    }
+    return averageTime / AlgorithmSettings::NUMBER_OF_TESTS;
+}
+
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <string>
+
+namespace GraphLoadBenchmark
+{
+
+std::string RunBenchmark();
+
+}
@@ -0,0 +1,76 @@
+#include "BoruvkaBenchmark.h"
+#include "Algorithms/Graphs/UndirectedGraphs/ListGraph.h"
+#include "Algorithms/Graphs/GraphGenerator.h"
+#include "Algorithms/MST/Boruvka.h"
+#include "Algorithms/MST/Kruskal.h"
+#include "App/Settings.h"
+#include "Utils/Timer.h"
+
+namespace BoruvkaBenchmark
+{
+
+ListGraph GenerateGraph(uint32_t order, float density);
+
+template<typename F>
+int64_t MeasureTime(F&& algorithm);
+
+ListGraph GenerateGraph(uint32_t order, float density)
+{
+    static_assert(AlgorithmSettings::Validate<ListGraph>());
+
+    return Generator::GenerateConnectedGraph<ListGraph>({order,
+                                                         density,
+                                                         AlgorithmSettings::MIN_WEIGHT,
+                                                         AlgorithmSettings::MAX_WEIGHT}).value();
+}
+
+std::string RunBenchmark()
+{
+    std::string result = "Benchmark for Boruvka's algorithm compared to Kruskal's algorithm:\n";
+
+    for (const auto& order: AlgorithmSettings::GRAPH_ORDERS)
+    {
+        for (const auto& density : AlgorithmSettings::GRAPH_DENSITIES)
+        {
+            auto graph = GenerateGraph(order, density);
+
+            auto kruskalTime = MeasureTime([&graph]() {
+                return MST::Kruskal::FindMstOf(graph);
+            });
+            result.append("Order: " + Utils::Parser::NumberToString(order) +
+                          " Density: " + Utils::Parser::NumberToString(density, 2) +
+                          ": Kruskal: " + Utils::Parser::NumberToString(kruskalTime) + "ns");
+
+            for (uint32_t threads = 1; threads <= Utils::GetNumberOfThreads(); threads *= 2)
+            {
+                auto boruvkaTime = MeasureTime([&graph, threads]() {
+                    return MST::Boruvka::FindMstOf(graph, threads);
+                });
+                result.append("; Boruvka (" + Utils::Parser::NumberToString(threads) + " threads): " +
+                              Utils::Parser::NumberToString(boruvkaTime) + "ns");
+            }
+            result += "\n";
+        }
+        result += "\n";
+    }
+    return result;
+}
+
+template<typename F>
+int64_t MeasureTime(F&& algorithm)
+{
+    int64_t averageTime = 0u;
+    for (uint32_t i = 0u; i < AlgorithmSettings::NUMBER_OF_TESTS; i++)
+    {
+        Utils::Timer timer;
+        timer.Start();
+
+        [[maybe_unused]] volatile auto result = algorithm();
+
+        timer.Stop();
+        averageTime += timer.GetTimeInNanos();
+    }
+    return averageTime / AlgorithmSettings::NUMBER_OF_TESTS;
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <string>
+
+namespace BoruvkaBenchmark
+{
+
+std::string RunBenchmark();
+
+}
\ No newline at end of file
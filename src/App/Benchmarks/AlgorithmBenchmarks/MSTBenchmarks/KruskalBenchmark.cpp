@@ -18,10 +18,11 @@ struct TestCaseResult
 template<typename T>
 T GenerateGraph(uint32_t order, float density);
 
-TestCaseResult TestCase(uint32_t order, float density);
+template<typename F>
+TestCaseResult TestCase(uint32_t order, float density, F&& algorithm);
 
-template<typename T>
-int64_t ConcreteGraphTest(uint32_t order, float density);
+template<typename T, typename F>
+int64_t ConcreteGraphTest(uint32_t order, float density, F&& algorithm);
 
 template<typename T>
 T GenerateGraph(uint32_t order, float density)
@@ -37,33 +38,41 @@ T GenerateGraph(uint32_t order, float density)
 
 std::string RunBenchmark()
 {
-    std::string result = "Benchmark for Kruskal's algorithm:\n";
+    std::string result = "Benchmark for Kruskal's algorithm (sorting all edges / Filter-Kruskal):\n";
 
     for (const auto& order: AlgorithmSettings::GRAPH_ORDERS)
     {
         for (const auto& density : AlgorithmSettings::GRAPH_DENSITIES)
         {
-            auto[listGraphTime, matrixGraphTime] = TestCase(order, density);
+            auto[listGraphTime, matrixGraphTime] = TestCase(order, density, [](const auto& graph) {
+                return MST::Kruskal::FindMstOf(graph);
+            });
+            auto[filterListGraphTime, filterMatrixGraphTime] = TestCase(order, density, [](const auto& graph) {
+                return MST::Kruskal::FindMstWithFilteringOf(graph);
+            });
             result.append("Order: " + Utils::Parser::NumberToString(order) +
                           " Density: " + Utils::Parser::NumberToString(density, 2) +
                           ": ListGraph: " + Utils::Parser::NumberToString(listGraphTime) + "ns" +
-                          "; MatrixGraph: " + Utils::Parser::NumberToString(matrixGraphTime) + "ns\n");
+                          " / " + Utils::Parser::NumberToString(filterListGraphTime) + "ns" +
+                          "; MatrixGraph: " + Utils::Parser::NumberToString(matrixGraphTime) + "ns" +
+                          " / " + Utils::Parser::NumberToString(filterMatrixGraphTime) + "ns\n");
         }
         result += "\n";
     }
     return result;
 }
 
-TestCaseResult TestCase(uint32_t order, float density)
+template<typename F>
+TestCaseResult TestCase(uint32_t order, float density, F&& algorithm)
 {
-    auto listGraphTime = ConcreteGraphTest<ListGraph>(order, density);
-    auto matrixGraphTime = ConcreteGraphTest<MatrixGraph>(order, density);
+    auto listGraphTime = ConcreteGraphTest<ListGraph>(order, density, algorithm);
+    auto matrixGraphTime = ConcreteGraphTest<MatrixGraph>(order, density, algorithm);
 
     return {listGraphTime, matrixGraphTime};
 }
 
-template<typename T>
-int64_t ConcreteGraphTest(uint32_t order, float density)
+template<typename T, typename F>
+int64_t ConcreteGraphTest(uint32_t order, float density, F&& algorithm)
 {
     int64_t averageTime = 0u;
     auto graph = GenerateGraph<T>(order, density);
@@ -72,12 +81,12 @@ int64_t ConcreteGraphTest(uint32_t order, float density)
         Utils::Timer timer;
         timer.Start();
 
-        [[maybe_unused]] volatile auto result = MST::Kruskal::FindMstOf(graph);
+        [[maybe_unused]] volatile auto result = algorithm(graph);
 
         timer.Stop();
         averageTime += timer.GetTimeInNanos();
     }
-    return averageTime / ContainerSettings::NUMBER_OF_TESTS;
+    return averageTime / AlgorithmSettings::NUMBER_OF_TESTS;
 }
 
 }
\ No newline at end of file
@@ -23,7 +23,7 @@ TestCaseResult TestCase(uint32_t order, float density);
 template<typename T>
 int64_t ConcreteGraphTest(uint32_t order, float density);
 
-Utils::Pair<Graph::Vertex, Graph::Vertex> DrawEdge(const DynamicArray<Graph::Vertex>& vertices);
+Utils::Pair<Graph::Vertex, Graph::Vertex> DrawEdge(uint32_t order);
 
 template<typename T>
 T GenerateGraph(uint32_t order, float density)
@@ -71,7 +71,7 @@ int64_t ConcreteGraphTest(uint32_t order, float density)
     auto graph = GenerateGraph<T>(order, density);
     for (uint32_t i = 0u; i < AlgorithmSettings::NUMBER_OF_TESTS; i++)
     {
-        auto[first, second] = DrawEdge(graph.GetVertices());
+        auto[first, second] = DrawEdge(graph.GetOrder());
         Utils::Timer timer;
         timer.Start();
 
@@ -83,15 +83,15 @@ int64_t ConcreteGraphTest(uint32_t order, float density)
     return averageTime / ContainerSettings::NUMBER_OF_TESTS;
 }
 
-Utils::Pair<Graph::Vertex, Graph::Vertex> DrawEdge(const DynamicArray<Graph::Vertex>& vertices)
+Utils::Pair<Graph::Vertex, Graph::Vertex> DrawEdge(uint32_t order)
 {
-    Graph::Vertex first = vertices[static_cast<size_t>(Utils::GetRandomNumber<size_t>(0, vertices.Size() - 1))];
+    Graph::Vertex first = Utils::GetRandomNumber<Graph::Vertex>(0, order - 1);
 
     Graph::Vertex second;
 
     do
     {
-        second = vertices[static_cast<size_t>(Utils::GetRandomNumber<size_t>(0, vertices.Size() - 1))];
+        second = Utils::GetRandomNumber<Graph::Vertex>(0, order - 1);
     } while (first == second);
 
     return {first, second};
@@ -0,0 +1,323 @@
+#include "BTreeBenchmark.h"
+#include "Containers/BTree.h"
+#include "Utils/Timer.h"
+#include "App/Settings.h"
+
+#include <map>
+
+namespace BTreeBenchmark
+{
+    struct TestCaseResult
+    {
+        int64_t treeTime;
+        int64_t mapTime;
+    };
+
+    void FillBTree(BTree<ContainerSettings::DataType>& tree, size_t size);
+    void FillMap(std::map<ContainerSettings::DataType, bool>& map, size_t size);
+
+    std::string Insert();
+    TestCaseResult InsertCase(size_t size);
+    int64_t InsertBTreeTest(size_t size);
+    int64_t InsertMapTest(size_t size);
+
+
+    std::string Remove();
+    TestCaseResult RemoveCase(size_t size);
+    int64_t RemoveBTreeTest(size_t size);
+    int64_t RemoveMapTest(size_t size);
+
+    TestCaseResult FindCase(size_t size);
+    int64_t FindBTreeTest(size_t size);
+    int64_t FindMapTest(size_t size);
+
+    TestCaseResult ScanCase(size_t size);
+    int64_t ScanBTreeTest(size_t size);
+    int64_t ScanMapTest(size_t size);
+
+    void FillBTree(BTree<ContainerSettings::DataType>& tree, size_t size)
+    {
+        for (size_t i = 0u; i < size; i++)
+        {
+            tree.Insert(Utils::GetRandomNumber<ContainerSettings::DataType>(ContainerSettings::MIN_VALUE, ContainerSettings::MAX_VALUE));
+        }
+    }
+
+    void FillMap(std::map<ContainerSettings::DataType, bool>& map, size_t size)
+    {
+        for (size_t i = 0u; i < size; i++)
+        {
+            map.insert({Utils::GetRandomNumber<ContainerSettings::DataType>(ContainerSettings::MIN_VALUE, ContainerSettings::MAX_VALUE), true});
+        }
+    }
+
+    std::string RunBenchmark()
+    {
+        return "All benchmarks for BTree:\n" + AddElements() + RemoveElements() + FindElements() + ScanElements();
+    }
+
+    std::string AddElements()
+    {
+        return "Add elements tests: \n" + Insert();
+    }
+
+
+    std::string Insert()
+    {
+        std::string result = "Insert test: \n";
+        for (const auto& size: ContainerSettings::TEST_SIZES)
+        {
+            auto[treeTime, mapTime] = InsertCase(size);
+            result.append("Size: " + Utils::Parser::NumberToString(size) +
+                          ": BTree: " + Utils::Parser::NumberToString(treeTime) + "ns" +
+                          "; std::map: " + Utils::Parser::NumberToString(mapTime) + "ns\n");
+        }
+        return result;
+    }
+
+    TestCaseResult InsertCase(size_t size)
+    {
+        auto treeTime = InsertBTreeTest(size);
+        auto mapTime = InsertMapTest(size);
+
+        return TestCaseResult {treeTime, mapTime};
+    }
+
+    int64_t InsertBTreeTest(size_t size)
+    {
+        int64_t averageTime = 0u;
+        for (uint32_t i = 0u; i < ContainerSettings::NUMBER_OF_TESTS; i++)
+        {
+            BTree<ContainerSettings::DataType> testedBTree;
+            FillBTree(testedBTree, size);
+
+            Utils::Timer timer;
+            timer.Start();
+
+            testedBTree.Insert(Utils::GetRandomNumber<ContainerSettings::DataType>(ContainerSettings::MIN_VALUE, ContainerSettings::MAX_VALUE));
+
+            timer.Stop();
+            averageTime += timer.GetTimeInNanos();
+        }
+        return averageTime / ContainerSettings::NUMBER_OF_TESTS;
+    }
+
+    int64_t InsertMapTest(size_t size)
+    {
+        int64_t averageTime = 0u;
+        for (uint32_t i = 0u; i < ContainerSettings::NUMBER_OF_TESTS; i++)
+        {
+            std::map<ContainerSettings::DataType, bool> testedMap;
+            FillMap(testedMap, size);
+
+            Utils::Timer timer;
+            timer.Start();
+
+            testedMap.insert({Utils::GetRandomNumber<ContainerSettings::DataType>(ContainerSettings::MIN_VALUE, ContainerSettings::MAX_VALUE), true});
+
+            timer.Stop();
+            averageTime += timer.GetTimeInNanos();
+        }
+        return averageTime / ContainerSettings::NUMBER_OF_TESTS;
+    }
+
+
+    std::string RemoveElements()
+    {
+        return "Remove elements tests: \n" + Remove();
+    }
+
+
+    std::string Remove()
+    {
+        std::string result = "RemoveAt test: \n";
+        for (const auto& size: ContainerSettings::TEST_SIZES)
+        {
+            auto[treeTime, mapTime] = RemoveCase(size);
+            result.append("Size: " + Utils::Parser::NumberToString(size) +
+                          ": BTree: " + Utils::Parser::NumberToString(treeTime) + "ns" +
+                          "; std::map: " + Utils::Parser::NumberToString(mapTime) + "ns\n");
+        }
+        return result;
+    }
+
+    TestCaseResult RemoveCase(size_t size)
+    {
+        auto treeTime = RemoveBTreeTest(size);
+        auto mapTime = RemoveMapTest(size);
+
+        return TestCaseResult {treeTime, mapTime};
+    }
+
+    int64_t RemoveBTreeTest(size_t size)
+    {
+        int64_t averageTime = 0u;
+        for (uint32_t i = 0u; i < ContainerSettings::NUMBER_OF_TESTS; i++)
+        {
+            BTree<ContainerSettings::DataType> testedBTree;
+            FillBTree(testedBTree, size);
+            auto min = *testedBTree.cbegin();
+
+            Utils::Timer timer;
+            timer.Start();
+
+            testedBTree.Remove(min);
+
+            timer.Stop();
+            averageTime += timer.GetTimeInNanos();
+        }
+        return averageTime / ContainerSettings::NUMBER_OF_TESTS;
+    }
+
+    int64_t RemoveMapTest(size_t size)
+    {
+        int64_t averageTime = 0u;
+        for (uint32_t i = 0u; i < ContainerSettings::NUMBER_OF_TESTS; i++)
+        {
+            std::map<ContainerSettings::DataType, bool> testedMap;
+            FillMap(testedMap, size);
+            auto min = (*testedMap.cbegin()).first;
+
+            Utils::Timer timer;
+            timer.Start();
+
+            testedMap.erase(min);
+
+            timer.Stop();
+            averageTime += timer.GetTimeInNanos();
+        }
+        return averageTime / ContainerSettings::NUMBER_OF_TESTS;
+    }
+
+
+    std::string FindElements()
+    {
+        std::string result = "Find test: \n";
+        for (const auto& size: ContainerSettings::TEST_SIZES)
+        {
+            auto[treeTime, mapTime] = FindCase(size);
+            result.append("Size: " + Utils::Parser::NumberToString(size) +
+                          ": BTree: " + Utils::Parser::NumberToString(treeTime) + "ns" +
+                          "; std::map: " + Utils::Parser::NumberToString(mapTime) + "ns\n");
+        }
+        return result;
+    }
+
+    TestCaseResult FindCase(size_t size)
+    {
+        auto treeTime = FindBTreeTest(size);
+        auto mapTime = FindMapTest(size);
+
+        return TestCaseResult {treeTime, mapTime};
+    }
+
+    int64_t FindBTreeTest(size_t size)
+    {
+        int64_t averageTime = 0u;
+        for (uint32_t i = 0u; i < ContainerSettings::NUMBER_OF_TESTS; i++)
+        {
+            BTree<ContainerSettings::DataType> testedBTree;
+            FillBTree(testedBTree, size);
+
+            Utils::Timer timer;
+            timer.Start();
+
+            [[maybe_unused]] volatile auto tmp = testedBTree.Find(
+                Utils::GetRandomNumber<ContainerSettings::DataType>(ContainerSettings::MIN_VALUE, ContainerSettings::MAX_VALUE));
+
+            timer.Stop();
+            averageTime += timer.GetTimeInNanos();
+        }
+        return averageTime / ContainerSettings::NUMBER_OF_TESTS;
+    }
+
+    int64_t FindMapTest(size_t size)
+    {
+        int64_t averageTime = 0u;
+        for (uint32_t i = 0u; i < ContainerSettings::NUMBER_OF_TESTS; i++)
+        {
+            std::map<ContainerSettings::DataType, bool> testedMap;
+            FillMap(testedMap, size);
+
+            Utils::Timer timer;
+            timer.Start();
+
+            [[maybe_unused]] volatile auto tmp = testedMap.find(
+                Utils::GetRandomNumber<ContainerSettings::DataType>(ContainerSettings::MIN_VALUE, ContainerSettings::MAX_VALUE));
+
+            timer.Stop();
+            averageTime += timer.GetTimeInNanos();
+        }
+        return averageTime / ContainerSettings::NUMBER_OF_TESTS;
+    }
+
+
+    std::string ScanElements()
+    {
+        std::string result = "Scan test: \n";
+        for (const auto& size: ContainerSettings::TEST_SIZES)
+        {
+            auto[treeTime, mapTime] = ScanCase(size);
+            result.append("Size: " + Utils::Parser::NumberToString(size) +
+                          ": BTree: " + Utils::Parser::NumberToString(treeTime) + "ns" +
+                          "; std::map: " + Utils::Parser::NumberToString(mapTime) + "ns\n");
+        }
+        return result;
+    }
+
+    TestCaseResult ScanCase(size_t size)
+    {
+        auto treeTime = ScanBTreeTest(size);
+        auto mapTime = ScanMapTest(size);
+
+        return TestCaseResult {treeTime, mapTime};
+    }
+
+    int64_t ScanBTreeTest(size_t size)
+    {
+        int64_t averageTime = 0u;
+        for (uint32_t i = 0u; i < ContainerSettings::NUMBER_OF_TESTS; i++)
+        {
+            BTree<ContainerSettings::DataType> testedBTree;
+            FillBTree(testedBTree, size);
+
+            Utils::Timer timer;
+            timer.Start();
+
+            int64_t sum = 0;
+            for (const auto& value : testedBTree)
+            {
+                sum += value;
+            }
+            [[maybe_unused]] volatile auto tmp = sum;
+
+            timer.Stop();
+            averageTime += timer.GetTimeInNanos();
+        }
+        return averageTime / ContainerSettings::NUMBER_OF_TESTS;
+    }
+
+    int64_t ScanMapTest(size_t size)
+    {
+        int64_t averageTime = 0u;
+        for (uint32_t i = 0u; i < ContainerSettings::NUMBER_OF_TESTS; i++)
+        {
+            std::map<ContainerSettings::DataType, bool> testedMap;
+            FillMap(testedMap, size);
+
+            Utils::Timer timer;
+            timer.Start();
+
+            int64_t sum = 0;
+            for (const auto& pair : testedMap)
+            {
+                sum += pair.first;
+            }
+            [[maybe_unused]] volatile auto tmp = sum;
+
+            timer.Stop();
+            averageTime += timer.GetTimeInNanos();
+        }
+        return averageTime / ContainerSettings::NUMBER_OF_TESTS;
+    }
+}
\ No newline at end of file
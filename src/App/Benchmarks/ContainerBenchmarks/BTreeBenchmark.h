@@ -0,0 +1,12 @@
+#pragma once
+
+#include <string>
+
+namespace BTreeBenchmark
+{
+    std::string RunBenchmark();
+    std::string AddElements();
+    std::string RemoveElements();
+    std::string FindElements();
+    std::string ScanElements();
+}
\ No newline at end of file
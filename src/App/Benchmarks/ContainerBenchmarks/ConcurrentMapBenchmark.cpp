@@ -0,0 +1,189 @@
+#include "ConcurrentMapBenchmark.h"
+#include "Containers/ConcurrentMap.h"
+#include "Containers/Map.h"
+#include "Utils/Parallel.h"
+#include "Utils/Timer.h"
+#include "App/Settings.h"
+
+#include <atomic>
+#include <mutex>
+
+namespace ConcurrentMapBenchmark
+{
+    constexpr size_t OPERATIONS_PER_THREAD = 1'000u;
+
+    struct Operation
+    {
+        enum class Type : uint8_t
+        {
+            FIND,
+            INSERT,
+            REMOVE
+        };
+
+        Type type;
+        ContainerSettings::DataType key;
+    };
+
+    struct TestCaseResult
+    {
+        int64_t concurrentMapThroughput;
+        int64_t lockedMapThroughput;
+    };
+
+    /**
+     * Map shared by threads through one mutex
+     */
+    class LockedMap
+    {
+    public:
+        bool Contains(ContainerSettings::DataType key)
+        {
+            std::lock_guard lock(mutex);
+            return map.Find(key) != map.end();
+        }
+
+        void Insert(const Map<ContainerSettings::DataType, bool>::DataType& value)
+        {
+            std::lock_guard lock(mutex);
+            map.Insert(value);
+        }
+
+        void Remove(ContainerSettings::DataType key)
+        {
+            std::lock_guard lock(mutex);
+            map.Remove(key);
+        }
+
+    private:
+        Map<ContainerSettings::DataType, bool> map;
+        std::mutex mutex;
+    };
+
+    ContainerSettings::DataType GetRandomKey(size_t size);
+    DynamicArray<DynamicArray<Operation>> GenerateOperations(uint32_t numberOfThreads, size_t size, uint32_t readPercentage);
+
+    TestCaseResult MixedCase(size_t size, uint32_t numberOfThreads, uint32_t readPercentage);
+
+    template<typename T>
+    int64_t MeasureThroughput(T& map, const DynamicArray<DynamicArray<Operation>>& operations);
+
+    ContainerSettings::DataType GetRandomKey(size_t size)
+    {
+        return Utils::GetRandomNumber<ContainerSettings::DataType>(0, static_cast<ContainerSettings::DataType>(2 * size));
+    }
+
+    DynamicArray<DynamicArray<Operation>> GenerateOperations(uint32_t numberOfThreads, size_t size, uint32_t readPercentage)
+    {
+        DynamicArray<DynamicArray<Operation>> operations(numberOfThreads);
+        for (auto& threadOperations : operations)
+        {
+            threadOperations = DynamicArray<Operation>(OPERATIONS_PER_THREAD);
+            for (auto& operation : threadOperations)
+            {
+                auto type = Operation::Type::FIND;
+                if (Utils::GetRandomNumber<uint32_t>(1u, 100u) > readPercentage)
+                {
+                    type = Utils::GetRandomNumber<uint32_t>(0u, 1u) == 0u ? Operation::Type::INSERT : Operation::Type::REMOVE;
+                }
+                operation = {type, GetRandomKey(size)};
+            }
+        }
+        return operations;
+    }
+
+    std::string RunBenchmark()
+    {
+        return "All benchmarks for ConcurrentMap:\n" + MixedOperations(99u) + MixedOperations(90u);
+    }
+
+    std::string MixedOperations(uint32_t readPercentage)
+    {
+        std::string result = "Mixed operations test, reads: " + Utils::Parser::NumberToString(readPercentage) + "%: \n";
+        for (const auto& size: ContainerSettings::TEST_SIZES)
+        {
+            result.append("Size: " + Utils::Parser::NumberToString(size) + ":");
+            for (uint32_t threads = 1; threads <= Utils::GetNumberOfThreads(); threads *= 2)
+            {
+                auto[concurrentMapThroughput, lockedMapThroughput] = MixedCase(size, threads, readPercentage);
+                result.append(" " + Utils::Parser::NumberToString(threads) + " threads: ConcurrentMap: " +
+                              Utils::Parser::NumberToString(concurrentMapThroughput) + " ops/ms" +
+                              "; Map with mutex: " + Utils::Parser::NumberToString(lockedMapThroughput) + " ops/ms;");
+            }
+            result += "\n";
+        }
+        return result;
+    }
+
+    TestCaseResult MixedCase(size_t size, uint32_t numberOfThreads, uint32_t readPercentage)
+    {
+        ConcurrentMap<ContainerSettings::DataType, bool> concurrentMap;
+        LockedMap lockedMap;
+        concurrentMap.Update([size](auto& map) {
+            for (size_t i = 0u; i < size; i++)
+            {
+                map.Insert({GetRandomKey(size), true});
+            }
+        });
+        for (size_t i = 0u; i < size; i++)
+        {
+            lockedMap.Insert({GetRandomKey(size), true});
+        }
+
+        int64_t concurrentMapThroughput = 0;
+        int64_t lockedMapThroughput = 0;
+        for (uint32_t i = 0u; i < ContainerSettings::NUMBER_OF_TESTS; i++)
+        {
+            auto operations = GenerateOperations(numberOfThreads, size, readPercentage);
+            concurrentMapThroughput += MeasureThroughput(concurrentMap, operations);
+            lockedMapThroughput += MeasureThroughput(lockedMap, operations);
+        }
+        return TestCaseResult {concurrentMapThroughput / ContainerSettings::NUMBER_OF_TESTS,
+                               lockedMapThroughput / ContainerSettings::NUMBER_OF_TESTS};
+    }
+
+    template<typename T>
+    int64_t MeasureThroughput(T& map, const DynamicArray<DynamicArray<Operation>>& operations)
+    {
+        const auto numberOfThreads = static_cast<uint32_t>(operations.Size());
+        DynamicArray<int64_t> times(numberOfThreads, 0);
+        std::atomic<uint32_t> ready = 0u;
+
+        Utils::ParallelFor(numberOfThreads, [&map, &operations, &times, &ready, numberOfThreads](uint32_t thread) {
+            ready++;
+            while (ready.load() < numberOfThreads)                  // Wszystkie wątki startują razem
+            { }
+
+            Utils::Timer timer;
+            timer.Start();
+
+            size_t found = 0u;
+            for (const auto& operation : operations[thread])
+            {
+                switch (operation.type)
+                {
+                case Operation::Type::FIND:
+                    found += map.Contains(operation.key) ? 1u : 0u;
+                    break;
+                case Operation::Type::INSERT:
+                    map.Insert({operation.key, true});
+                    break;
+                case Operation::Type::REMOVE:
+                    map.Remove(operation.key);
+                    break;
+                }
+            }
+            [[maybe_unused]] volatile auto tmp = found;
+
+            timer.Stop();
+            times[thread] = timer.GetTimeInNanos();
+        });
+
+        int64_t longestTime = 1;
+        for (auto time : times)
+        {
+            longestTime = Utils::Max(longestTime, time);
+        }
+        return static_cast<int64_t>(numberOfThreads * OPERATIONS_PER_THREAD * 1'000'000u) / longestTime;
+    }
+}
\ No newline at end of file
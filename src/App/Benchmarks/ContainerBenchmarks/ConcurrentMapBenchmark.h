@@ -0,0 +1,9 @@
+#pragma once
+
+#include <string>
+
+namespace ConcurrentMapBenchmark
+{
+    std::string RunBenchmark();
+    std::string MixedOperations(uint32_t readPercentage);
+}
\ No newline at end of file
@@ -14,6 +14,14 @@ namespace HeapBenchmark
         int64_t vectorTime;
     };
 
+    struct RemoveElementCaseResult
+    {
+        int64_t valueTime;
+        int64_t handleTime;
+    };
+
+    using TrackedHeap = Heap<ContainerSettings::DataType, Utils::Greater<ContainerSettings::DataType>, true>;
+
     void FillHeap(Heap<ContainerSettings::DataType>& heap, size_t size);
     void FillVectorHeap(std::vector<ContainerSettings::DataType>& vector, size_t size);
 
@@ -28,6 +36,11 @@ namespace HeapBenchmark
     int64_t RemoveHeapTest(size_t size);
     int64_t RemoveVectorHeapTest(size_t size);
 
+    std::string RemoveElement();
+    RemoveElementCaseResult RemoveElementCase(size_t size);
+    int64_t RemoveValueTest(size_t size);
+    int64_t RemoveHandleTest(size_t size);
+
     TestCaseResult FindCase(size_t size);
     int64_t FindHeapTest(size_t size);
     int64_t FindVectorHeapTest(size_t size);
@@ -126,7 +139,7 @@ namespace HeapBenchmark
 
     std::string RemoveElements()
     {
-        return "Remove elements tests: \n" + Remove();
+        return "Remove elements tests: \n" + Remove() + RemoveElement();
     }
 
 
@@ -190,6 +203,71 @@ namespace HeapBenchmark
         return averageTime / ContainerSettings::NUMBER_OF_TESTS;
     }
 
+    std::string RemoveElement()
+    {
+        std::string result = "Remove element test: \n";
+        for (const auto& size: ContainerSettings::TEST_SIZES)
+        {
+            auto[valueTime, handleTime] = RemoveElementCase(size);
+            result.append("Size: " + Utils::Parser::NumberToString(size) +
+                          ": Heap by value: " + Utils::Parser::NumberToString(valueTime) + "ns" +
+                          "; Heap by handle: " + Utils::Parser::NumberToString(handleTime) + "ns\n");
+        }
+        return result;
+    }
+
+    RemoveElementCaseResult RemoveElementCase(size_t size)
+    {
+        auto valueTime = RemoveValueTest(size);
+        auto handleTime = RemoveHandleTest(size);
+
+        return RemoveElementCaseResult {valueTime, handleTime};
+    }
+
+    int64_t RemoveValueTest(size_t size)
+    {
+        int64_t averageTime = 0u;
+        for (uint32_t i = 0u; i < ContainerSettings::NUMBER_OF_TESTS; i++)
+        {
+            Heap<ContainerSettings::DataType> testedHeap;
+            FillHeap(testedHeap, size);
+            auto value = *(testedHeap.cbegin() + Utils::GetRandomNumber<std::ptrdiff_t>(0, static_cast<std::ptrdiff_t>(size) - 1));
+
+            Utils::Timer timer;
+            timer.Start();
+
+            testedHeap.Remove(value);
+
+            timer.Stop();
+            averageTime += timer.GetTimeInNanos();
+        }
+        return averageTime / ContainerSettings::NUMBER_OF_TESTS;
+    }
+
+    int64_t RemoveHandleTest(size_t size)
+    {
+        int64_t averageTime = 0u;
+        for (uint32_t i = 0u; i < ContainerSettings::NUMBER_OF_TESTS; i++)
+        {
+            TrackedHeap testedHeap;
+            DynamicArray<TrackedHeap::Handle> handles;
+            for (size_t j = 0u; j < size; j++)
+            {
+                handles.PushBack(testedHeap.Insert(Utils::GetRandomNumber<ContainerSettings::DataType>(ContainerSettings::MIN_VALUE, ContainerSettings::MAX_VALUE)));
+            }
+            auto handle = handles[Utils::GetRandomNumber<size_t>(0u, size - 1)];
+
+            Utils::Timer timer;
+            timer.Start();
+
+            testedHeap.Remove(handle);
+
+            timer.Stop();
+            averageTime += timer.GetTimeInNanos();
+        }
+        return averageTime / ContainerSettings::NUMBER_OF_TESTS;
+    }
+
 
     std::string FindElements()
     {
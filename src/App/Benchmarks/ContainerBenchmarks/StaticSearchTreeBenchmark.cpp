@@ -0,0 +1,166 @@
+#include "StaticSearchTreeBenchmark.h"
+#include "Containers/StaticSearchTree.h"
+#include "Containers/RedBlackTree.h"
+#include "Containers/BTree.h"
+#include "Utils/Timer.h"
+#include "App/Settings.h"
+
+namespace StaticSearchTreeBenchmark
+{
+    constexpr size_t LOOKUPS_PER_TEST = 1'000u;
+
+    using EytzingerTree = StaticSearchTree<ContainerSettings::DataType>;
+    using STree = StaticSearchTree<ContainerSettings::DataType,
+                                   Utils::Less<ContainerSettings::DataType>,
+                                   StaticSearchTreeLayout::S_TREE>;
+
+    struct TestCaseResult
+    {
+        int64_t eytzingerTime;
+        int64_t sTreeTime;
+        int64_t redBlackTreeTime;
+        int64_t bTreeTime;
+    };
+
+    /**
+     * Every container holds the same values, so they are filled once per size
+     */
+    struct Containers
+    {
+        EytzingerTree eytzingerTree;
+        STree sTree;
+        RedBlackTree<ContainerSettings::DataType> redBlackTree;
+        BTree<ContainerSettings::DataType> bTree;
+    };
+
+    Containers CreateContainers(const DynamicArray<ContainerSettings::DataType>& values);
+    DynamicArray<ContainerSettings::DataType> CreateValues(size_t size);
+    DynamicArray<ContainerSettings::DataType> CreateKeys(const DynamicArray<ContainerSettings::DataType>& values);
+    std::string FormatResult(size_t size, const TestCaseResult& result);
+
+    TestCaseResult FindCase(size_t size);
+    TestCaseResult LowerBoundCase(size_t size);
+
+    template<typename F>
+    int64_t LookupTest(const DynamicArray<ContainerSettings::DataType>& keys, F&& lookup);
+
+    Containers CreateContainers(const DynamicArray<ContainerSettings::DataType>& values)
+    {
+        Containers containers {EytzingerTree(values), STree(values), RedBlackTree<ContainerSettings::DataType>(), BTree<ContainerSettings::DataType>()};
+        for (auto value : values)
+        {
+            containers.redBlackTree.Insert(value);
+            containers.bTree.Insert(value);
+        }
+        return containers;
+    }
+
+    DynamicArray<ContainerSettings::DataType> CreateKeys(const DynamicArray<ContainerSettings::DataType>& values)
+    {
+        DynamicArray<ContainerSettings::DataType> keys;
+        for (size_t i = 0u; i < LOOKUPS_PER_TEST; i++)
+        {
+            if (i % 2 == 0)                                         // Połowa kluczy istnieje w kontenerach
+            {
+                keys.PushBack(values[Utils::GetRandomNumber<size_t>(0u, values.Size() - 1)]);
+            }
+            else
+            {
+                keys.PushBack(Utils::GetRandomNumber<ContainerSettings::DataType>(ContainerSettings::MIN_VALUE, ContainerSettings::MAX_VALUE));
+            }
+        }
+        return keys;
+    }
+
+    DynamicArray<ContainerSettings::DataType> CreateValues(size_t size)
+    {
+        DynamicArray<ContainerSettings::DataType> values;
+        for (size_t i = 0u; i < size; i++)
+        {
+            values.PushBack(Utils::GetRandomNumber<ContainerSettings::DataType>(ContainerSettings::MIN_VALUE, ContainerSettings::MAX_VALUE));
+        }
+        return values;
+    }
+
+    std::string FormatResult(size_t size, const TestCaseResult& result)
+    {
+        return "Size: " + Utils::Parser::NumberToString(size) +
+               ": Eytzinger: " + Utils::Parser::NumberToString(result.eytzingerTime) + "ns" +
+               "; S-tree: " + Utils::Parser::NumberToString(result.sTreeTime) + "ns" +
+               "; RedBlackTree: " + Utils::Parser::NumberToString(result.redBlackTreeTime) + "ns" +
+               "; BTree: " + Utils::Parser::NumberToString(result.bTreeTime) + "ns\n";
+    }
+
+    std::string RunBenchmark()
+    {
+        return "All benchmarks for StaticSearchTree (time per lookup):\n" + FindElements() + LowerBoundElements();
+    }
+
+    std::string FindElements()
+    {
+        std::string result = "Find test: \n";
+        for (const auto& size: ContainerSettings::TEST_SIZES)
+        {
+            result.append(FormatResult(size, FindCase(size)));
+        }
+        return result;
+    }
+
+    std::string LowerBoundElements()
+    {
+        std::string result = "LowerBound test: \n";
+        for (const auto& size: ContainerSettings::TEST_SIZES)
+        {
+            result.append(FormatResult(size, LowerBoundCase(size)));
+        }
+        return result;
+    }
+
+    TestCaseResult FindCase(size_t size)
+    {
+        const auto values = CreateValues(size);
+        const auto keys = CreateKeys(values);
+        const auto containers = CreateContainers(values);
+
+        return TestCaseResult {
+            LookupTest(keys, [&containers](auto key) { return containers.eytzingerTree.Find(key) != nullptr; }),
+            LookupTest(keys, [&containers](auto key) { return containers.sTree.Find(key) != nullptr; }),
+            LookupTest(keys, [&containers](auto key) { return containers.redBlackTree.Find(key) != containers.redBlackTree.end(); }),
+            LookupTest(keys, [&containers](auto key) { return containers.bTree.Find(key) != containers.bTree.end(); })};
+    }
+
+    TestCaseResult LowerBoundCase(size_t size)
+    {
+        const auto values = CreateValues(size);
+        const auto keys = CreateKeys(values);
+        const auto containers = CreateContainers(values);
+
+        return TestCaseResult {
+            LookupTest(keys, [&containers](auto key) { return containers.eytzingerTree.LowerBound(key) != nullptr; }),
+            LookupTest(keys, [&containers](auto key) { return containers.sTree.LowerBound(key) != nullptr; }),
+            LookupTest(keys, [&containers](auto key) { return containers.redBlackTree.LowerBound(key) != containers.redBlackTree.end(); }),
+            LookupTest(keys, [&containers](auto key) { return containers.bTree.LowerBound(key) != containers.bTree.end(); })};
+    }
+
+    template<typename F>
+    int64_t LookupTest(const DynamicArray<ContainerSettings::DataType>& keys, F&& lookup)
+    {
+        int64_t averageTime = 0u;
+        for (uint32_t i = 0u; i < ContainerSettings::NUMBER_OF_TESTS; i++)
+        {
+            Utils::Timer timer;
+            timer.Start();
+
+            size_t found = 0u;
+            for (auto key : keys)
+            {
+                found += lookup(key) ? 1u : 0u;
+            }
+            [[maybe_unused]] volatile auto tmp = found;
+
+            timer.Stop();
+            averageTime += timer.GetTimeInNanos();
+        }
+        return averageTime / static_cast<int64_t>(ContainerSettings::NUMBER_OF_TESTS * LOOKUPS_PER_TEST);
+    }
+}
\ No newline at end of file
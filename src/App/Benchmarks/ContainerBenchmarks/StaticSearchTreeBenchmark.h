@@ -0,0 +1,10 @@
+#pragma once
+
+#include <string>
+
+namespace StaticSearchTreeBenchmark
+{
+    std::string RunBenchmark();
+    std::string FindElements();
+    std::string LowerBoundElements();
+}
\ No newline at end of file
@@ -5,6 +5,9 @@
 #include "App/Benchmarks/ContainerBenchmarks/RedBlackTreeBenchmark.h"
 #include "App/Benchmarks/ContainerBenchmarks/HeapBenchmark.h"
 #include "App/Benchmarks/ContainerBenchmarks/AvlTreeBenchmark.h"
+#include "App/Benchmarks/ContainerBenchmarks/BTreeBenchmark.h"
+#include "App/Benchmarks/ContainerBenchmarks/ConcurrentMapBenchmark.h"
+#include "App/Benchmarks/ContainerBenchmarks/StaticSearchTreeBenchmark.h"
 
 #include "Utils/Timer.h"
 
@@ -25,11 +28,14 @@ void ContainerBenchmarkManager::ContainerMenu(std::ostream& os)
                             "3. Benchmark drzewa czerwono-czarnego\n"
                             "4. Benchmark kopca binarnego\n"
                             "5. Benchmark drzewa AVL\n"
-                            "6. Wszystkie benchmarki\n"
-                            "7. Powrót\n"
+                            "6. Benchmark B-drzewa\n"
+                            "7. Benchmark współbieżnej mapy\n"
+                            "8. Benchmark statycznego drzewa wyszukiwań\n"
+                            "9. Wszystkie benchmarki\n"
+                            "10. Powrót\n"
                             "> ";
 
-    auto choice = Utils::GetChoiceFromMenu(MENU, 1, 7);
+    auto choice = Utils::GetChoiceFromMenu(MENU, 1, 10);
 
     Utils::Timer timer;
     switch (choice)
@@ -55,12 +61,27 @@ void ContainerBenchmarkManager::ContainerMenu(std::ostream& os)
         os << AvlTreeBenchmark::RunBenchmark() << "\n";
         break;
     case 6:
+        timer.Start();
+        os << BTreeBenchmark::RunBenchmark() << "\n";
+        break;
+    case 7:
+        timer.Start();
+        os << ConcurrentMapBenchmark::RunBenchmark() << "\n";
+        break;
+    case 8:
+        timer.Start();
+        os << StaticSearchTreeBenchmark::RunBenchmark() << "\n";
+        break;
+    case 9:
         timer.Start();
         os << DynamicArrayBenchmark::RunBenchmark() << "\n";
         os << ListBenchmark::RunBenchmark() << "\n";
         os << HeapBenchmark::RunBenchmark() << "\n";
         os << RedBlackTreeBenchmark::RunBenchmark() << "\n";
         os << AvlTreeBenchmark::RunBenchmark() << "\n";
+        os << BTreeBenchmark::RunBenchmark() << "\n";
+        os << ConcurrentMapBenchmark::RunBenchmark() << "\n";
+        os << StaticSearchTreeBenchmark::RunBenchmark() << "\n";
         break;
     default:
         return;
@@ -1,4 +1,7 @@
 #include "AlgorithmBenchmarkManager.h"
+#include "App/Benchmarks/AlgorithmBenchmarks/ComponentsBenchmarks/StronglyConnectedComponentsBenchmark.h"
+#include "App/Benchmarks/AlgorithmBenchmarks/GraphBenchmarks/GraphLoadBenchmark.h"
+#include "App/Benchmarks/AlgorithmBenchmarks/MSTBenchmarks/BoruvkaBenchmark.h"
 #include "App/Benchmarks/AlgorithmBenchmarks/MSTBenchmarks/KruskalBenchmark.h"
 #include "App/Benchmarks/AlgorithmBenchmarks/MSTBenchmarks/PrimBenchmark.h"
 #include "App/Benchmarks/AlgorithmBenchmarks/ShortestPathBenchmarks/BellmanFordBenchmark.h"
@@ -21,11 +24,14 @@ void AlgorithmBenchmarkManager::AlgorithmMenu(std::ostream& os)
                             "2. Benchmark algorytmu Prima\n"
                             "3. Benchmark algorytmu Bellmana-Forda\n"
                             "4. Benchmark algorytmu Dijkstry\n"
-                            "5. Wszystkie benchmarki\n"
-                            "6. Powrót\n"
+                            "5. Benchmark wczytywania grafów z pliku\n"
+                            "6. Benchmark algorytmu Borůvki\n"
+                            "7. Benchmark silnie spójnych składowych\n"
+                            "8. Wszystkie benchmarki\n"
+                            "9. Powrót\n"
                             "> ";
 
-    auto choice = Utils::GetChoiceFromMenu(MENU, 1, 6);
+    auto choice = Utils::GetChoiceFromMenu(MENU, 1, 9);
 
     Utils::Timer timer;
     switch (choice)
@@ -47,11 +53,26 @@ void AlgorithmBenchmarkManager::AlgorithmMenu(std::ostream& os)
         os << DijkstraBenchmark::RunBenchmark() << "\n";
         break;
     case 5:
+        timer.Start();
+        os << GraphLoadBenchmark::RunBenchmark() << "\n";
+        break;
+    case 6:
+        timer.Start();
+        os << BoruvkaBenchmark::RunBenchmark() << "\n";
+        break;
+    case 7:
+        timer.Start();
+        os << StronglyConnectedComponentsBenchmark::RunBenchmark() << "\n";
+        break;
+    case 8:
         timer.Start();
         os << KruskalBenchmark::RunBenchmark() << "\n";
         os << PrimBenchmark::RunBenchmark() << "\n";
         os << BellmanFordBenchmark::RunBenchmark() << "\n";
         os << DijkstraBenchmark::RunBenchmark() << "\n";
+        os << GraphLoadBenchmark::RunBenchmark() << "\n";
+        os << BoruvkaBenchmark::RunBenchmark() << "\n";
+        os << StronglyConnectedComponentsBenchmark::RunBenchmark() << "\n";
         break;
     default:
         return;
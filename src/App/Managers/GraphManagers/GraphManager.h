@@ -2,6 +2,7 @@
 
 #include "App/Managers/Manager.h"
 #include "Algorithms/Graphs/GraphGenerator.h"
+#include "Algorithms/Graphs/GraphParser.h"
 #include "Algorithms/Graphs/DirectedGraphs/DirectedGraphConverter.h"
 #include "Algorithms/Graphs/UndirectedGraphs/UndirectedGraphConverter.h"
 
@@ -71,13 +72,10 @@ void GraphManager<T, U, isGraphT, isGraphU>::CreateFromFileMenu()
         return;
     }
 
-    std::ifstream fin(filename.value());
-    auto newListGraph = Utils::GetInput<T>(fin);
-    fin.close();
-
-    fin.open(filename.value());
-    auto newMatrixGraph = Utils::GetInput<U>(fin);
-    fin.close();
+    const auto format = GraphParser::DetectFormat(filename.value());
+    const auto numberOfThreads = Utils::GetNumberOfThreads();
+    auto newListGraph = GraphParser::LoadGraph<T>(filename.value(), format, numberOfThreads);
+    auto newMatrixGraph = GraphParser::LoadGraph<U>(filename.value(), format, numberOfThreads);
 
     if (newListGraph.has_value())
     {
@@ -1,24 +1,34 @@
 #pragma once
 
+#include "DynamicArray.h"
+#include "NodePool.h"
+#include "TreeAugmentation.h"
+#include "Utils/Algorithms.h"
+#include "Utils/Pair.h"
+#include "Utils/Range.h"
 #include "Utils/Utils.h"
 
-template<typename T, typename C>
+#include <iterator>
+#include <type_traits>
+
+template<typename T, typename C, typename A>
 struct AvlTreeIterator;
 
-template<typename T, typename C>
+template<typename T, typename C, typename A>
 struct AvlTreeConstIterator;
 
-template<typename T, typename C = Utils::Less<T>>
+template<typename T, typename C = Utils::Less<T>, typename A = TreeAugmentation::None>
 class AvlTree
 {
 public:
-    friend struct AvlTreeIterator<T, C>;
-    friend struct AvlTreeConstIterator<T, C>;
+    friend struct AvlTreeIterator<T, C, A>;
+    friend struct AvlTreeConstIterator<T, C, A>;
 
     using DataType = T;
     using Comparator = C;
-    using Iterator = AvlTreeIterator<T, C>;
-    using ConstIterator = AvlTreeConstIterator<T, C>;
+    using Augmentation = A;
+    using Iterator = AvlTreeIterator<T, C, A>;
+    using ConstIterator = AvlTreeConstIterator<T, C, A>;
 
     [[nodiscard]] static constexpr const char* ClassName() { return "AvlTree"; }
 
@@ -30,16 +40,96 @@ public:
     AvlTree& operator=(AvlTree&& rhs) noexcept;
     ~AvlTree();
 
+    /**
+     * Builds a perfectly balanced tree in O(n), the range has to be sorted according to the comparator
+     */
+    template<typename It>
+    [[nodiscard]] static AvlTree FromSorted(It first, It last, const Comparator& comparator = Comparator());
+
     Iterator Insert(const DataType& value);
+
+    /**
+     * Sorts the range and merges it with the tree in O(n + m log m),
+     * ranges which are small compared to the tree are inserted one by one
+     */
+    template<typename It>
+    void InsertRange(It first, It last);
+
     bool Remove(const DataType& value);
+
+    /**
+     * Releases all nodes at once if no other tree shares the node pool and elements need no destructor
+     */
     void Clear();
 
     [[nodiscard]] ConstIterator Find(const DataType& value) const noexcept;
     [[nodiscard]] Iterator Find(const DataType& value) noexcept;
 
+    /**
+     * @return first element not less than the value or end()
+     */
+    [[nodiscard]] ConstIterator LowerBound(const DataType& value) const noexcept;
+    [[nodiscard]] Iterator LowerBound(const DataType& value) noexcept;
+
+    /**
+     * @return first element greater than the value or end()
+     */
+    [[nodiscard]] ConstIterator UpperBound(const DataType& value) const noexcept;
+    [[nodiscard]] Iterator UpperBound(const DataType& value) noexcept;
+
+    [[nodiscard]] Utils::Range<ConstIterator> EqualRange(const DataType& value) const noexcept;
+    [[nodiscard]] Utils::Range<Iterator> EqualRange(const DataType& value) noexcept;
+
+    /**
+     * Lazily iterated view of elements in range [lo, hi], empty if hi is less than lo
+     */
+    [[nodiscard]] Utils::Range<ConstIterator> Range(const DataType& lo, const DataType& hi) const noexcept;
+    [[nodiscard]] Utils::Range<Iterator> Range(const DataType& lo, const DataType& hi) noexcept;
+
     [[nodiscard]] const DataType& Min() const noexcept;
     [[nodiscard]] const DataType& Max() const noexcept;
 
+    /**
+     * Requires TreeAugmentation::OrderStatistics
+     * @return k-th smallest element, counting from 0, or end() if the tree has no more than k elements
+     */
+    [[nodiscard]] ConstIterator Select(size_t k) const noexcept;
+    [[nodiscard]] Iterator Select(size_t k) noexcept;
+
+    /**
+     * Requires TreeAugmentation::OrderStatistics
+     * @return number of elements less than the value
+     */
+    [[nodiscard]] size_t Rank(const DataType& value) const noexcept;
+
+    /**
+     * Requires TreeAugmentation::OrderStatistics
+     * @return number of elements in range [lo, hi]
+     */
+    [[nodiscard]] size_t CountRange(const DataType& lo, const DataType& hi) const noexcept;
+
+    /**
+     * Joins trees in O(log n), elements of the left tree have to be not greater than the pivot
+     * and elements of the right tree not less than it. Both trees are left empty
+     */
+    [[nodiscard]] static AvlTree Join(AvlTree&& left, const DataType& pivot, AvlTree&& right);
+
+    /**
+     * Splits the tree in O(log n) into elements less than the value and the rest, the tree is left empty.
+     * Without TreeAugmentation::OrderStatistics counting sizes of the parts takes O(min(k, n - k)).
+     * Parts keep the nodes allocated by the tree, but allocate new ones separately, so they can be modified concurrently
+     */
+    [[nodiscard]] static Utils::Pair<AvlTree, AvlTree> Split(AvlTree&& tree, const DataType& value);
+
+    /**
+     * Set operations in O(m log(n / m + 1)), where m is the size of the smaller tree. Elements of rhs which
+     * are equivalent to an element of lhs are dropped, the result keeps the comparator of lhs.
+     * Both trees are left empty
+     */
+    [[nodiscard]] static AvlTree Union(AvlTree&& lhs, AvlTree&& rhs);
+    [[nodiscard]] static AvlTree Intersection(AvlTree&& lhs, AvlTree&& rhs);
+    [[nodiscard]] static AvlTree Difference(AvlTree&& lhs, AvlTree&& rhs);
+
     [[nodiscard]] size_t Size() const noexcept;
 
     [[nodiscard]] Iterator begin() noexcept;
@@ -51,16 +141,16 @@ public:
 
     [[nodiscard]] std::string ToString() const;
 
-    template<typename U, typename V>
-    friend std::ostream& operator<<(std::ostream& os, const AvlTree<U, V>& tree);
+    template<typename U, typename V, typename W>
+    friend std::ostream& operator<<(std::ostream& os, const AvlTree<U, V, W>& tree);
 
-    template<typename U, typename V>
-    friend std::istream& operator>>(std::istream& is, AvlTree<U, V>& tree);
+    template<typename U, typename V, typename W>
+    friend std::istream& operator>>(std::istream& is, AvlTree<U, V, W>& tree);
 
 private:
     using Height = int8_t;
 
-    struct Node
+    struct Node : Augmentation::NodeData
     {
         Height height;
         DataType value;
@@ -74,49 +164,113 @@ private:
     };
 
     inline static constexpr int64_t NIL_VALUE = -1;
+    inline static constexpr size_t MAX_RESERVED_NODES = 1024;     // Rozmiar ze strumienia nie jest sprawdzony
+    inline static constexpr bool HAS_ORDER_STATISTICS = std::is_base_of_v<TreeAugmentation::OrderStatistics::NodeData, Node>;
 
-    Node* LeftRotate(Node* node) const noexcept;
-    Node* RightRotate(Node* node) const noexcept;
+    Node* LeftRotate(Node* node) noexcept;
+    Node* RightRotate(Node* node) noexcept;
 
-    [[nodiscard]] static Node* MakeNil();
-    [[nodiscard]] Node* MakeNode(const DataType& value) const;
+    /**
+     * Sentinel shared by all trees of the same type, so nodes can be moved between them.
+     * It is never modified, the root is kept in the tree itself
+     */
+    [[nodiscard]] static Node* Nil() noexcept;
+    [[nodiscard]] Node* MakeNode(const DataType& value);
 
-    void SetRoot(Node* node) const noexcept;
+    void SetRoot(Node* node) noexcept;
     [[nodiscard]] Node* Root() const noexcept;
 
     [[nodiscard]] Node* Min(Node* node) const noexcept;
     [[nodiscard]] Node* Max(Node* node) const noexcept;
+    [[nodiscard]] Node* Next(Node* node) const noexcept;
+    [[nodiscard]] Node* Previous(Node* node) const noexcept;
     [[nodiscard]] Node* Find(const DataType& value, Node* root) const noexcept;
-
-    void InsertFix(Node* node) const noexcept;
-    void RemoveFix(Node* node) const noexcept;
-
-    void RemoveSubtree(Node* root);
+    [[nodiscard]] Node* Bound(const DataType& value, bool isUpper) const noexcept;
+    [[nodiscard]] Node* Select(size_t k, Node* root) const noexcept;
+    [[nodiscard]] size_t CountLess(const DataType& value, bool isInclusive) const noexcept;
+
+    void InsertNode(Node* newNode) noexcept;
+    void InsertFix(Node* node) noexcept;
+    void RemoveFix(Node* node) noexcept;
+
+    /**
+     * Releases nodes without recursion, left children are rotated up until the node has none
+     */
+    void RemoveSubtree(Node* root) noexcept;
+
+    /**
+     * Copies nodes in preorder without recursion, walking both trees through parent links
+     */
     [[nodiscard]] Node* CopySubtree(const AvlTree& tree, Node* root);
 
-    [[nodiscard]] Node* RemoveNodeWithoutChildren(Node* node) const;
-    [[nodiscard]] Node* RemoveNodeWithOneChild(Node* node) const;
-    [[nodiscard]] Node* RemoveNodeWithTwoChildren(Node* node) const;
+    /**
+     * Detaches all nodes in order and leaves the tree empty, nothing is deleted
+     */
+    [[nodiscard]] DynamicArray<Node*> ReleaseNodes();
+    void Build(DynamicArray<Node*>& nodes);
+    [[nodiscard]] Node* LinkSubtree(DynamicArray<Node*>& nodes, size_t begin, size_t end, Node* parent) const;
+
+    /**
+     * Subtrees are rebalanced with this tree as a workspace, its root is replaced
+     */
+    [[nodiscard]] Node* TakeSubtree() noexcept;
+    [[nodiscard]] Node* JoinSubtrees(Node* left, Node* pivot, Node* right) noexcept;
+    [[nodiscard]] Node* JoinSubtrees(Node* left, Node* right) noexcept;
+
+    /**
+     * Left part gets elements less than the value, or not greater if isUpper is set
+     */
+    void SplitSubtree(Node* tree, const DataType& value, bool isUpper, Node*& left, Node*& right) noexcept;
+    void SplitSubtree(Node* tree, const DataType& value, Node*& less, Node*& equal, Node*& greater) noexcept;
+
+    [[nodiscard]] Node* UnionSubtrees(Node* lhs, Node* rhs);
+    [[nodiscard]] Node* IntersectSubtrees(Node* lhs, Node* rhs);
+    [[nodiscard]] Node* SubtractSubtrees(Node* lhs, Node* rhs);
+
+    /**
+     * @return size of the first of two trees, which have the given size together
+     */
+    [[nodiscard]] size_t SizeOfFirst(Node* first, Node* second, size_t totalSize) const noexcept;
+
+    /**
+     * Unlinks a node with at most one child without deleting it
+     * @return node from which the tree has to be rebalanced
+     */
+    [[nodiscard]] Node* DetachNode(Node* node) noexcept;
+    [[nodiscard]] Node* RemoveNodeWithoutChildren(Node* node) noexcept;
+    [[nodiscard]] Node* RemoveNodeWithOneChild(Node* node) noexcept;
 
     void ToString(std::string& result, const std::string& prefix, const Node* node, bool isRight) const;
-    void Serialize(std::ostream& os, Node* node) const;
-    [[nodiscard]] Node* Deserialize(std::istream& is, Node* node, size_t& sizeOfTree);
+
+    /**
+     * Writes values in preorder with NIL_VALUE in place of every missing child
+     */
+    void Serialize(std::ostream& os) const;
+
+    /**
+     * Reads the preorder written by Serialize and rebuilds the tree balanced, as heights are not stored
+     */
+    void Deserialize(std::istream& is, size_t sizeOfTree);
+    [[nodiscard]] Node* ReadNode(std::istream& is, Node* parent);
 
     Comparator comparator;
-    Node* NIL = MakeNil();
+    Node* NIL = Nil();
+    Node* root = NIL;
     size_t size = 0;
+    NodePool<Node> pool;
 };
 
-template<typename T, typename C>
+template<typename T, typename C, typename A>
 struct AvlTreeConstIterator
 {
     using iterator_category = std::bidirectional_iterator_tag;
-    using value_type = typename AvlTree<T, C>::DataType;
+    using difference_type = std::ptrdiff_t;
+    using value_type = typename AvlTree<T, C, A>::DataType;
     using pointer = const value_type*;
     using reference = const value_type&;
 
     AvlTreeConstIterator() = default;
-    AvlTreeConstIterator(const AvlTree<T, C>* avlTree, typename AvlTree<T, C>::Node* node) noexcept;
+    AvlTreeConstIterator(const AvlTree<T, C, A>* avlTree, typename AvlTree<T, C, A>::Node* node) noexcept;
 
     [[nodiscard]] reference operator*() const noexcept;
 
@@ -131,19 +285,19 @@ struct AvlTreeConstIterator
     [[nodiscard]] bool operator!=(const AvlTreeConstIterator& rhs) const noexcept;
 
 protected:
-    const AvlTree<T, C>* avlTree;
-    typename AvlTree<T, C>::Node* node;
+    const AvlTree<T, C, A>* avlTree;
+    typename AvlTree<T, C, A>::Node* node;
 };
 
-template<typename T, typename C>
-struct AvlTreeIterator : public AvlTreeConstIterator<T, C>
+template<typename T, typename C, typename A>
+struct AvlTreeIterator : public AvlTreeConstIterator<T, C, A>
 {
     using iterator_category = std::bidirectional_iterator_tag;
-    using value_type = typename AvlTree<T, C>::DataType;
+    using value_type = typename AvlTree<T, C, A>::DataType;
     using pointer = value_type*;
     using reference = value_type&;
 
-    using AvlTreeConstIterator<T, C>::AvlTreeConstIterator;
+    using AvlTreeConstIterator<T, C, A>::AvlTreeConstIterator;
 
     [[nodiscard]] reference operator*() const noexcept;
 
@@ -155,77 +309,160 @@ struct AvlTreeIterator : public AvlTreeConstIterator<T, C>
     AvlTreeIterator operator--(int) noexcept;
 };
 
-template<typename T, typename C>
-AvlTree<T, C>::AvlTree(const Comparator& comparator)
+template<typename T, typename C, typename A>
+AvlTree<T, C, A>::AvlTree(const Comparator& comparator)
     : comparator(comparator)
 { }
 
-template<typename T, typename C>
-AvlTree<T, C>::AvlTree(std::initializer_list<DataType> initList, const Comparator& comparator)
+template<typename T, typename C, typename A>
+AvlTree<T, C, A>::AvlTree(std::initializer_list<DataType> initList, const Comparator& comparator)
     : comparator(comparator)
 {
-    for (const auto& item: initList)
-    {
-        Insert(item);
-    }
+    InsertRange(initList.begin(), initList.end());
 }
 
-template<typename T, typename C>
-AvlTree<T, C>::AvlTree(const AvlTree& rhs)
+template<typename T, typename C, typename A>
+AvlTree<T, C, A>::AvlTree(const AvlTree& rhs)
+    : comparator(rhs.comparator)
 {
+    pool.Reserve(rhs.size);
     SetRoot(CopySubtree(rhs, rhs.Root()));
     size = rhs.size;
 }
 
-template<typename T, typename C>
-AvlTree<T, C>::AvlTree(AvlTree&& rhs) noexcept
+template<typename T, typename C, typename A>
+AvlTree<T, C, A>::AvlTree(AvlTree&& rhs) noexcept
+    : pool(std::move(rhs.pool))
 {
-    NIL = rhs.NIL;
+    root = rhs.root;
     size = rhs.size;
+    comparator = std::move(rhs.comparator);
 
-    rhs.NIL = nullptr;
+    rhs.root = NIL;
     rhs.size = 0u;
 }
 
-template<typename T, typename C>
-AvlTree<T, C>& AvlTree<T, C>::operator=(const AvlTree& rhs)
+template<typename T, typename C, typename A>
+AvlTree<T, C, A>& AvlTree<T, C, A>::operator=(const AvlTree& rhs)
 {
     if (this == &rhs)
     {
         return *this;
     }
     Clear();
+    pool.Reserve(rhs.size);
     SetRoot(CopySubtree(rhs, rhs.Root()));
     size = rhs.size;
+    comparator = rhs.comparator;
 
     return *this;
 }
 
-template<typename T, typename C>
-AvlTree<T, C>& AvlTree<T, C>::operator=(AvlTree&& rhs) noexcept
+template<typename T, typename C, typename A>
+AvlTree<T, C, A>& AvlTree<T, C, A>::operator=(AvlTree&& rhs) noexcept
 {
+    if (this == &rhs)
+    {
+        return *this;
+    }
     Clear();
-    NIL = rhs.NIL;
+    root = rhs.root;
     size = rhs.size;
+    comparator = std::move(rhs.comparator);
+    pool = std::move(rhs.pool);
 
-    rhs.NIL = nullptr;
+    rhs.root = NIL;
     rhs.size = 0u;
 
     return *this;
 }
 
-template<typename T, typename C>
-AvlTree<T, C>::~AvlTree()
+template<typename T, typename C, typename A>
+AvlTree<T, C, A>::~AvlTree()
 {
     Clear();
-    delete NIL;
-    NIL = nullptr;
 }
 
-template<typename T, typename C>
-typename AvlTree<T, C>::Iterator AvlTree<T, C>::Insert(const DataType& value)
+template<typename T, typename C, typename A>
+template<typename It>
+AvlTree<T, C, A> AvlTree<T, C, A>::FromSorted(It first, It last, const Comparator& comparator)
+{
+    AvlTree tree(comparator);
+    DynamicArray<Node*> nodes(static_cast<size_t>(std::distance(first, last)));
+    tree.pool.Reserve(nodes.Size());
+
+    for (size_t i = 0; first != last; ++first, i++)
+    {
+        nodes[i] = tree.MakeNode(*first);
+    }
+    tree.Build(nodes);
+
+    return tree;
+}
+
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Iterator AvlTree<T, C, A>::Insert(const DataType& value)
 {
     Node* newNode = MakeNode(value);
+    InsertNode(newNode);
+
+    return {this, newNode};
+}
+
+template<typename T, typename C, typename A>
+template<typename It>
+void AvlTree<T, C, A>::InsertRange(It first, It last)
+{
+    DynamicArray<Node*> inserted(static_cast<size_t>(std::distance(first, last)));
+    pool.Reserve(inserted.Size());
+    for (size_t i = 0; first != last; ++first, i++)
+    {
+        inserted[i] = MakeNode(*first);
+    }
+
+    size_t height = 1;
+    while ((size_t{1} << height) <= size)
+    {
+        height++;
+    }
+    if (inserted.Size() * height < size)
+    {
+        for (auto* node : inserted)
+        {
+            InsertNode(node);
+        }
+        return;
+    }
+
+    const auto compareNodes = [this](const Node* lhs, const Node* rhs) {
+        return comparator(lhs->value, rhs->value);
+    };
+    DynamicArray<Node*> buffer(inserted.Size());
+    Utils::MergeSort(inserted.begin(), inserted.end(), buffer.begin(), compareNodes);
+
+    auto existing = ReleaseNodes();
+    DynamicArray<Node*> merged(existing.Size() + inserted.Size());
+    size_t left = 0;
+    size_t right = 0;
+
+    for (auto& node : merged)
+    {
+        if (right == inserted.Size() || (left < existing.Size() && !compareNodes(inserted[right], existing[left])))
+        {
+            node = existing[left++];
+        }
+        else
+        {
+            node = inserted[right++];
+        }
+    }
+
+    Build(merged);
+}
+
+template<typename T, typename C, typename A>
+void AvlTree<T, C, A>::InsertNode(Node* newNode) noexcept
+{
     Node* parent = NIL;
     Node* iterator = Root();
 
@@ -235,7 +472,7 @@ typename AvlTree<T, C>::Iterator AvlTree<T, C>::Insert(const DataType& value)
     {
         parent = iterator;
 
-        if (comparator(value, iterator->value))
+        if (comparator(newNode->value, iterator->value))
         {
             iterator = iterator->left;
         }
@@ -244,7 +481,11 @@ typename AvlTree<T, C>::Iterator AvlTree<T, C>::Insert(const DataType& value)
             iterator = iterator->right;
         }
     }
-    if (comparator(value, parent->value))
+    if (parent == NIL)
+    {
+        SetRoot(newNode);
+    }
+    else if (comparator(newNode->value, parent->value))
     {
         parent->left = newNode;
     }
@@ -254,13 +495,12 @@ typename AvlTree<T, C>::Iterator AvlTree<T, C>::Insert(const DataType& value)
     }
     newNode->parent = parent;
 
+    Augmentation::Update(newNode);
     InsertFix(newNode);
-
-    return {this, newNode};
 }
 
-template<typename T, typename C>
-bool AvlTree<T, C>::Remove(const DataType& value)
+template<typename T, typename C, typename A>
+bool AvlTree<T, C, A>::Remove(const DataType& value)
 {
     Node* nodeToRemove = Find(value, Root());
     if (nodeToRemove == NIL)
@@ -270,125 +510,272 @@ bool AvlTree<T, C>::Remove(const DataType& value)
 
     size--;
 
-    Node* successor;
-    if (nodeToRemove->left == NIL && nodeToRemove->right == NIL)
+    if (nodeToRemove->left != NIL && nodeToRemove->right != NIL)
     {
-        successor = RemoveNodeWithoutChildren(nodeToRemove);
+        Node* predecessor = Max(nodeToRemove->left);
+        Utils::Swap(predecessor->value, nodeToRemove->value);
+        nodeToRemove = predecessor;
     }
 
-    else if (nodeToRemove->left == NIL || nodeToRemove->right == NIL)
-    {
-        successor = RemoveNodeWithOneChild(nodeToRemove);
-    }
-
-    else
-    {
-        successor = RemoveNodeWithTwoChildren(nodeToRemove);
-    }
-
-    RemoveFix(successor);
+    RemoveFix(DetachNode(nodeToRemove));
+    pool.Release(nodeToRemove);
 
     return true;
 }
 
-template<typename T, typename C>
-void AvlTree<T, C>::Clear()
+template<typename T, typename C, typename A>
+void AvlTree<T, C, A>::Clear()
 {
-    if (NIL != nullptr)
+    if (!pool.IsUnique() || !std::is_trivially_destructible_v<Node>)
     {
         RemoveSubtree(Root());
-        NIL->left = NIL;
     }
+    pool.Reset();
+    root = NIL;
+    size = 0u;
 }
 
-template<typename T, typename C>
-typename AvlTree<T, C>::ConstIterator AvlTree<T, C>::Find(const DataType& value) const noexcept
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::ConstIterator AvlTree<T, C, A>::Find(const DataType& value) const noexcept
 {
     return {this, Find(value, Root())};
 }
 
-template<typename T, typename C>
-typename AvlTree<T, C>::Iterator AvlTree<T, C>::Find(const DataType& value) noexcept
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Iterator AvlTree<T, C, A>::Find(const DataType& value) noexcept
 {
     return {this, Find(value, Root())};
 }
 
-template<typename T, typename C>
-const typename AvlTree<T, C>::DataType& AvlTree<T, C>::Min() const noexcept
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::ConstIterator AvlTree<T, C, A>::LowerBound(const DataType& value) const noexcept
+{
+    return {this, Bound(value, false)};
+}
+
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Iterator AvlTree<T, C, A>::LowerBound(const DataType& value) noexcept
+{
+    return {this, Bound(value, false)};
+}
+
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::ConstIterator AvlTree<T, C, A>::UpperBound(const DataType& value) const noexcept
+{
+    return {this, Bound(value, true)};
+}
+
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Iterator AvlTree<T, C, A>::UpperBound(const DataType& value) noexcept
+{
+    return {this, Bound(value, true)};
+}
+
+template<typename T, typename C, typename A>
+Utils::Range<typename AvlTree<T, C, A>::ConstIterator> AvlTree<T, C, A>::EqualRange(const DataType& value) const noexcept
+{
+    return {LowerBound(value), UpperBound(value)};
+}
+
+template<typename T, typename C, typename A>
+Utils::Range<typename AvlTree<T, C, A>::Iterator> AvlTree<T, C, A>::EqualRange(const DataType& value) noexcept
+{
+    return {LowerBound(value), UpperBound(value)};
+}
+
+template<typename T, typename C, typename A>
+Utils::Range<typename AvlTree<T, C, A>::ConstIterator> AvlTree<T, C, A>::Range(const DataType& lo, const DataType& hi) const noexcept
+{
+    if (comparator(hi, lo))
+    {
+        return {end(), end()};
+    }
+    return {LowerBound(lo), UpperBound(hi)};
+}
+
+template<typename T, typename C, typename A>
+Utils::Range<typename AvlTree<T, C, A>::Iterator> AvlTree<T, C, A>::Range(const DataType& lo, const DataType& hi) noexcept
+{
+    if (comparator(hi, lo))
+    {
+        return {end(), end()};
+    }
+    return {LowerBound(lo), UpperBound(hi)};
+}
+
+template<typename T, typename C, typename A>
+const typename AvlTree<T, C, A>::DataType& AvlTree<T, C, A>::Min() const noexcept
 {
     return Min(Root())->value;
 }
 
-template<typename T, typename C>
-const typename AvlTree<T, C>::DataType& AvlTree<T, C>::Max() const noexcept
+template<typename T, typename C, typename A>
+const typename AvlTree<T, C, A>::DataType& AvlTree<T, C, A>::Max() const noexcept
 {
     return Max(Root())->value;
 }
 
-template<typename T, typename C>
-size_t AvlTree<T, C>::Size() const noexcept
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::ConstIterator AvlTree<T, C, A>::Select(size_t k) const noexcept
+{
+    return {this, Select(k, Root())};
+}
+
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Iterator AvlTree<T, C, A>::Select(size_t k) noexcept
+{
+    return {this, Select(k, Root())};
+}
+
+template<typename T, typename C, typename A>
+size_t AvlTree<T, C, A>::Rank(const DataType& value) const noexcept
+{
+    return CountLess(value, false);
+}
+
+template<typename T, typename C, typename A>
+size_t AvlTree<T, C, A>::CountRange(const DataType& lo, const DataType& hi) const noexcept
+{
+    if (comparator(hi, lo))
+    {
+        return 0;
+    }
+    return CountLess(hi, true) - CountLess(lo, false);
+}
+
+template<typename T, typename C, typename A>
+AvlTree<T, C, A> AvlTree<T, C, A>::Join(AvlTree&& left, const DataType& pivot, AvlTree&& right)
+{
+    AvlTree tree(left.comparator);
+    tree.pool.Merge(std::move(left.pool));
+    tree.pool.Merge(std::move(right.pool));
+    Node* pivotNode = tree.MakeNode(pivot);
+    tree.size = left.size + right.size + 1;
+    tree.SetRoot(tree.JoinSubtrees(left.TakeSubtree(), pivotNode, right.TakeSubtree()));
+
+    return tree;
+}
+
+template<typename T, typename C, typename A>
+Utils::Pair<AvlTree<T, C, A>, AvlTree<T, C, A>> AvlTree<T, C, A>::Split(AvlTree&& tree, const DataType& value)
+{
+    Utils::Pair<AvlTree, AvlTree> parts {AvlTree(tree.comparator), AvlTree(tree.comparator)};
+    const size_t size = tree.size;
+    Node* left;
+    Node* right;
+
+    parts.first.SplitSubtree(tree.TakeSubtree(), value, false, left, right);
+    parts.first.SetRoot(left);
+    parts.second.SetRoot(right);
+    parts.second.pool.Share(tree.pool);
+    parts.first.pool = std::move(tree.pool);
+
+    parts.first.size = parts.first.SizeOfFirst(left, right, size);
+    parts.second.size = size - parts.first.size;
+
+    return parts;
+}
+
+template<typename T, typename C, typename A>
+AvlTree<T, C, A> AvlTree<T, C, A>::Union(AvlTree&& lhs, AvlTree&& rhs)
+{
+    AvlTree tree(lhs.comparator);
+    tree.pool.Merge(std::move(lhs.pool));
+    tree.pool.Merge(std::move(rhs.pool));
+    tree.size = lhs.size + rhs.size;
+    tree.SetRoot(tree.UnionSubtrees(lhs.TakeSubtree(), rhs.TakeSubtree()));
+
+    return tree;
+}
+
+template<typename T, typename C, typename A>
+AvlTree<T, C, A> AvlTree<T, C, A>::Intersection(AvlTree&& lhs, AvlTree&& rhs)
+{
+    AvlTree tree(lhs.comparator);
+    tree.pool.Merge(std::move(lhs.pool));
+    tree.pool.Merge(std::move(rhs.pool));
+    tree.size = lhs.size + rhs.size;
+    tree.SetRoot(tree.IntersectSubtrees(lhs.TakeSubtree(), rhs.TakeSubtree()));
+
+    return tree;
+}
+
+template<typename T, typename C, typename A>
+AvlTree<T, C, A> AvlTree<T, C, A>::Difference(AvlTree&& lhs, AvlTree&& rhs)
+{
+    AvlTree tree(lhs.comparator);
+    tree.pool.Merge(std::move(lhs.pool));
+    tree.pool.Merge(std::move(rhs.pool));
+    tree.size = lhs.size + rhs.size;
+    tree.SetRoot(tree.SubtractSubtrees(lhs.TakeSubtree(), rhs.TakeSubtree()));
+
+    return tree;
+}
+
+template<typename T, typename C, typename A>
+size_t AvlTree<T, C, A>::Size() const noexcept
 {
     return size;
 }
 
-template<typename T, typename C>
-typename AvlTree<T, C>::Iterator AvlTree<T, C>::begin() noexcept
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Iterator AvlTree<T, C, A>::begin() noexcept
 {
     return {this, Min(Root())};
 }
 
-template<typename T, typename C>
-typename AvlTree<T, C>::Iterator AvlTree<T, C>::end() noexcept
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Iterator AvlTree<T, C, A>::end() noexcept
 {
     return {this, NIL};
 }
 
-template<typename T, typename C>
-typename AvlTree<T, C>::ConstIterator AvlTree<T, C>::begin() const noexcept
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::ConstIterator AvlTree<T, C, A>::begin() const noexcept
 {
     return {this, Min(Root())};
 }
 
-template<typename T, typename C>
-typename AvlTree<T, C>::ConstIterator AvlTree<T, C>::end() const noexcept
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::ConstIterator AvlTree<T, C, A>::end() const noexcept
 {
     return {this, NIL};
 }
 
-template<typename T, typename C>
-typename AvlTree<T, C>::ConstIterator AvlTree<T, C>::cbegin() const noexcept
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::ConstIterator AvlTree<T, C, A>::cbegin() const noexcept
 {
     return {this, Min(Root())};
 }
 
-template<typename T, typename C>
-typename AvlTree<T, C>::ConstIterator AvlTree<T, C>::cend() const noexcept
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::ConstIterator AvlTree<T, C, A>::cend() const noexcept
 {
     return {this, NIL};
 }
 
-template<typename T, typename C>
-std::string AvlTree<T, C>::ToString() const
+template<typename T, typename C, typename A>
+std::string AvlTree<T, C, A>::ToString() const
 {
     std::string result = "\n";
     ToString(result, "", Root(), false);
     return result;
 }
 
-template<typename T, typename C>
-std::ostream& operator<<(std::ostream& os, const AvlTree<T, C>& tree)
+template<typename T, typename C, typename A>
+std::ostream& operator<<(std::ostream& os, const AvlTree<T, C, A>& tree)
 {
     if (os.fail())
     {
         return os;
     }
     os << tree.Size() << "\n";
-    tree.Serialize(os, tree.Root());
+    tree.Serialize(os);
     return os;
 }
 
-template<typename T, typename C>
-std::istream& operator>>(std::istream& is, AvlTree<T, C>& tree)
+template<typename T, typename C, typename A>
+std::istream& operator>>(std::istream& is, AvlTree<T, C, A>& tree)
 {
     if (is.fail())
     {
@@ -396,24 +783,24 @@ std::istream& operator>>(std::istream& is, AvlTree<T, C>& tree)
     }
     size_t size;
     is >> size;
-    tree.SetRoot(tree.Deserialize(is, tree.NIL, size));
+    tree.Deserialize(is, size);
     return is;
 }
 
-template<typename T, typename C>
-typename AvlTree<T, C>::Height AvlTree<T, C>::Node::BalanceFactor() const noexcept
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Height AvlTree<T, C, A>::Node::BalanceFactor() const noexcept
 {
     return static_cast<Height>(left->height - right->height);
 }
 
-template<typename T, typename C>
-void AvlTree<T, C>::Node::UpdateHeight() noexcept
+template<typename T, typename C, typename A>
+void AvlTree<T, C, A>::Node::UpdateHeight() noexcept
 {
     height = static_cast<Height>(1 + Utils::Max(left->height, right->height));
 }
 
-template<typename T, typename C>
-typename AvlTree<T, C>::Node* AvlTree<T, C>::LeftRotate(Node* node) const noexcept
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Node* AvlTree<T, C, A>::LeftRotate(Node* node) noexcept
 {
     Node* child = node->right;
     Node* grandChild = child->left;
@@ -421,7 +808,11 @@ typename AvlTree<T, C>::Node* AvlTree<T, C>::LeftRotate(Node* node) const noexce
     child->left = node;
     child->parent = node->parent;
 
-    if (node->parent->left == node)
+    if (node->parent == NIL)
+    {
+        SetRoot(child);
+    }
+    else if (node->parent->left == node)
     {
         child->parent->left = child;
     }
@@ -440,19 +831,25 @@ typename AvlTree<T, C>::Node* AvlTree<T, C>::LeftRotate(Node* node) const noexce
 
     node->UpdateHeight();
     child->UpdateHeight();
+    Augmentation::Update(node);
+    Augmentation::Update(child);
 
     return child;
 }
 
-template<typename T, typename C>
-typename AvlTree<T, C>::Node* AvlTree<T, C>::RightRotate(Node* node) const noexcept
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Node* AvlTree<T, C, A>::RightRotate(Node* node) noexcept
 {
     Node* child = node->left;
     Node* grandChild = child->right;
 
     child->right = node;
     child->parent = node->parent;
-    if (node->parent->left == node)
+    if (node->parent == NIL)
+    {
+        SetRoot(child);
+    }
+    else if (node->parent->left == node)
     {
         child->parent->left = child;
     }
@@ -470,53 +867,56 @@ typename AvlTree<T, C>::Node* AvlTree<T, C>::RightRotate(Node* node) const noexc
 
     node->UpdateHeight();
     child->UpdateHeight();
+    Augmentation::Update(node);
+    Augmentation::Update(child);
 
     return child;
 }
 
-template<typename T, typename C>
-typename AvlTree<T, C>::Node* AvlTree<T, C>::MakeNil()
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Node* AvlTree<T, C, A>::Nil() noexcept
 {
-    Node* nil = new Node {-1,           // height
-                          DataType(),   // value
-                          nullptr,      // left
-                          nullptr,      // right
-                          nullptr};     // parent
-
-    nil->left = nil;
-    nil->right = nil;
-    nil->parent = nil;
-
-    return nil;
+    static Node nil {{},           // augmentation
+                     -1,           // height
+                     DataType(),   // value
+                     &nil,         // left
+                     &nil,         // right
+                     &nil};        // parent
+
+    return &nil;
 }
 
-template<typename T, typename C>
-typename AvlTree<T, C>::Node* AvlTree<T, C>::MakeNode(const DataType& value) const
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Node* AvlTree<T, C, A>::MakeNode(const DataType& value)
 {
-    Node* node = new Node {0,       // height
-                           value,   // value
-                           NIL,     // left
-                           NIL,     // right
-                           NIL};    // parent
+    Node* node = new (pool.Allocate()) Node {{},      // augmentation
+                                             0,       // height
+                                             value,   // value
+                                             NIL,     // left
+                                             NIL,     // right
+                                             NIL};    // parent
 
     return node;
 }
 
-template<typename T, typename C>
-void AvlTree<T, C>::SetRoot(AvlTree::Node* node) const noexcept
+template<typename T, typename C, typename A>
+void AvlTree<T, C, A>::SetRoot(AvlTree::Node* node) noexcept
 {
-    NIL->left = node;
-    node->parent = NIL;
+    root = node;
+    if (node != NIL)
+    {
+        node->parent = NIL;
+    }
 }
 
-template<typename T, typename C>
-typename AvlTree<T, C>::Node* AvlTree<T, C>::Root() const noexcept
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Node* AvlTree<T, C, A>::Root() const noexcept
 {
-    return NIL->left;
+    return root;
 }
 
-template<typename T, typename C>
-typename AvlTree<T, C>::Node* AvlTree<T, C>::Min(AvlTree::Node* node) const noexcept
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Node* AvlTree<T, C, A>::Min(AvlTree::Node* node) const noexcept
 {
     while (node->left != NIL)
     {
@@ -525,8 +925,8 @@ typename AvlTree<T, C>::Node* AvlTree<T, C>::Min(AvlTree::Node* node) const noex
     return node;
 }
 
-template<typename T, typename C>
-typename AvlTree<T, C>::Node* AvlTree<T, C>::Max(AvlTree::Node* node) const noexcept
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Node* AvlTree<T, C, A>::Max(AvlTree::Node* node) const noexcept
 {
     while (node->right != NIL)
     {
@@ -535,8 +935,36 @@ typename AvlTree<T, C>::Node* AvlTree<T, C>::Max(AvlTree::Node* node) const noex
     return node;
 }
 
-template<typename T, typename C>
-typename AvlTree<T, C>::Node* AvlTree<T, C>::Find(const DataType& value, Node* root) const noexcept
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Node* AvlTree<T, C, A>::Next(Node* node) const noexcept
+{
+    if (node->right != NIL)
+    {
+        return Min(node->right);
+    }
+    while (node->parent != NIL && node == node->parent->right)
+    {
+        node = node->parent;
+    }
+    return node->parent;
+}
+
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Node* AvlTree<T, C, A>::Previous(Node* node) const noexcept
+{
+    if (node->left != NIL)
+    {
+        return Max(node->left);
+    }
+    while (node->parent != NIL && node == node->parent->left)
+    {
+        node = node->parent;
+    }
+    return node->parent;
+}
+
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Node* AvlTree<T, C, A>::Find(const DataType& value, Node* root) const noexcept
 {
     while (root != NIL)
     {
@@ -556,22 +984,89 @@ typename AvlTree<T, C>::Node* AvlTree<T, C>::Find(const DataType& value, Node* r
     return NIL;
 }
 
-template<typename T, typename C>
-void AvlTree<T, C>::InsertFix(Node* node) const noexcept
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Node* AvlTree<T, C, A>::Bound(const DataType& value, bool isUpper) const noexcept
+{
+    Node* bound = NIL;
+    Node* node = Root();
+    while (node != NIL)
+    {
+        if (isUpper ? comparator(value, node->value) : !comparator(node->value, value))
+        {
+            bound = node;
+            node = node->left;
+        }
+        else
+        {
+            node = node->right;
+        }
+    }
+    return bound;
+}
+
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Node* AvlTree<T, C, A>::Select(size_t k, Node* root) const noexcept
+{
+    static_assert(HAS_ORDER_STATISTICS, "Select requires TreeAugmentation::OrderStatistics");
+
+    while (root != NIL)
+    {
+        const auto leftSize = root->left->subtreeSize;
+        if (k < leftSize)
+        {
+            root = root->left;
+        }
+        else if (k > leftSize)
+        {
+            k -= leftSize + 1;
+            root = root->right;
+        }
+        else
+        {
+            return root;
+        }
+    }
+    return NIL;
+}
+
+template<typename T, typename C, typename A>
+size_t AvlTree<T, C, A>::CountLess(const DataType& value, bool isInclusive) const noexcept
+{
+    static_assert(HAS_ORDER_STATISTICS, "Rank and CountRange require TreeAugmentation::OrderStatistics");
+
+    size_t count = 0;
+    Node* node = Root();
+    while (node != NIL)
+    {
+        if (comparator(node->value, value) || (isInclusive && !comparator(value, node->value)))
+        {
+            count += node->left->subtreeSize + 1;
+            node = node->right;
+        }
+        else
+        {
+            node = node->left;
+        }
+    }
+    return count;
+}
+
+template<typename T, typename C, typename A>
+void AvlTree<T, C, A>::InsertFix(Node* node) noexcept
 {
     Node* parent = node->parent;
     Node* child = node;
-    DataType value = node->value;
 
     while (parent != NIL)
     {
         parent->UpdateHeight();
+        Augmentation::Update(parent);
         Height balance = parent->BalanceFactor();
 
         if (balance > 1)                                    // Jeżeli ciężar jest lewej stronie
         {
-            if (!comparator(parent->left->value, value))    // Jeżeli wartość jest mniejsza bądź równa
-            {                                               // wartości lewego dziecka rodzica
+            if (parent->left->BalanceFactor() >= 0)         // Jeżeli ciężar lewego dziecka rodzica
+            {                                               // jest po lewej stronie
                 parent = RightRotate(parent);               // dokonaj rotacji RR na rodzicu
             }
             else                                            // W przeciwnym przypadku
@@ -582,8 +1077,8 @@ void AvlTree<T, C>::InsertFix(Node* node) const noexcept
         }
         else if (balance < -1)                              // Jeżeli ciężar jest po prawej stronie
         {
-            if (comparator(value, parent->right->value))    // Jeżeli wartość jest mniejsza od
-            {                                               // wartości prawego dziecka rodzica
+            if (parent->right->BalanceFactor() > 0)         // Jeżeli ciężar prawego dziecka rodzica
+            {                                               // jest po lewej stronie
                 parent->right = RightRotate(parent->right); // dokonaj rotacji RL
                 parent = LeftRotate(parent);                //
             }
@@ -599,14 +1094,15 @@ void AvlTree<T, C>::InsertFix(Node* node) const noexcept
     SetRoot(child);
 }
 
-template<typename T, typename C>
-void AvlTree<T, C>::RemoveFix(Node* node) const noexcept
+template<typename T, typename C, typename A>
+void AvlTree<T, C, A>::RemoveFix(Node* node) noexcept
 {
     Node* child = Root();
 
     while (node != NIL)
     {
         node->UpdateHeight();
+        Augmentation::Update(node);
         Height balance = node->BalanceFactor();
 
         if (balance > 1)                                // Jeżeli ciężar jest lewej stronie
@@ -639,49 +1135,92 @@ void AvlTree<T, C>::RemoveFix(Node* node) const noexcept
     SetRoot(child);
 }
 
-template<typename T, typename C>
-void AvlTree<T, C>::RemoveSubtree(AvlTree::Node* root)
+template<typename T, typename C, typename A>
+void AvlTree<T, C, A>::RemoveSubtree(AvlTree::Node* root) noexcept
 {
-    if (root == NIL)
+    while (root != NIL)
     {
-        return;
+        if (root->left != NIL)
+        {
+            Node* left = root->left;
+            root->left = left->right;
+            left->right = root;
+            root = left;
+        }
+        else
+        {
+            Node* right = root->right;
+            pool.Release(root);
+            root = right;
+            size--;
+        }
     }
-
-    RemoveSubtree(root->left);
-    RemoveSubtree(root->right);
-
-    delete root;
-    root = nullptr;
-    size--;
 }
 
-template<typename T, typename C>
-typename AvlTree<T, C>::Node* AvlTree<T, C>::CopySubtree(const AvlTree& tree, AvlTree::Node* root)
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Node* AvlTree<T, C, A>::CopySubtree(const AvlTree& tree, AvlTree::Node* root)
 {
     if (root == tree.NIL)
     {
         return NIL;
     }
 
-    Node* newRoot = new Node {};
-    newRoot->value = root->value;
+    Node* newRoot = MakeNode(root->value);
     newRoot->height = root->height;
 
-    newRoot->left = CopySubtree(tree, root->left);
-    newRoot->left->parent = newRoot;
+    Node* node = root;
+    Node* copy = newRoot;
+    while (copy != NIL)
+    {
+        Node* child = NIL;
+        if (node->left != tree.NIL && copy->left == NIL)                // Dziecko zostało już skopiowane, jeśli
+        {                                                               // kopia ma je podpięte
+            child = copy->left = MakeNode(node->left->value);
+            node = node->left;
+        }
+        else if (node->right != tree.NIL && copy->right == NIL)
+        {
+            child = copy->right = MakeNode(node->right->value);
+            node = node->right;
+        }
 
-    newRoot->right = CopySubtree(tree, root->right);
-    newRoot->right->parent = newRoot;
+        if (child != NIL)
+        {
+            child->height = node->height;
+            child->parent = copy;
+            copy = child;
+        }
+        else
+        {
+            Augmentation::Update(copy);
+            node = node->parent;
+            copy = copy->parent;
+        }
+    }
 
     return newRoot;
 }
 
-template<typename T, typename C>
-typename AvlTree<T, C>::Node* AvlTree<T, C>::RemoveNodeWithoutChildren(Node* nodeToRemove) const
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Node* AvlTree<T, C, A>::DetachNode(Node* node) noexcept
+{
+    if (node->left == NIL && node->right == NIL)
+    {
+        return RemoveNodeWithoutChildren(node);
+    }
+    return RemoveNodeWithOneChild(node);
+}
+
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Node* AvlTree<T, C, A>::RemoveNodeWithoutChildren(Node* nodeToRemove) noexcept
 {
     Node* successor = nodeToRemove->parent;
 
-    if (nodeToRemove->parent->left == nodeToRemove)
+    if (nodeToRemove->parent == NIL)
+    {
+        SetRoot(NIL);
+    }
+    else if (nodeToRemove->parent->left == nodeToRemove)
     {
         nodeToRemove->parent->left = NIL;
     }
@@ -690,19 +1229,20 @@ typename AvlTree<T, C>::Node* AvlTree<T, C>::RemoveNodeWithoutChildren(Node* nod
         nodeToRemove->parent->right = NIL;
     }
 
-    delete nodeToRemove;
-    nodeToRemove = nullptr;
-
     return successor;
 }
 
-template<typename T, typename C>
-typename AvlTree<T, C>::Node* AvlTree<T, C>::RemoveNodeWithOneChild(Node* nodeToRemove) const
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Node* AvlTree<T, C, A>::RemoveNodeWithOneChild(Node* nodeToRemove) noexcept
 {
     Node* successor = nodeToRemove->left != NIL ? nodeToRemove->left : nodeToRemove->right;
     successor->parent = nodeToRemove->parent;
 
-    if (nodeToRemove->parent->left == nodeToRemove)
+    if (nodeToRemove->parent == NIL)
+    {
+        SetRoot(successor);
+    }
+    else if (nodeToRemove->parent->left == nodeToRemove)
     {
         successor->parent->left = successor;
     }
@@ -711,32 +1251,275 @@ typename AvlTree<T, C>::Node* AvlTree<T, C>::RemoveNodeWithOneChild(Node* nodeTo
         successor->parent->right = successor;
     }
 
-    delete nodeToRemove;
-    nodeToRemove = nullptr;
-
     return successor;
 }
 
-template<typename T, typename C>
-typename AvlTree<T, C>::Node* AvlTree<T, C>::RemoveNodeWithTwoChildren(Node* node) const
+template<typename T, typename C, typename A>
+DynamicArray<typename AvlTree<T, C, A>::Node*> AvlTree<T, C, A>::ReleaseNodes()
+{
+    DynamicArray<Node*> nodes(size);
+    size_t i = 0;
+
+    for (Node* node = Min(Root()); node != NIL; node = Next(node))
+    {
+        nodes[i++] = node;
+    }
+
+    root = NIL;
+    size = 0u;
+    return nodes;
+}
+
+template<typename T, typename C, typename A>
+void AvlTree<T, C, A>::Build(DynamicArray<Node*>& nodes)
 {
-    Node* successor = Max(node->left);
-    Utils::Swap(successor->value, node->value);
+    size = nodes.Size();
+    SetRoot(LinkSubtree(nodes, 0, size, NIL));
+}
 
-    if (successor->left == NIL && successor->right == NIL)
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Node* AvlTree<T, C, A>::LinkSubtree(DynamicArray<Node*>& nodes,
+                                                        size_t begin,
+                                                        size_t end,
+                                                        Node* parent) const
+{
+    if (begin == end)
     {
-        successor = RemoveNodeWithoutChildren(successor);
+        return NIL;
     }
 
-    else if (successor->left == NIL || successor->right == NIL)
+    const auto middle = begin + (end - begin) / 2;
+    Node* root = nodes[middle];
+
+    root->parent = parent;
+    root->left = LinkSubtree(nodes, begin, middle, root);
+    root->right = LinkSubtree(nodes, middle + 1, end, root);
+    root->UpdateHeight();
+    Augmentation::Update(root);
+
+    return root;
+}
+
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Node* AvlTree<T, C, A>::TakeSubtree() noexcept
+{
+    Node* tree = Root();
+    root = NIL;
+    size = 0u;
+    return tree;
+}
+
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Node* AvlTree<T, C, A>::JoinSubtrees(Node* left, Node* pivot, Node* right) noexcept
+{
+    if (Utils::Abs(left->height - right->height) <= 1)
     {
-        successor = RemoveNodeWithOneChild(successor);
+        pivot->left = left;
+        pivot->right = right;
+        for (Node* node : {left, right})
+        {
+            if (node != NIL)
+            {
+                node->parent = pivot;
+            }
+        }
+        SetRoot(pivot);
+        pivot->UpdateHeight();
+        Augmentation::Update(pivot);
+
+        return pivot;
     }
-    return successor;
+
+    const bool isLeftHigher = left->height > right->height;
+    Node* higher = isLeftHigher ? left : right;
+    Node* lower = isLeftHigher ? right : left;
+
+    // Schodzi po skrajnej ścieżce wyższego drzewa do węzła o wysokości co najwyżej o 1 większej
+    Node* parent = NIL;
+    Node* node = higher;
+    while (node->height > lower->height + 1)
+    {
+        parent = node;
+        node = isLeftHigher ? node->right : node->left;
+    }
+
+    SetRoot(higher);
+    pivot->parent = parent;
+    pivot->left = isLeftHigher ? node : lower;
+    pivot->right = isLeftHigher ? lower : node;
+    for (Node* child : {node, lower})
+    {
+        if (child != NIL)
+        {
+            child->parent = pivot;
+        }
+    }
+    if (isLeftHigher)
+    {
+        parent->right = pivot;
+    }
+    else
+    {
+        parent->left = pivot;
+    }
+    pivot->UpdateHeight();
+    Augmentation::Update(pivot);
+
+    RemoveFix(parent);
+
+    return Root();
 }
 
-template<typename T, typename C>
-void AvlTree<T, C>::ToString(std::string& result, const std::string& prefix, const Node* node, bool isRight) const
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Node* AvlTree<T, C, A>::JoinSubtrees(Node* left, Node* right) noexcept
+{
+    if (left == NIL)
+    {
+        return right;
+    }
+
+    Node* leftChild = left->left;
+    Node* rightChild = left->right;
+
+    return JoinSubtrees(leftChild, left, JoinSubtrees(rightChild, right));
+}
+
+template<typename T, typename C, typename A>
+void AvlTree<T, C, A>::SplitSubtree(Node* tree, const DataType& value, bool isUpper, Node*& left, Node*& right) noexcept
+{
+    if (tree == NIL)
+    {
+        left = right = NIL;
+        return;
+    }
+
+    Node* leftChild = tree->left;
+    Node* rightChild = tree->right;
+
+    if (isUpper ? !comparator(value, tree->value) : comparator(tree->value, value))
+    {
+        Node* middle;
+        SplitSubtree(rightChild, value, isUpper, middle, right);
+        left = JoinSubtrees(leftChild, tree, middle);
+    }
+    else
+    {
+        Node* middle;
+        SplitSubtree(leftChild, value, isUpper, left, middle);
+        right = JoinSubtrees(middle, tree, rightChild);
+    }
+}
+
+template<typename T, typename C, typename A>
+void AvlTree<T, C, A>::SplitSubtree(Node* tree, const DataType& value, Node*& less, Node*& equal, Node*& greater) noexcept
+{
+    Node* notLess;
+    SplitSubtree(tree, value, false, less, notLess);
+    SplitSubtree(notLess, value, true, equal, greater);
+}
+
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Node* AvlTree<T, C, A>::UnionSubtrees(Node* lhs, Node* rhs)
+{
+    if (rhs == NIL)
+    {
+        return lhs;
+    }
+    if (lhs == NIL)
+    {
+        return rhs;
+    }
+
+    Node* leftChild = lhs->left;
+    Node* rightChild = lhs->right;
+
+    Node* less;
+    Node* equal;
+    Node* greater;
+    SplitSubtree(rhs, lhs->value, less, equal, greater);
+    RemoveSubtree(equal);
+
+    Node* left = UnionSubtrees(leftChild, less);
+    Node* right = UnionSubtrees(rightChild, greater);
+    return JoinSubtrees(left, lhs, right);
+}
+
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Node* AvlTree<T, C, A>::IntersectSubtrees(Node* lhs, Node* rhs)
+{
+    if (lhs == NIL || rhs == NIL)
+    {
+        RemoveSubtree(lhs);
+        RemoveSubtree(rhs);
+        return NIL;
+    }
+
+    Node* leftChild = rhs->left;
+    Node* rightChild = rhs->right;
+
+    Node* less;
+    Node* equal;
+    Node* greater;
+    SplitSubtree(lhs, rhs->value, less, equal, greater);
+
+    Node* left = IntersectSubtrees(less, leftChild);
+    Node* right = IntersectSubtrees(greater, rightChild);
+
+    pool.Release(rhs);
+    size--;
+
+    return JoinSubtrees(left, JoinSubtrees(equal, right));
+}
+
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Node* AvlTree<T, C, A>::SubtractSubtrees(Node* lhs, Node* rhs)
+{
+    if (lhs == NIL || rhs == NIL)
+    {
+        RemoveSubtree(rhs);
+        return lhs;
+    }
+
+    Node* leftChild = rhs->left;
+    Node* rightChild = rhs->right;
+
+    Node* less;
+    Node* equal;
+    Node* greater;
+    SplitSubtree(lhs, rhs->value, less, equal, greater);
+    RemoveSubtree(equal);
+
+    Node* left = SubtractSubtrees(less, leftChild);
+    Node* right = SubtractSubtrees(greater, rightChild);
+
+    pool.Release(rhs);
+    size--;
+
+    return JoinSubtrees(left, right);
+}
+
+template<typename T, typename C, typename A>
+size_t AvlTree<T, C, A>::SizeOfFirst(Node* first, Node* second, size_t totalSize) const noexcept
+{
+    if constexpr (HAS_ORDER_STATISTICS)
+    {
+        return first->subtreeSize;
+    }
+    else
+    {
+        // Liczy oba drzewa jednocześnie, więc kończy po przejściu mniejszego z nich
+        size_t count = 0;
+        for (first = Min(first), second = Max(second); first != NIL && second != NIL; count++)
+        {
+            first = Next(first);
+            second = Previous(second);
+        }
+        return first == NIL ? count : totalSize - count;
+    }
+}
+
+template<typename T, typename C, typename A>
+void AvlTree<T, C, A>::ToString(std::string& result, const std::string& prefix, const Node* node, bool isRight) const
 {
     if (node != NIL)
     {
@@ -752,68 +1535,118 @@ void AvlTree<T, C>::ToString(std::string& result, const std::string& prefix, con
     }
 }
 
-template<typename T, typename C>
-void AvlTree<T, C>::Serialize(std::ostream& os, AvlTree::Node* node) const
+template<typename T, typename C, typename A>
+void AvlTree<T, C, A>::Serialize(std::ostream& os) const
 {
-    if (os.fail())
-    {
-        return;
-    }
-    if (node == NIL)
+    if (Root() == NIL)
     {
         os << NIL_VALUE << " ";
+        return;
     }
-    else
+
+    Node* node = Root();
+    Node* previous = NIL;
+    while (node != NIL && !os.fail())
     {
-        os << node->value << " ";
-        Serialize(os, node->left);
-        Serialize(os, node->right);
+        if (previous == node->parent)                                   // Węzeł odwiedzany pierwszy raz
+        {
+            os << node->value << " ";
+            if (node->left != NIL)
+            {
+                previous = node;
+                node = node->left;
+                continue;
+            }
+            os << NIL_VALUE << " ";
+            previous = NIL;
+        }
+        if (previous == node->left)                                     // Lewe poddrzewo zostało zapisane
+        {
+            if (node->right != NIL)
+            {
+                previous = node;
+                node = node->right;
+                continue;
+            }
+            os << NIL_VALUE << " ";
+        }
+        previous = node;
+        node = node->parent;
     }
 }
 
-template<typename T, typename C>
-typename AvlTree<T, C>::Node* AvlTree<T, C>::Deserialize(std::istream& is, AvlTree::Node* node, size_t& sizeOfTree)
+template<typename T, typename C, typename A>
+void AvlTree<T, C, A>::Deserialize(std::istream& is, size_t sizeOfTree)
 {
-    if (is.fail())
+    Clear();
+    pool.Reserve(Utils::Min(sizeOfTree, MAX_RESERVED_NODES));   // Dalsze węzły zajmują kolejne bloki
+
+    Node* node = ReadNode(is, NIL);
+    SetRoot(node);
+    bool isLeftRead = false;
+    while (node != NIL)
     {
-        return NIL;
+        Node* child = ReadNode(is, node);
+        (isLeftRead ? node->right : node->left) = child;
+        if (child != NIL)
+        {
+            node = child;
+            isLeftRead = false;
+        }
+        else if (!isLeftRead)
+        {
+            isLeftRead = true;
+        }
+        else
+        {
+            while (node->parent != NIL && node->parent->right == node)  // Wraca do najbliższego przodka,
+            {                                                           // którego prawe dziecko nie zostało
+                node = node->parent;                                    // jeszcze wczytane
+            }
+            node = node->parent;
+        }
     }
+
+    auto nodes = ReleaseNodes();
+    Build(nodes);
+}
+
+template<typename T, typename C, typename A>
+typename AvlTree<T, C, A>::Node* AvlTree<T, C, A>::ReadNode(std::istream& is, Node* parent)
+{
     int64_t value;
-    is >> value;
-    if (value == NIL_VALUE)
+    if (!(is >> value) || value == NIL_VALUE)
     {
         return NIL;
     }
-    Node* newNode = MakeNode(static_cast<DataType>(value));
-    sizeOfTree--;
 
-    newNode->parent = node;
-    newNode->left   = Deserialize(is, newNode, sizeOfTree);
-    newNode->right  = Deserialize(is, newNode, sizeOfTree);
+    Node* node = MakeNode(static_cast<DataType>(value));
+    node->parent = parent;
+    size++;
 
-    return newNode;
+    return node;
 }
 
-template<typename T, typename C>
-AvlTreeConstIterator<T, C>::AvlTreeConstIterator(const AvlTree<T, C>* avlTree, typename AvlTree<T, C>::Node* node) noexcept
+template<typename T, typename C, typename A>
+AvlTreeConstIterator<T, C, A>::AvlTreeConstIterator(const AvlTree<T, C, A>* avlTree, typename AvlTree<T, C, A>::Node* node) noexcept
     : avlTree(avlTree)
     , node(node)
 { }
 
-template<typename T, typename C>
-typename AvlTreeConstIterator<T, C>::reference AvlTreeConstIterator<T, C>::operator*() const noexcept
+template<typename T, typename C, typename A>
+typename AvlTreeConstIterator<T, C, A>::reference AvlTreeConstIterator<T, C, A>::operator*() const noexcept
 {
     return node->value;
 }
 
-template<typename T, typename C>
-typename AvlTreeConstIterator<T, C>::pointer AvlTreeConstIterator<T, C>::operator->() const noexcept
+template<typename T, typename C, typename A>
+typename AvlTreeConstIterator<T, C, A>::pointer AvlTreeConstIterator<T, C, A>::operator->() const noexcept
 {
     return &(**this);
 }
 
-template<typename T, typename C>
-AvlTreeConstIterator<T, C>& AvlTreeConstIterator<T, C>::operator++() noexcept
+template<typename T, typename C, typename A>
+AvlTreeConstIterator<T, C, A>& AvlTreeConstIterator<T, C, A>::operator++() noexcept
 {
     if (node->right == avlTree->NIL)
     {
@@ -832,16 +1665,16 @@ AvlTreeConstIterator<T, C>& AvlTreeConstIterator<T, C>::operator++() noexcept
     return *this;
 }
 
-template<typename T, typename C>
-AvlTreeConstIterator<T, C> AvlTreeConstIterator<T, C>::operator++(int) noexcept
+template<typename T, typename C, typename A>
+AvlTreeConstIterator<T, C, A> AvlTreeConstIterator<T, C, A>::operator++(int) noexcept
 {
     AvlTreeConstIterator tmp = *this;
     ++(*this);
     return tmp;
 }
 
-template<typename T, typename C>
-AvlTreeConstIterator<T, C>& AvlTreeConstIterator<T, C>::operator--() noexcept
+template<typename T, typename C, typename A>
+AvlTreeConstIterator<T, C, A>& AvlTreeConstIterator<T, C, A>::operator--() noexcept
 {
     if (node == avlTree->NIL)
     {
@@ -867,64 +1700,64 @@ AvlTreeConstIterator<T, C>& AvlTreeConstIterator<T, C>::operator--() noexcept
     return *this;
 }
 
-template<typename T, typename C>
-AvlTreeConstIterator<T, C> AvlTreeConstIterator<T, C>::operator--(int) noexcept
+template<typename T, typename C, typename A>
+AvlTreeConstIterator<T, C, A> AvlTreeConstIterator<T, C, A>::operator--(int) noexcept
 {
     AvlTreeConstIterator tmp = *this;
     --(*this);
     return tmp;
 }
 
-template<typename T, typename C>
-bool AvlTreeConstIterator<T, C>::operator==(const AvlTreeConstIterator& rhs) const noexcept
+template<typename T, typename C, typename A>
+bool AvlTreeConstIterator<T, C, A>::operator==(const AvlTreeConstIterator& rhs) const noexcept
 {
     return node == rhs.node;
 }
 
-template<typename T, typename C>
-bool AvlTreeConstIterator<T, C>::operator!=(const AvlTreeConstIterator& rhs) const noexcept
+template<typename T, typename C, typename A>
+bool AvlTreeConstIterator<T, C, A>::operator!=(const AvlTreeConstIterator& rhs) const noexcept
 {
     return !(*this == rhs);
 }
 
-template<typename T, typename C>
-typename AvlTreeIterator<T, C>::reference AvlTreeIterator<T, C>::operator*() const noexcept
+template<typename T, typename C, typename A>
+typename AvlTreeIterator<T, C, A>::reference AvlTreeIterator<T, C, A>::operator*() const noexcept
 {
-    return const_cast<reference>(AvlTreeConstIterator<T, C>::operator*());
+    return const_cast<reference>(AvlTreeConstIterator<T, C, A>::operator*());
 }
 
-template<typename T, typename C>
-typename AvlTreeIterator<T, C>::pointer AvlTreeIterator<T, C>::operator->() const noexcept
+template<typename T, typename C, typename A>
+typename AvlTreeIterator<T, C, A>::pointer AvlTreeIterator<T, C, A>::operator->() const noexcept
 {
     return &(**this);
 }
 
-template<typename T, typename C>
-AvlTreeIterator<T, C>& AvlTreeIterator<T, C>::operator++() noexcept
+template<typename T, typename C, typename A>
+AvlTreeIterator<T, C, A>& AvlTreeIterator<T, C, A>::operator++() noexcept
 {
-    AvlTreeConstIterator<T, C>::operator++();
+    AvlTreeConstIterator<T, C, A>::operator++();
     return *this;
 }
 
-template<typename T, typename C>
-AvlTreeIterator<T, C> AvlTreeIterator<T, C>::operator++(int) noexcept
+template<typename T, typename C, typename A>
+AvlTreeIterator<T, C, A> AvlTreeIterator<T, C, A>::operator++(int) noexcept
 {
     AvlTreeIterator tmp = *this;
-    AvlTreeConstIterator<T, C>::operator++();
+    AvlTreeConstIterator<T, C, A>::operator++();
     return tmp;
 }
 
-template<typename T, typename C>
-AvlTreeIterator<T, C>& AvlTreeIterator<T, C>::operator--() noexcept
+template<typename T, typename C, typename A>
+AvlTreeIterator<T, C, A>& AvlTreeIterator<T, C, A>::operator--() noexcept
 {
-    AvlTreeConstIterator<T, C>::operator--();
+    AvlTreeConstIterator<T, C, A>::operator--();
     return *this;
 }
 
-template<typename T, typename C>
-AvlTreeIterator<T, C> AvlTreeIterator<T, C>::operator--(int) noexcept
+template<typename T, typename C, typename A>
+AvlTreeIterator<T, C, A> AvlTreeIterator<T, C, A>::operator--(int) noexcept
 {
     AvlTreeIterator tmp = *this;
-    AvlTreeConstIterator<T, C>::operator--();
+    AvlTreeConstIterator<T, C, A>::operator--();
     return tmp;
 }
\ No newline at end of file
@@ -0,0 +1,1173 @@
+#pragma once
+
+#include "DynamicArray.h"
+#include "Utils/Algorithms.h"
+#include "Utils/Range.h"
+#include "Utils/Utils.h"
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+template<typename T, typename C, size_t N>
+struct BTreeIterator;
+
+template<typename T, typename C, size_t N>
+struct BTreeConstIterator;
+
+/**
+ * Number of elements which fit in 256 bytes, but at least 4
+ */
+template<typename T>
+inline constexpr size_t BTREE_DEFAULT_NODE_SIZE = 256 / sizeof(T) > 4 ? 256 / sizeof(T) : 4;
+
+/**
+ * B+ tree keeping up to NodeSize elements in every node. Elements are stored only in leaves,
+ * which are linked for fast scans. Insert and Remove invalidate iterators
+ */
+template<typename T, typename C = Utils::Less<T>, size_t NodeSize = BTREE_DEFAULT_NODE_SIZE<T>>
+class BTree
+{
+public:
+    friend struct BTreeIterator<T, C, NodeSize>;
+    friend struct BTreeConstIterator<T, C, NodeSize>;
+
+    using DataType = T;
+    using Comparator = C;
+    using Iterator = BTreeIterator<T, C, NodeSize>;
+    using ConstIterator = BTreeConstIterator<T, C, NodeSize>;
+
+    static_assert(NodeSize >= 4, "Node has to hold at least 4 elements");
+
+    [[nodiscard]] static constexpr const char* ClassName() noexcept { return "BTree"; }
+
+    explicit BTree(const Comparator& comparator = Comparator());
+    BTree(std::initializer_list<DataType> initList, const Comparator& comparator = Comparator());
+    BTree(const BTree& rhs);
+    BTree(BTree&& rhs) noexcept;
+    BTree& operator=(const BTree& rhs);
+    BTree& operator=(BTree&& rhs) noexcept;
+    ~BTree();
+
+    /**
+     * Builds the tree in O(n) with full leaves, the range has to be sorted according to the comparator
+     */
+    template<typename It>
+    [[nodiscard]] static BTree FromSorted(It first, It last, const Comparator& comparator = Comparator());
+
+    Iterator Insert(const DataType& value);
+    bool Remove(const DataType& value);
+    void Clear();
+
+    [[nodiscard]] ConstIterator Find(const DataType& value) const noexcept;
+    [[nodiscard]] Iterator Find(const DataType& value) noexcept;
+
+    /**
+     * @return first element not less than the value or end()
+     */
+    [[nodiscard]] ConstIterator LowerBound(const DataType& value) const noexcept;
+    [[nodiscard]] Iterator LowerBound(const DataType& value) noexcept;
+
+    /**
+     * @return first element greater than the value or end()
+     */
+    [[nodiscard]] ConstIterator UpperBound(const DataType& value) const noexcept;
+    [[nodiscard]] Iterator UpperBound(const DataType& value) noexcept;
+
+    [[nodiscard]] Utils::Range<ConstIterator> EqualRange(const DataType& value) const noexcept;
+    [[nodiscard]] Utils::Range<Iterator> EqualRange(const DataType& value) noexcept;
+
+    /**
+     * Lazily iterated view of elements in range [lo, hi], empty if hi is less than lo
+     */
+    [[nodiscard]] Utils::Range<ConstIterator> Range(const DataType& lo, const DataType& hi) const noexcept;
+    [[nodiscard]] Utils::Range<Iterator> Range(const DataType& lo, const DataType& hi) noexcept;
+
+    [[nodiscard]] const DataType& Min() const noexcept;
+    [[nodiscard]] const DataType& Max() const noexcept;
+
+    [[nodiscard]] size_t Size() const noexcept;
+
+    [[nodiscard]] Iterator begin() noexcept;
+    [[nodiscard]] Iterator end() noexcept;
+    [[nodiscard]] ConstIterator begin() const noexcept;
+    [[nodiscard]] ConstIterator end() const noexcept;
+    [[nodiscard]] ConstIterator cbegin() const noexcept;
+    [[nodiscard]] ConstIterator cend() const noexcept;
+
+    [[nodiscard]] std::string ToString() const;
+
+    template<typename U, typename V, size_t W>
+    friend std::ostream& operator<<(std::ostream& os, const BTree<U, V, W>& tree);
+
+    template<typename U, typename V, size_t W>
+    friend std::istream& operator>>(std::istream& is, BTree<U, V, W>& tree);
+
+private:
+    struct InnerNode;
+
+    struct Node
+    {
+        InnerNode* parent;
+        size_t count;
+        bool isLeaf;
+    };
+
+    struct LeafNode : Node
+    {
+        DataType values[NodeSize];
+        LeafNode* previous;
+        LeafNode* next;
+    };
+
+    /**
+     * Every element of children[i] is not greater than keys[i] and not less than keys[i - 1]
+     */
+    struct InnerNode : Node
+    {
+        DataType keys[NodeSize];
+        Node* children[NodeSize + 1];
+    };
+
+    inline static constexpr size_t MIN_LEAF_COUNT = NodeSize / 2;
+    inline static constexpr size_t MIN_INNER_COUNT = (NodeSize - 1) / 2;
+
+    /**
+     * Nodes of arithmetic types ordered by Utils::Less are scanned as a whole without branches,
+     * which lets the search use SIMD instructions
+     */
+    inline static constexpr bool IS_VECTORIZABLE = std::is_arithmetic_v<DataType> && std::is_same_v<Comparator, Utils::Less<DataType>>;
+
+    [[nodiscard]] static LeafNode* MakeLeaf();
+    [[nodiscard]] static InnerNode* MakeInner();
+
+    /**
+     * @return number of values less than the value, or not greater if isUpper is set
+     */
+    [[nodiscard]] size_t SearchNode(const DataType* values, size_t count, const DataType& value, bool isUpper) const noexcept;
+    [[nodiscard]] LeafNode* FindLeaf(const DataType& value, bool isUpper) const noexcept;
+    [[nodiscard]] ConstIterator Bound(const DataType& value, bool isUpper) const noexcept;
+
+    [[nodiscard]] static size_t IndexOfChild(const InnerNode* parent, const Node* child) noexcept;
+    [[nodiscard]] static const DataType& FirstValue(const Node* node) noexcept;
+
+    [[nodiscard]] LeafNode* SplitLeaf(LeafNode* leaf);
+    void InsertIntoParent(Node* left, const DataType& key, Node* right);
+
+    void RemoveAt(LeafNode* leaf, size_t index);
+    void Rebalance(Node* node);
+    void BorrowFromLeft(Node* node, Node* left, InnerNode* parent, size_t position) noexcept;
+    void BorrowFromRight(Node* node, Node* right, InnerNode* parent, size_t position) noexcept;
+
+    /**
+     * Moves the right node into the left one and removes the separator keys[position] from the parent
+     */
+    void Merge(Node* left, Node* right, InnerNode* parent, size_t position);
+
+    template<typename It>
+    void Build(It first, size_t count);
+    void RemoveSubtree(Node* node);
+    void ToString(std::string& result, const std::string& prefix, const Node* node) const;
+
+    Comparator comparator;
+    Node* root = nullptr;
+    LeafNode* firstLeaf = nullptr;
+    LeafNode* lastLeaf = nullptr;
+    size_t size = 0u;
+};
+
+template<typename T, typename C, size_t N>
+struct BTreeConstIterator
+{
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = typename BTree<T, C, N>::DataType;
+    using pointer = const value_type*;
+    using reference = const value_type&;
+
+    BTreeConstIterator() = default;
+    BTreeConstIterator(const BTree<T, C, N>* bTree, typename BTree<T, C, N>::LeafNode* leaf, size_t index) noexcept;
+
+    [[nodiscard]] reference operator*() const noexcept;
+
+    [[nodiscard]] pointer operator->() const noexcept;
+
+    BTreeConstIterator& operator++() noexcept;
+    BTreeConstIterator operator++(int) noexcept;
+    BTreeConstIterator& operator--() noexcept;
+    BTreeConstIterator operator--(int) noexcept;
+
+    [[nodiscard]] bool operator==(const BTreeConstIterator& rhs) const noexcept;
+    [[nodiscard]] bool operator!=(const BTreeConstIterator& rhs) const noexcept;
+
+protected:
+    friend class BTree<T, C, N>;
+
+    const BTree<T, C, N>* bTree = nullptr;
+    typename BTree<T, C, N>::LeafNode* leaf = nullptr;
+    size_t index = 0u;
+};
+
+template<typename T, typename C, size_t N>
+struct BTreeIterator : public BTreeConstIterator<T, C, N>
+{
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = typename BTree<T, C, N>::DataType;
+    using pointer = value_type*;
+    using reference = value_type&;
+
+    using BTreeConstIterator<T, C, N>::BTreeConstIterator;
+
+    BTreeIterator(const BTreeConstIterator<T, C, N>& rhs) noexcept;
+
+    [[nodiscard]] reference operator*() const noexcept;
+
+    [[nodiscard]] pointer operator->() const noexcept;
+
+    BTreeIterator& operator++() noexcept;
+    BTreeIterator operator++(int) noexcept;
+    BTreeIterator& operator--() noexcept;
+    BTreeIterator operator--(int) noexcept;
+};
+
+template<typename T, typename C, size_t N>
+BTree<T, C, N>::BTree(const Comparator& comparator)
+    : comparator(comparator)
+{ }
+
+template<typename T, typename C, size_t N>
+BTree<T, C, N>::BTree(std::initializer_list<DataType> initList, const Comparator& comparator)
+    : comparator(comparator)
+{
+    for (const auto& value : initList)
+    {
+        Insert(value);
+    }
+}
+
+template<typename T, typename C, size_t N>
+BTree<T, C, N>::BTree(const BTree& rhs)
+    : comparator(rhs.comparator)
+{
+    Build(rhs.cbegin(), rhs.size);
+}
+
+template<typename T, typename C, size_t N>
+BTree<T, C, N>::BTree(BTree&& rhs) noexcept
+    : comparator(std::move(rhs.comparator))
+    , root(rhs.root)
+    , firstLeaf(rhs.firstLeaf)
+    , lastLeaf(rhs.lastLeaf)
+    , size(rhs.size)
+{
+    rhs.root = nullptr;
+    rhs.firstLeaf = nullptr;
+    rhs.lastLeaf = nullptr;
+    rhs.size = 0u;
+}
+
+template<typename T, typename C, size_t N>
+BTree<T, C, N>& BTree<T, C, N>::operator=(const BTree& rhs)
+{
+    if (this == &rhs)
+    {
+        return *this;
+    }
+    Clear();
+    comparator = rhs.comparator;
+    Build(rhs.cbegin(), rhs.size);
+
+    return *this;
+}
+
+template<typename T, typename C, size_t N>
+BTree<T, C, N>& BTree<T, C, N>::operator=(BTree&& rhs) noexcept
+{
+    if (this == &rhs)
+    {
+        return *this;
+    }
+    Clear();
+    comparator = std::move(rhs.comparator);
+    root = rhs.root;
+    firstLeaf = rhs.firstLeaf;
+    lastLeaf = rhs.lastLeaf;
+    size = rhs.size;
+
+    rhs.root = nullptr;
+    rhs.firstLeaf = nullptr;
+    rhs.lastLeaf = nullptr;
+    rhs.size = 0u;
+
+    return *this;
+}
+
+template<typename T, typename C, size_t N>
+BTree<T, C, N>::~BTree()
+{
+    Clear();
+}
+
+template<typename T, typename C, size_t N>
+template<typename It>
+BTree<T, C, N> BTree<T, C, N>::FromSorted(It first, It last, const Comparator& comparator)
+{
+    BTree tree(comparator);
+    tree.Build(first, static_cast<size_t>(std::distance(first, last)));
+
+    return tree;
+}
+
+template<typename T, typename C, size_t N>
+typename BTree<T, C, N>::Iterator BTree<T, C, N>::Insert(const DataType& value)
+{
+    if (root == nullptr)
+    {
+        firstLeaf = lastLeaf = MakeLeaf();
+        root = firstLeaf;
+    }
+
+    LeafNode* leaf = FindLeaf(value, true);
+    size_t index = SearchNode(leaf->values, leaf->count, value, true);
+
+    if (leaf->count == N)
+    {
+        LeafNode* right = SplitLeaf(leaf);
+        if (index > leaf->count)
+        {
+            index -= leaf->count;
+            leaf = right;
+        }
+    }
+
+    for (size_t i = leaf->count; i > index; i--)
+    {
+        leaf->values[i] = std::move(leaf->values[i - 1]);
+    }
+    leaf->values[index] = value;
+    leaf->count++;
+    size++;
+
+    return Iterator(this, leaf, index);
+}
+
+template<typename T, typename C, size_t N>
+bool BTree<T, C, N>::Remove(const DataType& value)
+{
+    auto it = LowerBound(value);
+    if (it == end() || comparator(value, *it))
+    {
+        return false;
+    }
+
+    RemoveAt(it.leaf, it.index);
+    return true;
+}
+
+template<typename T, typename C, size_t N>
+void BTree<T, C, N>::Clear()
+{
+    RemoveSubtree(root);
+    root = nullptr;
+    firstLeaf = nullptr;
+    lastLeaf = nullptr;
+    size = 0u;
+}
+
+template<typename T, typename C, size_t N>
+typename BTree<T, C, N>::ConstIterator BTree<T, C, N>::Find(const DataType& value) const noexcept
+{
+    auto it = LowerBound(value);
+    if (it != cend() && comparator(value, *it))
+    {
+        return cend();
+    }
+    return it;
+}
+
+template<typename T, typename C, size_t N>
+typename BTree<T, C, N>::Iterator BTree<T, C, N>::Find(const DataType& value) noexcept
+{
+    return std::as_const(*this).Find(value);
+}
+
+template<typename T, typename C, size_t N>
+typename BTree<T, C, N>::ConstIterator BTree<T, C, N>::LowerBound(const DataType& value) const noexcept
+{
+    return Bound(value, false);
+}
+
+template<typename T, typename C, size_t N>
+typename BTree<T, C, N>::Iterator BTree<T, C, N>::LowerBound(const DataType& value) noexcept
+{
+    return Bound(value, false);
+}
+
+template<typename T, typename C, size_t N>
+typename BTree<T, C, N>::ConstIterator BTree<T, C, N>::UpperBound(const DataType& value) const noexcept
+{
+    return Bound(value, true);
+}
+
+template<typename T, typename C, size_t N>
+typename BTree<T, C, N>::Iterator BTree<T, C, N>::UpperBound(const DataType& value) noexcept
+{
+    return Bound(value, true);
+}
+
+template<typename T, typename C, size_t N>
+Utils::Range<typename BTree<T, C, N>::ConstIterator> BTree<T, C, N>::EqualRange(const DataType& value) const noexcept
+{
+    return {LowerBound(value), UpperBound(value)};
+}
+
+template<typename T, typename C, size_t N>
+Utils::Range<typename BTree<T, C, N>::Iterator> BTree<T, C, N>::EqualRange(const DataType& value) noexcept
+{
+    return {LowerBound(value), UpperBound(value)};
+}
+
+template<typename T, typename C, size_t N>
+Utils::Range<typename BTree<T, C, N>::ConstIterator> BTree<T, C, N>::Range(const DataType& lo, const DataType& hi) const noexcept
+{
+    if (comparator(hi, lo))
+    {
+        return {cend(), cend()};
+    }
+    return {LowerBound(lo), UpperBound(hi)};
+}
+
+template<typename T, typename C, size_t N>
+Utils::Range<typename BTree<T, C, N>::Iterator> BTree<T, C, N>::Range(const DataType& lo, const DataType& hi) noexcept
+{
+    if (comparator(hi, lo))
+    {
+        return {end(), end()};
+    }
+    return {LowerBound(lo), UpperBound(hi)};
+}
+
+template<typename T, typename C, size_t N>
+const typename BTree<T, C, N>::DataType& BTree<T, C, N>::Min() const noexcept
+{
+    return firstLeaf->values[0];
+}
+
+template<typename T, typename C, size_t N>
+const typename BTree<T, C, N>::DataType& BTree<T, C, N>::Max() const noexcept
+{
+    return lastLeaf->values[lastLeaf->count - 1];
+}
+
+template<typename T, typename C, size_t N>
+size_t BTree<T, C, N>::Size() const noexcept
+{
+    return size;
+}
+
+template<typename T, typename C, size_t N>
+typename BTree<T, C, N>::Iterator BTree<T, C, N>::begin() noexcept
+{
+    return Iterator(this, firstLeaf, 0);
+}
+
+template<typename T, typename C, size_t N>
+typename BTree<T, C, N>::Iterator BTree<T, C, N>::end() noexcept
+{
+    return Iterator(this, nullptr, 0);
+}
+
+template<typename T, typename C, size_t N>
+typename BTree<T, C, N>::ConstIterator BTree<T, C, N>::begin() const noexcept
+{
+    return ConstIterator(this, firstLeaf, 0);
+}
+
+template<typename T, typename C, size_t N>
+typename BTree<T, C, N>::ConstIterator BTree<T, C, N>::end() const noexcept
+{
+    return ConstIterator(this, nullptr, 0);
+}
+
+template<typename T, typename C, size_t N>
+typename BTree<T, C, N>::ConstIterator BTree<T, C, N>::cbegin() const noexcept
+{
+    return begin();
+}
+
+template<typename T, typename C, size_t N>
+typename BTree<T, C, N>::ConstIterator BTree<T, C, N>::cend() const noexcept
+{
+    return end();
+}
+
+template<typename T, typename C, size_t N>
+std::string BTree<T, C, N>::ToString() const
+{
+    std::string result;
+    ToString(result, "", root);
+    return result;
+}
+
+template<typename T, typename C, size_t N>
+std::ostream& operator<<(std::ostream& os, const BTree<T, C, N>& tree)
+{
+    if (os.fail())
+    {
+        return os;
+    }
+    os << tree.Size() << "\n";
+    for (const auto& value : tree)
+    {
+        os << value << " ";
+    }
+    return os;
+}
+
+template<typename T, typename C, size_t N>
+std::istream& operator>>(std::istream& is, BTree<T, C, N>& tree)
+{
+    if (is.fail())
+    {
+        return is;
+    }
+    size_t size = 0;
+    is >> size;
+
+    DynamicArray<T> values;                                         // Rozmiar z nagłówka nie jest sprawdzony,
+    size_t count = 0;                                               // więc tablica rośnie wraz z odczytem
+    bool isSorted = true;
+    for (T value; count < size && is >> value; count++)
+    {
+        if (count == values.Size())
+        {
+            values.Resize(Utils::Max(size_t {16}, 2 * count));
+        }
+        isSorted = isSorted && (count == 0 || !tree.comparator(value, values[count - 1]));
+        values[count] = value;
+    }
+    if (is.fail())
+    {
+        return is;
+    }
+
+    auto last = values.begin() + static_cast<std::ptrdiff_t>(count);
+    if (!isSorted)
+    {
+        Utils::QuickSort(values.begin(), last, tree.comparator);
+    }
+    tree = BTree<T, C, N>::FromSorted(values.begin(), last, tree.comparator);
+
+    return is;
+}
+
+template<typename T, typename C, size_t N>
+typename BTree<T, C, N>::LeafNode* BTree<T, C, N>::MakeLeaf()
+{
+    auto* leaf = new LeafNode {};
+    leaf->isLeaf = true;
+
+    return leaf;
+}
+
+template<typename T, typename C, size_t N>
+typename BTree<T, C, N>::InnerNode* BTree<T, C, N>::MakeInner()
+{
+    auto* inner = new InnerNode {};
+    inner->isLeaf = false;
+
+    return inner;
+}
+
+template<typename T, typename C, size_t N>
+size_t BTree<T, C, N>::SearchNode(const DataType* values, size_t count, const DataType& value, bool isUpper) const noexcept
+{
+    if constexpr (IS_VECTORIZABLE)
+    {
+        return Utils::CountLess(values, count, value, isUpper);
+    }
+    else
+    {
+        size_t low = 0;
+        size_t high = count;
+        while (low < high)
+        {
+            const size_t middle = low + (high - low) / 2;
+            if (isUpper ? !comparator(value, values[middle]) : comparator(values[middle], value))
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+        return low;
+    }
+}
+
+template<typename T, typename C, size_t N>
+typename BTree<T, C, N>::LeafNode* BTree<T, C, N>::FindLeaf(const DataType& value, bool isUpper) const noexcept
+{
+    Node* node = root;
+    while (!node->isLeaf)
+    {
+        auto* inner = static_cast<InnerNode*>(node);
+        node = inner->children[SearchNode(inner->keys, inner->count, value, isUpper)];
+    }
+    return static_cast<LeafNode*>(node);
+}
+
+template<typename T, typename C, size_t N>
+typename BTree<T, C, N>::ConstIterator BTree<T, C, N>::Bound(const DataType& value, bool isUpper) const noexcept
+{
+    if (root == nullptr)
+    {
+        return cend();
+    }
+
+    LeafNode* leaf = FindLeaf(value, isUpper);
+    const size_t index = SearchNode(leaf->values, leaf->count, value, isUpper);
+    if (index == leaf->count)
+    {
+        return ConstIterator(this, leaf->next, 0);
+    }
+    return ConstIterator(this, leaf, index);
+}
+
+template<typename T, typename C, size_t N>
+size_t BTree<T, C, N>::IndexOfChild(const InnerNode* parent, const Node* child) noexcept
+{
+    size_t position = 0;
+    while (parent->children[position] != child)
+    {
+        position++;
+    }
+    return position;
+}
+
+template<typename T, typename C, size_t N>
+const typename BTree<T, C, N>::DataType& BTree<T, C, N>::FirstValue(const Node* node) noexcept
+{
+    while (!node->isLeaf)
+    {
+        node = static_cast<const InnerNode*>(node)->children[0];
+    }
+    return static_cast<const LeafNode*>(node)->values[0];
+}
+
+template<typename T, typename C, size_t N>
+typename BTree<T, C, N>::LeafNode* BTree<T, C, N>::SplitLeaf(LeafNode* leaf)
+{
+    LeafNode* right = MakeLeaf();
+    const size_t middle = N / 2;
+
+    for (size_t i = middle; i < N; i++)
+    {
+        right->values[i - middle] = std::move(leaf->values[i]);
+    }
+    right->count = N - middle;
+    leaf->count = middle;
+
+    right->previous = leaf;
+    right->next = leaf->next;
+    if (leaf->next != nullptr)
+    {
+        leaf->next->previous = right;
+    }
+    else
+    {
+        lastLeaf = right;
+    }
+    leaf->next = right;
+
+    InsertIntoParent(leaf, right->values[0], right);
+    return right;
+}
+
+template<typename T, typename C, size_t N>
+void BTree<T, C, N>::InsertIntoParent(Node* left, const DataType& key, Node* right)
+{
+    if (left == root)
+    {
+        InnerNode* newRoot = MakeInner();
+        newRoot->keys[0] = key;
+        newRoot->children[0] = left;
+        newRoot->children[1] = right;
+        newRoot->count = 1;
+        left->parent = newRoot;
+        right->parent = newRoot;
+        root = newRoot;
+        return;
+    }
+
+    InnerNode* parent = left->parent;
+    size_t position = IndexOfChild(parent, left);
+
+    if (parent->count == N)
+    {
+        // Klucz środkowy przechodzi do rodzica, prawa połowa kluczy i dzieci do nowego węzła
+        InnerNode* sibling = MakeInner();
+        const size_t middle = N / 2;
+
+        for (size_t i = middle + 1; i < N; i++)
+        {
+            sibling->keys[i - middle - 1] = std::move(parent->keys[i]);
+        }
+        for (size_t i = middle + 1; i <= N; i++)
+        {
+            sibling->children[i - middle - 1] = parent->children[i];
+            parent->children[i]->parent = sibling;
+        }
+        sibling->count = N - middle - 1;
+        parent->count = middle;
+
+        InsertIntoParent(parent, parent->keys[middle], sibling);
+        if (position > middle)
+        {
+            position -= middle + 1;
+            parent = sibling;
+        }
+    }
+
+    for (size_t i = parent->count; i > position; i--)
+    {
+        parent->keys[i] = std::move(parent->keys[i - 1]);
+        parent->children[i + 1] = parent->children[i];
+    }
+    parent->keys[position] = key;
+    parent->children[position + 1] = right;
+    parent->count++;
+    right->parent = parent;
+}
+
+template<typename T, typename C, size_t N>
+void BTree<T, C, N>::RemoveAt(LeafNode* leaf, size_t index)
+{
+    for (size_t i = index + 1; i < leaf->count; i++)
+    {
+        leaf->values[i - 1] = std::move(leaf->values[i]);
+    }
+    leaf->count--;
+    size--;
+
+    Rebalance(leaf);
+}
+
+template<typename T, typename C, size_t N>
+void BTree<T, C, N>::Rebalance(Node* node)
+{
+    if (node == root)
+    {
+        if (node->count > 0)
+        {
+            return;
+        }
+        if (node->isLeaf)
+        {
+            delete static_cast<LeafNode*>(node);
+            root = nullptr;
+            firstLeaf = nullptr;
+            lastLeaf = nullptr;
+        }
+        else
+        {
+            root = static_cast<InnerNode*>(node)->children[0];
+            root->parent = nullptr;
+            delete static_cast<InnerNode*>(node);
+        }
+        return;
+    }
+
+    const size_t minCount = node->isLeaf ? MIN_LEAF_COUNT : MIN_INNER_COUNT;
+    if (node->count >= minCount)
+    {
+        return;
+    }
+
+    InnerNode* parent = node->parent;
+    const size_t position = IndexOfChild(parent, node);
+    Node* left = position > 0 ? parent->children[position - 1] : nullptr;
+    Node* right = position < parent->count ? parent->children[position + 1] : nullptr;
+
+    if (left != nullptr && left->count > minCount)
+    {
+        BorrowFromLeft(node, left, parent, position);
+    }
+    else if (right != nullptr && right->count > minCount)
+    {
+        BorrowFromRight(node, right, parent, position);
+    }
+    else
+    {
+        if (left != nullptr)
+        {
+            Merge(left, node, parent, position - 1);
+        }
+        else
+        {
+            Merge(node, right, parent, position);
+        }
+        Rebalance(parent);
+    }
+}
+
+template<typename T, typename C, size_t N>
+void BTree<T, C, N>::BorrowFromLeft(Node* node, Node* left, InnerNode* parent, size_t position) noexcept
+{
+    if (node->isLeaf)
+    {
+        auto* leaf = static_cast<LeafNode*>(node);
+        auto* sibling = static_cast<LeafNode*>(left);
+        for (size_t i = leaf->count; i > 0; i--)
+        {
+            leaf->values[i] = std::move(leaf->values[i - 1]);
+        }
+        leaf->values[0] = std::move(sibling->values[sibling->count - 1]);
+        parent->keys[position - 1] = leaf->values[0];
+    }
+    else
+    {
+        auto* inner = static_cast<InnerNode*>(node);
+        auto* sibling = static_cast<InnerNode*>(left);
+        inner->children[inner->count + 1] = inner->children[inner->count];
+        for (size_t i = inner->count; i > 0; i--)
+        {
+            inner->keys[i] = std::move(inner->keys[i - 1]);
+            inner->children[i] = inner->children[i - 1];
+        }
+        inner->keys[0] = std::move(parent->keys[position - 1]);
+        inner->children[0] = sibling->children[sibling->count];
+        inner->children[0]->parent = inner;
+        parent->keys[position - 1] = std::move(sibling->keys[sibling->count - 1]);
+    }
+    node->count++;
+    left->count--;
+}
+
+template<typename T, typename C, size_t N>
+void BTree<T, C, N>::BorrowFromRight(Node* node, Node* right, InnerNode* parent, size_t position) noexcept
+{
+    if (node->isLeaf)
+    {
+        auto* leaf = static_cast<LeafNode*>(node);
+        auto* sibling = static_cast<LeafNode*>(right);
+        leaf->values[leaf->count] = std::move(sibling->values[0]);
+        for (size_t i = 1; i < sibling->count; i++)
+        {
+            sibling->values[i - 1] = std::move(sibling->values[i]);
+        }
+        parent->keys[position] = sibling->values[0];
+    }
+    else
+    {
+        auto* inner = static_cast<InnerNode*>(node);
+        auto* sibling = static_cast<InnerNode*>(right);
+        inner->keys[inner->count] = std::move(parent->keys[position]);
+        inner->children[inner->count + 1] = sibling->children[0];
+        inner->children[inner->count + 1]->parent = inner;
+        parent->keys[position] = std::move(sibling->keys[0]);
+        for (size_t i = 1; i < sibling->count; i++)
+        {
+            sibling->keys[i - 1] = std::move(sibling->keys[i]);
+        }
+        for (size_t i = 1; i <= sibling->count; i++)
+        {
+            sibling->children[i - 1] = sibling->children[i];
+        }
+    }
+    node->count++;
+    right->count--;
+}
+
+template<typename T, typename C, size_t N>
+void BTree<T, C, N>::Merge(Node* left, Node* right, InnerNode* parent, size_t position)
+{
+    if (left->isLeaf)
+    {
+        auto* leaf = static_cast<LeafNode*>(left);
+        auto* sibling = static_cast<LeafNode*>(right);
+        for (size_t i = 0; i < sibling->count; i++)
+        {
+            leaf->values[leaf->count + i] = std::move(sibling->values[i]);
+        }
+        leaf->count += sibling->count;
+
+        leaf->next = sibling->next;
+        if (sibling->next != nullptr)
+        {
+            sibling->next->previous = leaf;
+        }
+        else
+        {
+            lastLeaf = leaf;
+        }
+        delete sibling;
+    }
+    else
+    {
+        auto* inner = static_cast<InnerNode*>(left);
+        auto* sibling = static_cast<InnerNode*>(right);
+        inner->keys[inner->count] = std::move(parent->keys[position]);
+        for (size_t i = 0; i < sibling->count; i++)
+        {
+            inner->keys[inner->count + 1 + i] = std::move(sibling->keys[i]);
+        }
+        for (size_t i = 0; i <= sibling->count; i++)
+        {
+            inner->children[inner->count + 1 + i] = sibling->children[i];
+            sibling->children[i]->parent = inner;
+        }
+        inner->count += sibling->count + 1;
+        delete sibling;
+    }
+
+    for (size_t i = position + 1; i < parent->count; i++)
+    {
+        parent->keys[i - 1] = std::move(parent->keys[i]);
+        parent->children[i] = parent->children[i + 1];
+    }
+    parent->count--;
+}
+
+template<typename T, typename C, size_t N>
+template<typename It>
+void BTree<T, C, N>::Build(It first, size_t count)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    // Elementy są rozdzielane po równo, więc każdy węzeł poza korzeniem ma co najmniej połowę miejsc zajętych
+    const size_t numberOfLeaves = (count + N - 1) / N;
+    DynamicArray<Node*> level(numberOfLeaves);
+    LeafNode* previous = nullptr;
+
+    for (size_t i = 0; i < numberOfLeaves; i++)
+    {
+        LeafNode* leaf = MakeLeaf();
+        leaf->count = count / numberOfLeaves + (i < count % numberOfLeaves ? 1 : 0);
+        for (size_t j = 0; j < leaf->count; j++, ++first)
+        {
+            leaf->values[j] = *first;
+        }
+
+        leaf->previous = previous;
+        if (previous != nullptr)
+        {
+            previous->next = leaf;
+        }
+        else
+        {
+            firstLeaf = leaf;
+        }
+        previous = leaf;
+        level[i] = leaf;
+    }
+    lastLeaf = previous;
+
+    while (level.Size() > 1)
+    {
+        const size_t numberOfParents = (level.Size() + N) / (N + 1);
+        DynamicArray<Node*> parents(numberOfParents);
+
+        for (size_t i = 0, child = 0; i < numberOfParents; i++)
+        {
+            InnerNode* inner = MakeInner();
+            const size_t numberOfChildren = level.Size() / numberOfParents + (i < level.Size() % numberOfParents ? 1 : 0);
+
+            for (size_t j = 0; j < numberOfChildren; j++, child++)
+            {
+                if (j > 0)
+                {
+                    inner->keys[j - 1] = FirstValue(level[child]);
+                }
+                inner->children[j] = level[child];
+                level[child]->parent = inner;
+            }
+            inner->count = numberOfChildren - 1;
+            parents[i] = inner;
+        }
+        level = std::move(parents);
+    }
+
+    root = level[0];
+    root->parent = nullptr;
+    size = count;
+}
+
+template<typename T, typename C, size_t N>
+void BTree<T, C, N>::RemoveSubtree(Node* node)
+{
+    if (node == nullptr)
+    {
+        return;
+    }
+    if (node->isLeaf)
+    {
+        delete static_cast<LeafNode*>(node);
+        return;
+    }
+
+    auto* inner = static_cast<InnerNode*>(node);
+    for (size_t i = 0; i <= inner->count; i++)
+    {
+        RemoveSubtree(inner->children[i]);
+    }
+    delete inner;
+}
+
+template<typename T, typename C, size_t N>
+void BTree<T, C, N>::ToString(std::string& result, const std::string& prefix, const Node* node) const
+{
+    if (node == nullptr)
+    {
+        return;
+    }
+
+    const auto* values = node->isLeaf ? static_cast<const LeafNode*>(node)->values : static_cast<const InnerNode*>(node)->keys;
+    result += prefix + "[";
+    for (size_t i = 0; i < node->count; i++)
+    {
+        result += (i > 0 ? " " : "") + Utils::Parser::NumberToString(values[i]);
+    }
+    result += "]\n";
+
+    if (!node->isLeaf)
+    {
+        const auto* inner = static_cast<const InnerNode*>(node);
+        for (size_t i = 0; i <= inner->count; i++)
+        {
+            ToString(result, prefix + "  ", inner->children[i]);
+        }
+    }
+}
+
+template<typename T, typename C, size_t N>
+BTreeConstIterator<T, C, N>::BTreeConstIterator(const BTree<T, C, N>* bTree, typename BTree<T, C, N>::LeafNode* leaf, size_t index) noexcept
+    : bTree(bTree)
+    , leaf(leaf)
+    , index(index)
+{ }
+
+template<typename T, typename C, size_t N>
+typename BTreeConstIterator<T, C, N>::reference BTreeConstIterator<T, C, N>::operator*() const noexcept
+{
+    return leaf->values[index];
+}
+
+template<typename T, typename C, size_t N>
+typename BTreeConstIterator<T, C, N>::pointer BTreeConstIterator<T, C, N>::operator->() const noexcept
+{
+    return &(**this);
+}
+
+template<typename T, typename C, size_t N>
+BTreeConstIterator<T, C, N>& BTreeConstIterator<T, C, N>::operator++() noexcept
+{
+    index++;
+    if (index == leaf->count)
+    {
+        leaf = leaf->next;
+        index = 0;
+    }
+
+    return *this;
+}
+
+template<typename T, typename C, size_t N>
+BTreeConstIterator<T, C, N> BTreeConstIterator<T, C, N>::operator++(int) noexcept
+{
+    BTreeConstIterator tmp = *this;
+    ++(*this);
+    return tmp;
+}
+
+template<typename T, typename C, size_t N>
+BTreeConstIterator<T, C, N>& BTreeConstIterator<T, C, N>::operator--() noexcept
+{
+    if (leaf == nullptr)
+    {
+        leaf = bTree->lastLeaf;
+        index = leaf->count - 1;
+    }
+    else if (index == 0)
+    {
+        leaf = leaf->previous;
+        index = leaf->count - 1;
+    }
+    else
+    {
+        index--;
+    }
+
+    return *this;
+}
+
+template<typename T, typename C, size_t N>
+BTreeConstIterator<T, C, N> BTreeConstIterator<T, C, N>::operator--(int) noexcept
+{
+    BTreeConstIterator tmp = *this;
+    --(*this);
+    return tmp;
+}
+
+template<typename T, typename C, size_t N>
+bool BTreeConstIterator<T, C, N>::operator==(const BTreeConstIterator& rhs) const noexcept
+{
+    return leaf == rhs.leaf && index == rhs.index;
+}
+
+template<typename T, typename C, size_t N>
+bool BTreeConstIterator<T, C, N>::operator!=(const BTreeConstIterator& rhs) const noexcept
+{
+    return !(*this == rhs);
+}
+
+template<typename T, typename C, size_t N>
+BTreeIterator<T, C, N>::BTreeIterator(const BTreeConstIterator<T, C, N>& rhs) noexcept
+    : BTreeConstIterator<T, C, N>(rhs)
+{ }
+
+template<typename T, typename C, size_t N>
+typename BTreeIterator<T, C, N>::reference BTreeIterator<T, C, N>::operator*() const noexcept
+{
+    return const_cast<reference>(BTreeConstIterator<T, C, N>::operator*());
+}
+
+template<typename T, typename C, size_t N>
+typename BTreeIterator<T, C, N>::pointer BTreeIterator<T, C, N>::operator->() const noexcept
+{
+    return &(**this);
+}
+
+template<typename T, typename C, size_t N>
+BTreeIterator<T, C, N>& BTreeIterator<T, C, N>::operator++() noexcept
+{
+    BTreeConstIterator<T, C, N>::operator++();
+    return *this;
+}
+
+template<typename T, typename C, size_t N>
+BTreeIterator<T, C, N> BTreeIterator<T, C, N>::operator++(int) noexcept
+{
+    BTreeIterator tmp = *this;
+    BTreeConstIterator<T, C, N>::operator++();
+    return tmp;
+}
+
+template<typename T, typename C, size_t N>
+BTreeIterator<T, C, N>& BTreeIterator<T, C, N>::operator--() noexcept
+{
+    BTreeConstIterator<T, C, N>::operator--();
+    return *this;
+}
+
+template<typename T, typename C, size_t N>
+BTreeIterator<T, C, N> BTreeIterator<T, C, N>::operator--(int) noexcept
+{
+    BTreeIterator tmp = *this;
+    BTreeConstIterator<T, C, N>::operator--();
+    return tmp;
+}
\ No newline at end of file
@@ -0,0 +1,323 @@
+#pragma once
+
+#include "BTree.h"
+#include "Map.h"
+#include "Utils/Pair.h"
+
+/**
+ * Map keeping pairs in leaves of a B+ tree. Pairs are moved between nodes, so unlike in Map
+ * the key is not const and must not be modified through iterators
+ */
+template<typename K, typename V, typename C = MapComparator<Utils::Pair<K, V>>, size_t NodeSize = BTREE_DEFAULT_NODE_SIZE<Utils::Pair<K, V>>>
+class BTreeMap
+{
+public:
+    using KeyType = K;
+    using ValueType = V;
+    using Comparator = C;
+    using DataType = Utils::Pair<K, V>;
+    using Iterator = typename BTree<DataType, C, NodeSize>::Iterator;
+    using ConstIterator = typename BTree<DataType, C, NodeSize>::ConstIterator;
+
+    [[nodiscard]] static constexpr const char* ClassName() noexcept { return "BTreeMap"; }
+
+    BTreeMap(const Comparator& comparator = Comparator());
+    BTreeMap(std::initializer_list<DataType> initList, const Comparator& comparator = Comparator());
+
+    [[nodiscard]] ValueType& operator[](const KeyType& key);
+    [[nodiscard]] ValueType& at(const KeyType& key);
+    [[nodiscard]] const ValueType& at(const KeyType& key) const;
+
+    Iterator Insert(const DataType& value);
+    bool Remove(const KeyType& key);
+    void Clear();
+
+    [[nodiscard]] ConstIterator Find(const KeyType& key) const noexcept;
+    [[nodiscard]] Iterator Find(const KeyType& key) noexcept;
+
+    /**
+     * @return first pair with key not less than the given one or end()
+     */
+    [[nodiscard]] ConstIterator LowerBound(const KeyType& key) const noexcept;
+    [[nodiscard]] Iterator LowerBound(const KeyType& key) noexcept;
+
+    /**
+     * @return first pair with key greater than the given one or end()
+     */
+    [[nodiscard]] ConstIterator UpperBound(const KeyType& key) const noexcept;
+    [[nodiscard]] Iterator UpperBound(const KeyType& key) noexcept;
+
+    [[nodiscard]] Utils::Range<ConstIterator> EqualRange(const KeyType& key) const noexcept;
+    [[nodiscard]] Utils::Range<Iterator> EqualRange(const KeyType& key) noexcept;
+
+    /**
+     * Lazily iterated view of pairs with keys in range [lo, hi]
+     */
+    [[nodiscard]] Utils::Range<ConstIterator> Range(const KeyType& lo, const KeyType& hi) const noexcept;
+    [[nodiscard]] Utils::Range<Iterator> Range(const KeyType& lo, const KeyType& hi) noexcept;
+
+    /**
+     * Calls the visitor with every pair with key in range [lo, hi], nothing is copied
+     */
+    template<typename F>
+    void ForEachInRange(const KeyType& lo, const KeyType& hi, F&& visitor) const;
+
+    template<typename F>
+    void ForEachInRange(const KeyType& lo, const KeyType& hi, F&& visitor);
+
+    [[nodiscard]] const DataType& Min() const noexcept;
+    [[nodiscard]] const DataType& Max() const noexcept;
+
+    [[nodiscard]] size_t Size() const noexcept;
+
+    [[nodiscard]] Iterator begin() noexcept;
+    [[nodiscard]] Iterator end() noexcept;
+    [[nodiscard]] ConstIterator begin() const noexcept;
+    [[nodiscard]] ConstIterator end() const noexcept;
+    [[nodiscard]] ConstIterator cbegin() const noexcept;
+    [[nodiscard]] ConstIterator cend() const noexcept;
+
+    [[nodiscard]] std::string ToString() const;
+
+    template<typename T, typename U, typename D, size_t W>
+    friend std::ostream& operator<<(std::ostream& os, const BTreeMap<T, U, D, W>& map);
+
+    template<typename T, typename U, typename D, size_t W>
+    friend std::istream& operator>>(std::istream& is, BTreeMap<T, U, D, W>& map);
+
+private:
+
+    BTree<DataType, C, NodeSize> tree;
+};
+
+template<typename K, typename V, typename C, size_t N>
+BTreeMap<K, V, C, N>::BTreeMap(const Comparator& comparator)
+    : tree(comparator)
+{}
+
+template<typename K, typename V, typename C, size_t N>
+BTreeMap<K, V, C, N>::BTreeMap(std::initializer_list<DataType> initList, const Comparator& comparator)
+    : tree(initList, comparator)
+{ }
+
+template<typename K, typename V, typename C, size_t N>
+typename BTreeMap<K, V, C, N>::ValueType& BTreeMap<K, V, C, N>::operator[](const KeyType& key)
+{
+    auto it = Find(key);
+    if (it != end())
+    {
+        return it->second;
+    }
+
+    return Insert({key, ValueType()})->second;
+}
+
+template<typename K, typename V, typename C, size_t N>
+typename BTreeMap<K, V, C, N>::ValueType& BTreeMap<K, V, C, N>::at(const KeyType& key)
+{
+    auto it = Find(key);
+    if (it != end())
+    {
+        return it->second;
+    }
+
+    throw std::out_of_range("No such element exists");
+}
+
+template<typename K, typename V, typename C, size_t N>
+const typename BTreeMap<K, V, C, N>::ValueType& BTreeMap<K, V, C, N>::at(const KeyType& key) const
+{
+    auto it = Find(key);
+    if (it != end())
+    {
+        return it->second;
+    }
+
+    throw std::out_of_range("No such element exists");
+}
+
+template<typename K, typename V, typename C, size_t N>
+typename BTreeMap<K, V, C, N>::Iterator BTreeMap<K, V, C, N>::Insert(const DataType& value)
+{
+    if (Find(value.first) != end())
+    {
+        return end();
+    }
+    return tree.Insert(value);
+}
+
+template<typename K, typename V, typename C, size_t N>
+bool BTreeMap<K, V, C, N>::Remove(const KeyType& key)
+{
+    return tree.Remove({key, ValueType()});
+}
+
+template<typename K, typename V, typename C, size_t N>
+void BTreeMap<K, V, C, N>::Clear()
+{
+    tree.Clear();
+}
+
+template<typename K, typename V, typename C, size_t N>
+typename BTreeMap<K, V, C, N>::ConstIterator BTreeMap<K, V, C, N>::Find(const KeyType& key) const noexcept
+{
+    return tree.Find({key, ValueType()});
+}
+
+template<typename K, typename V, typename C, size_t N>
+typename BTreeMap<K, V, C, N>::Iterator BTreeMap<K, V, C, N>::Find(const KeyType& key) noexcept
+{
+    return tree.Find({key, ValueType()});
+}
+
+template<typename K, typename V, typename C, size_t N>
+typename BTreeMap<K, V, C, N>::ConstIterator BTreeMap<K, V, C, N>::LowerBound(const KeyType& key) const noexcept
+{
+    return tree.LowerBound({key, ValueType()});
+}
+
+template<typename K, typename V, typename C, size_t N>
+typename BTreeMap<K, V, C, N>::Iterator BTreeMap<K, V, C, N>::LowerBound(const KeyType& key) noexcept
+{
+    return tree.LowerBound({key, ValueType()});
+}
+
+template<typename K, typename V, typename C, size_t N>
+typename BTreeMap<K, V, C, N>::ConstIterator BTreeMap<K, V, C, N>::UpperBound(const KeyType& key) const noexcept
+{
+    return tree.UpperBound({key, ValueType()});
+}
+
+template<typename K, typename V, typename C, size_t N>
+typename BTreeMap<K, V, C, N>::Iterator BTreeMap<K, V, C, N>::UpperBound(const KeyType& key) noexcept
+{
+    return tree.UpperBound({key, ValueType()});
+}
+
+template<typename K, typename V, typename C, size_t N>
+Utils::Range<typename BTreeMap<K, V, C, N>::ConstIterator> BTreeMap<K, V, C, N>::EqualRange(const KeyType& key) const noexcept
+{
+    return tree.EqualRange({key, ValueType()});
+}
+
+template<typename K, typename V, typename C, size_t N>
+Utils::Range<typename BTreeMap<K, V, C, N>::Iterator> BTreeMap<K, V, C, N>::EqualRange(const KeyType& key) noexcept
+{
+    return tree.EqualRange({key, ValueType()});
+}
+
+template<typename K, typename V, typename C, size_t N>
+Utils::Range<typename BTreeMap<K, V, C, N>::ConstIterator> BTreeMap<K, V, C, N>::Range(const KeyType& lo, const KeyType& hi) const noexcept
+{
+    return tree.Range({lo, ValueType()}, {hi, ValueType()});
+}
+
+template<typename K, typename V, typename C, size_t N>
+Utils::Range<typename BTreeMap<K, V, C, N>::Iterator> BTreeMap<K, V, C, N>::Range(const KeyType& lo, const KeyType& hi) noexcept
+{
+    return tree.Range({lo, ValueType()}, {hi, ValueType()});
+}
+
+template<typename K, typename V, typename C, size_t N>
+template<typename F>
+void BTreeMap<K, V, C, N>::ForEachInRange(const KeyType& lo, const KeyType& hi, F&& visitor) const
+{
+    for (const auto& pair : Range(lo, hi))
+    {
+        visitor(pair);
+    }
+}
+
+template<typename K, typename V, typename C, size_t N>
+template<typename F>
+void BTreeMap<K, V, C, N>::ForEachInRange(const KeyType& lo, const KeyType& hi, F&& visitor)
+{
+    for (auto& pair : Range(lo, hi))
+    {
+        visitor(pair);
+    }
+}
+
+template<typename K, typename V, typename C, size_t N>
+const typename BTreeMap<K, V, C, N>::DataType& BTreeMap<K, V, C, N>::Min() const noexcept
+{
+    return tree.Min();
+}
+
+template<typename K, typename V, typename C, size_t N>
+const typename BTreeMap<K, V, C, N>::DataType& BTreeMap<K, V, C, N>::Max() const noexcept
+{
+    return tree.Max();
+}
+
+template<typename K, typename V, typename C, size_t N>
+size_t BTreeMap<K, V, C, N>::Size() const noexcept
+{
+    return tree.Size();
+}
+
+template<typename K, typename V, typename C, size_t N>
+typename BTreeMap<K, V, C, N>::Iterator BTreeMap<K, V, C, N>::begin() noexcept
+{
+    return tree.begin();
+}
+
+template<typename K, typename V, typename C, size_t N>
+typename BTreeMap<K, V, C, N>::Iterator BTreeMap<K, V, C, N>::end() noexcept
+{
+    return tree.end();
+}
+
+template<typename K, typename V, typename C, size_t N>
+typename BTreeMap<K, V, C, N>::ConstIterator BTreeMap<K, V, C, N>::begin() const noexcept
+{
+    return tree.begin();
+}
+
+template<typename K, typename V, typename C, size_t N>
+typename BTreeMap<K, V, C, N>::ConstIterator BTreeMap<K, V, C, N>::end() const noexcept
+{
+    return tree.end();
+}
+
+template<typename K, typename V, typename C, size_t N>
+typename BTreeMap<K, V, C, N>::ConstIterator BTreeMap<K, V, C, N>::cbegin() const noexcept
+{
+    return tree.cbegin();
+}
+
+template<typename K, typename V, typename C, size_t N>
+typename BTreeMap<K, V, C, N>::ConstIterator BTreeMap<K, V, C, N>::cend() const noexcept
+{
+    return tree.cend();
+}
+
+template<typename K, typename V, typename C, size_t N>
+std::string BTreeMap<K, V, C, N>::ToString() const
+{
+    size_t i = 0;
+    std::string result = "{";
+    for (const auto& pair : tree)
+    {
+        result += Utils::Parser::ToString(pair.first) + ": " + Utils::Parser::ToString(pair.second);
+        if (++i < tree.Size())
+        {
+            result += ", ";
+        }
+    }
+    result += "}";
+
+    return result;
+}
+
+template<typename K, typename V, typename C, size_t N>
+std::ostream& operator<<(std::ostream& os, const BTreeMap<K, V, C, N>& map)
+{
+    return os << map.tree;
+}
+
+template<typename K, typename V, typename C, size_t N>
+std::istream& operator>>(std::istream& is, BTreeMap<K, V, C, N>& map)
+{
+    return is >> map.tree;
+}
\ No newline at end of file
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "DynamicArray.h"
+
+/**
+ * Fixed size set of bits packed into 64-bit words
+ */
+class Bitset
+{
+public:
+    [[nodiscard]] static constexpr const char* ClassName() { return "Bitset"; }
+
+    Bitset() = default;
+    explicit Bitset(size_t size);
+
+    /**
+     * Changes size to newSize and clears all bits, memory is reallocated only if the bitset has to grow
+     */
+    void Reset(size_t newSize);
+    void Clear();
+
+    void Set(size_t position);
+    void Unset(size_t position);
+    [[nodiscard]] bool Test(size_t position) const;
+
+    /**
+     * Sets the bit
+     * @return previous value of the bit
+     */
+    bool TestAndSet(size_t position);
+
+    [[nodiscard]] size_t Size() const noexcept;
+
+private:
+    static constexpr size_t BITS_PER_WORD = 64;
+
+    [[nodiscard]] static size_t GetNumberOfWords(size_t size) noexcept;
+    [[nodiscard]] static uint64_t GetMask(size_t position) noexcept;
+
+    DynamicArray<uint64_t> words;
+    size_t size = 0;
+};
+
+inline Bitset::Bitset(size_t size)
+    : words(GetNumberOfWords(size), 0)
+    , size(size)
+{ }
+
+inline void Bitset::Reset(size_t newSize)
+{
+    if (words.Size() < GetNumberOfWords(newSize))
+    {
+        words = DynamicArray<uint64_t>(GetNumberOfWords(newSize), 0);
+        size = newSize;
+        return;
+    }
+
+    size = newSize;
+    Clear();
+}
+
+inline void Bitset::Clear()
+{
+    for (size_t i = 0; i < GetNumberOfWords(size); i++)
+    {
+        words[i] = 0;
+    }
+}
+
+inline void Bitset::Set(size_t position)
+{
+    words[position / BITS_PER_WORD] |= GetMask(position);
+}
+
+inline void Bitset::Unset(size_t position)
+{
+    words[position / BITS_PER_WORD] &= ~GetMask(position);
+}
+
+inline bool Bitset::Test(size_t position) const
+{
+    return (words[position / BITS_PER_WORD] & GetMask(position)) != 0;
+}
+
+inline bool Bitset::TestAndSet(size_t position)
+{
+    auto& word = words[position / BITS_PER_WORD];
+    const bool wasSet = (word & GetMask(position)) != 0;
+    word |= GetMask(position);
+    return wasSet;
+}
+
+inline size_t Bitset::Size() const noexcept
+{
+    return size;
+}
+
+inline size_t Bitset::GetNumberOfWords(size_t size) noexcept
+{
+    return (size + BITS_PER_WORD - 1) / BITS_PER_WORD;
+}
+
+inline uint64_t Bitset::GetMask(size_t position) noexcept
+{
+    return uint64_t{1} << (position % BITS_PER_WORD);
+}
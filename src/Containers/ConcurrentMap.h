@@ -0,0 +1,235 @@
+#pragma once
+
+#include "PersistentMap.h"
+#include "Utils/Epoch.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+/**
+ * Ordered map for many readers and few writers. Readers never wait: they search the current version
+ * of a persistent tree kept alive by Utils::Epoch. Writers are serialized, publish a new version sharing
+ * unchanged nodes with the previous one and free old versions once no reader can see them.
+ * Every operation takes effect at the moment the version is read or published
+ */
+template<typename K, typename V, typename C = MapComparator<Utils::Pair<const K, V>>>
+class ConcurrentMap
+{
+public:
+    using KeyType = K;
+    using ValueType = V;
+    using Comparator = C;
+    using DataType = Utils::Pair<const K, V>;
+
+    [[nodiscard]] static constexpr const char* ClassName() noexcept { return "ConcurrentMap"; }
+
+    ConcurrentMap(const Comparator& comparator = Comparator());
+    ConcurrentMap(std::initializer_list<DataType> initList, const Comparator& comparator = Comparator());
+    ConcurrentMap(const ConcurrentMap& rhs) = delete;
+    ConcurrentMap& operator=(const ConcurrentMap& rhs) = delete;
+
+    /**
+     * No other thread may use the map anymore
+     */
+    ~ConcurrentMap();
+
+    /**
+     * Wait-free, the value is copied because the version it comes from may be freed afterwards
+     */
+    [[nodiscard]] std::optional<ValueType> Find(const KeyType& key) const;
+    [[nodiscard]] bool Contains(const KeyType& key) const;
+    [[nodiscard]] size_t Size() const;
+
+    /**
+     * @return consistent view of the whole map, for iterating and range queries. O(1)
+     */
+    [[nodiscard]] PersistentMap<K, V, C> Snapshot() const;
+
+    /**
+     * @return false if the key already exists
+     */
+    bool Insert(const DataType& value);
+    void InsertOrAssign(const DataType& value);
+    bool Remove(const KeyType& key);
+    void Clear();
+
+    /**
+     * Calls update with a copy of the current version and publishes it, so readers see all changes at once
+     */
+    template<typename F>
+    void Update(F&& update);
+
+    [[nodiscard]] std::string ToString() const;
+
+private:
+    struct Version
+    {
+        PersistentMap<K, V, C> map;
+        uint64_t retireEpoch;
+        Version* next;
+    };
+
+    /**
+     * Publishes the version if update returns true
+     * @return result of update
+     */
+    template<typename F>
+    bool Publish(F&& update);
+
+    /**
+     * Frees retired versions which no reader can see anymore, writerMutex has to be locked
+     */
+    void Reclaim() noexcept;
+
+    std::atomic<Version*> current;
+    std::mutex writerMutex;
+    Version* retired = nullptr;                                     // Od najnowszej
+};
+
+template<typename K, typename V, typename C>
+ConcurrentMap<K, V, C>::ConcurrentMap(const Comparator& comparator)
+    : current(new Version {PersistentMap<K, V, C>(comparator), 0u, nullptr})
+{ }
+
+template<typename K, typename V, typename C>
+ConcurrentMap<K, V, C>::ConcurrentMap(std::initializer_list<DataType> initList, const Comparator& comparator)
+    : current(new Version {PersistentMap<K, V, C>(initList, comparator), 0u, nullptr})
+{ }
+
+template<typename K, typename V, typename C>
+ConcurrentMap<K, V, C>::~ConcurrentMap()
+{
+    delete current.load();
+    while (retired != nullptr)
+    {
+        auto* next = retired->next;
+        delete retired;
+        retired = next;
+    }
+}
+
+template<typename K, typename V, typename C>
+std::optional<typename ConcurrentMap<K, V, C>::ValueType> ConcurrentMap<K, V, C>::Find(const KeyType& key) const
+{
+    Utils::Epoch::Guard guard;
+    const auto* value = current.load()->map.Lookup(key);
+    if (value != nullptr)
+    {
+        return *value;
+    }
+    return std::nullopt;
+}
+
+template<typename K, typename V, typename C>
+bool ConcurrentMap<K, V, C>::Contains(const KeyType& key) const
+{
+    Utils::Epoch::Guard guard;
+    return current.load()->map.Lookup(key) != nullptr;
+}
+
+template<typename K, typename V, typename C>
+size_t ConcurrentMap<K, V, C>::Size() const
+{
+    Utils::Epoch::Guard guard;
+    return current.load()->map.Size();
+}
+
+template<typename K, typename V, typename C>
+PersistentMap<K, V, C> ConcurrentMap<K, V, C>::Snapshot() const
+{
+    Utils::Epoch::Guard guard;
+    return current.load()->map.Snapshot();
+}
+
+template<typename K, typename V, typename C>
+bool ConcurrentMap<K, V, C>::Insert(const DataType& value)
+{
+    return Publish([&value](PersistentMap<K, V, C>& map) {
+        return map.Insert(value) != map.end();
+    });
+}
+
+template<typename K, typename V, typename C>
+void ConcurrentMap<K, V, C>::InsertOrAssign(const DataType& value)
+{
+    Publish([&value](PersistentMap<K, V, C>& map) {
+        map.InsertOrAssign(value);
+        return true;
+    });
+}
+
+template<typename K, typename V, typename C>
+bool ConcurrentMap<K, V, C>::Remove(const KeyType& key)
+{
+    return Publish([&key](PersistentMap<K, V, C>& map) {
+        return map.Remove(key);
+    });
+}
+
+template<typename K, typename V, typename C>
+void ConcurrentMap<K, V, C>::Clear()
+{
+    Publish([](PersistentMap<K, V, C>& map) {
+        map.Clear();
+        return true;
+    });
+}
+
+template<typename K, typename V, typename C>
+template<typename F>
+void ConcurrentMap<K, V, C>::Update(F&& update)
+{
+    Publish([&update](PersistentMap<K, V, C>& map) {
+        update(map);
+        return true;
+    });
+}
+
+template<typename K, typename V, typename C>
+std::string ConcurrentMap<K, V, C>::ToString() const
+{
+    return Snapshot().ToString();
+}
+
+template<typename K, typename V, typename C>
+template<typename F>
+bool ConcurrentMap<K, V, C>::Publish(F&& update)
+{
+    std::lock_guard lock(writerMutex);
+
+    auto version = std::make_unique<Version>(Version {current.load(std::memory_order_relaxed)->map.Snapshot(), 0u, nullptr});
+    if (!update(version->map))                                      // Współdzielone węzły są kopiowane,
+    {                                                               // czytelnicy ich nie zobaczą zmienionych
+        return false;
+    }
+
+    auto* previous = current.exchange(version.release());
+    previous->retireEpoch = Utils::Epoch::Advance();
+    previous->next = retired;
+    retired = previous;
+    Reclaim();
+
+    return true;
+}
+
+template<typename K, typename V, typename C>
+void ConcurrentMap<K, V, C>::Reclaim() noexcept
+{
+    const auto minActive = Utils::Epoch::MinActive();
+    Version** link = &retired;
+    while (*link != nullptr && (*link)->retireEpoch > minActive)   // Starsze wersje mają mniejsze epoki
+    {
+        link = &(*link)->next;
+    }
+
+    auto* version = *link;
+    *link = nullptr;
+    while (version != nullptr)
+    {
+        auto* next = version->next;
+        delete version;
+        version = next;
+    }
+}
\ No newline at end of file
@@ -1,8 +1,18 @@
 #pragma once
 
 #include "DynamicArray.h"
-
-template<typename T, typename C = Utils::Greater<T>>
+#include "Utils/Range.h"
+
+#include <algorithm>
+#include <type_traits>
+
+/**
+ * Binary heap, the element going first according to the comparator is on top.
+ * Like in IndexedHeap arrays are never shrunk, so Insert and Pop are O(log n) amortized.
+ * With TrackPositions set, Insert returns a handle and the slot of every element is tracked,
+ * so the element can be removed or updated through the handle in O(log n) amortized
+ */
+template<typename T, typename C = Utils::Greater<T>, bool TrackPositions = false>
 class Heap
 {
 public:
@@ -11,6 +21,19 @@ public:
     using Iterator = typename DynamicArray<DataType>::Iterator;
     using ConstIterator = typename DynamicArray<DataType>::ConstIterator;
 
+    /**
+     * Identifies an element until it is removed, afterwards it may be given to a new one
+     */
+    struct Handle
+    {
+        size_t id;
+
+        [[nodiscard]] bool operator==(const Handle& rhs) const noexcept { return id == rhs.id; }
+        [[nodiscard]] bool operator!=(const Handle& rhs) const noexcept { return id != rhs.id; }
+    };
+
+    using InsertResult = std::conditional_t<TrackPositions, Handle, void>;
+
     [[nodiscard]] static constexpr const char* ClassName() { return "Heap"; }
 
     explicit Heap(const Comparator& comparator = Comparator());
@@ -18,17 +41,39 @@ public:
     explicit Heap(const DynamicArray<T>& array, const Comparator& comparator = Comparator());
 
     void Assign(const DynamicArray<T>& array);
-    void Insert(const DataType& value);
+    InsertResult Insert(const DataType& value);
     bool Remove(const DataType& value);
     void Pop();
     void Clear();
 
+    /**
+     * @return false if the handle is not valid
+     */
+    bool Remove(Handle handle);
+
+    /**
+     * Replaces value of the element and restores its place in the heap
+     * @return false if the handle is not valid
+     */
+    bool Update(Handle handle, const DataType& value);
+
+    [[nodiscard]] bool Contains(Handle handle) const noexcept;
+
+    /**
+     * @throw std::out_of_range if the handle is not valid
+     */
+    [[nodiscard]] const DataType& Get(Handle handle) const;
+    [[nodiscard]] Handle FirstHandle() const;
+
     [[nodiscard]] Iterator Find(const DataType& value) noexcept;
     [[nodiscard]] ConstIterator Find(const DataType& value) const noexcept;
 
     [[nodiscard]] const DataType& First() const;
 
-    [[nodiscard]] const DynamicArray<T>& Array() const;
+    /**
+     * @return elements in the order they are laid out
+     */
+    [[nodiscard]] Utils::Range<ConstIterator> Array() const noexcept;
     [[nodiscard]] size_t Size() const noexcept;
 
     [[nodiscard]] Iterator begin() noexcept;
@@ -40,17 +85,27 @@ public:
 
     [[nodiscard]] std::string ToString() const;
 
-    template<typename U, typename V>
-    friend std::ostream& operator<<(std::ostream& os, const Heap<U, V>& heap);
+    template<typename U, typename V, bool W>
+    friend std::ostream& operator<<(std::ostream& os, const Heap<U, V, W>& heap);
 
-    template<typename U, typename V>
-    friend std::istream& operator>>(std::istream& is, Heap<U, V>& heap);
+    template<typename U, typename V, bool W>
+    friend std::istream& operator>>(std::istream& is, Heap<U, V, W>& heap);
 
 private:
+    static constexpr size_t NOT_IN_HEAP = SIZE_MAX;
+
     [[nodiscard]] static size_t Parent(size_t node) noexcept;
 
+    /**
+     * Grows the array geometrically to hold at least count elements
+     */
+    template<typename U>
+    static void Reserve(DynamicArray<U>& array, size_t count);
+
     void RemoveAt(size_t node);
+    void RestoreUp(size_t node);
     void RestoreDown(size_t node);
+    void SwapNodes(size_t lhs, size_t rhs);
 
     [[nodiscard]] size_t Find(const DataType& value, size_t root) const;
 
@@ -60,16 +115,22 @@ private:
     void ToString(std::string& result, const std::string& prefix, size_t node, bool isRight) const;
 
     Comparator comparator;
-    DynamicArray<DataType> data;
+    DynamicArray<DataType> data;                                    // Elementy kopca to [0, size)
+    DynamicArray<size_t> handles;                                   // Puste, jeśli pozycje nie są śledzone
+    DynamicArray<size_t> positions;                                 // Indeksowane uchwytem
+    DynamicArray<size_t> freeHandles;                               // Stos, [0, numberOfFreeHandles)
+    size_t size = 0u;
+    size_t numberOfHandles = 0u;
+    size_t numberOfFreeHandles = 0u;
 };
 
-template<typename T, typename C>
-Heap<T, C>::Heap(const Comparator& comparator)
+template<typename T, typename C, bool P>
+Heap<T, C, P>::Heap(const Comparator& comparator)
     : comparator(comparator)
 { }
 
-template<typename T, typename C>
-Heap<T, C>::Heap(std::initializer_list<DataType> initList, const Comparator& comparator)
+template<typename T, typename C, bool P>
+Heap<T, C, P>::Heap(std::initializer_list<DataType> initList, const Comparator& comparator)
     : comparator(comparator)
 {
     for (const auto& element: initList)
@@ -78,44 +139,71 @@ Heap<T, C>::Heap(std::initializer_list<DataType> initList, const Comparator& com
     }
 }
 
-template<typename T, typename C>
-Heap<T, C>::Heap(const DynamicArray<T>& array, const Comparator& comparator)
+template<typename T, typename C, bool P>
+Heap<T, C, P>::Heap(const DynamicArray<T>& array, const Comparator& comparator)
     : comparator(comparator)
 {
     Assign(array);
 }
 
-template<typename T, typename C>
-void Heap<T, C>::Assign(const DynamicArray<T>& array)
+template<typename T, typename C, bool P>
+void Heap<T, C, P>::Assign(const DynamicArray<T>& array)
 {
     data = array;
-    for (size_t i = array.Size() / 2 - 1; i-- > 0;)
+    size = array.Size();
+    if constexpr (P)
+    {
+        handles = DynamicArray<size_t>(size);
+        positions = DynamicArray<size_t>(size);
+        for (size_t i = 0; i < size; i++)
+        {
+            handles[i] = positions[i] = i;
+        }
+        numberOfHandles = size;
+        numberOfFreeHandles = 0u;
+    }
+
+    for (size_t i = size / 2; i-- > 0;)
     {
         RestoreDown(i);
     }
 }
 
-template<typename T, typename C>
-void Heap<T, C>::Insert(const DataType& value)
+template<typename T, typename C, bool P>
+typename Heap<T, C, P>::InsertResult Heap<T, C, P>::Insert(const DataType& value)
 {
-    data.PushBack(value);
-    size_t position = data.Size() - 1;
-    size_t nextPosition = (position - 1) / 2;
+    Reserve(data, size + 1);
+    data[size] = value;
+    if constexpr (P)
+    {
+        size_t id = numberOfHandles;
+        if (numberOfFreeHandles > 0)
+        {
+            id = freeHandles[--numberOfFreeHandles];
+        }
+        else
+        {
+            Reserve(positions, ++numberOfHandles);
+        }
+        Reserve(handles, size + 1);
+        handles[size] = id;
+        positions[id] = size;
 
-    while (position != 0u && comparator(value, data[nextPosition]))
+        RestoreUp(size++);
+        return Handle {id};
+    }
+    else
     {
-        Utils::Swap(data[position], data[nextPosition]);
-        position = nextPosition;
-        nextPosition = Parent(position);
+        RestoreUp(size++);
     }
 }
 
-template<typename T, typename C>
-bool Heap<T, C>::Remove(const DataType& value)
+template<typename T, typename C, bool P>
+bool Heap<T, C, P>::Remove(const DataType& value)
 {
     size_t position = Find(value, 0u);
 
-    if (position == data.Size())
+    if (position == size)
     {
         return false;
     }
@@ -124,58 +212,128 @@ bool Heap<T, C>::Remove(const DataType& value)
     return true;
 }
 
-template<typename T, typename C>
-void Heap<T, C>::Pop()
+template<typename T, typename C, bool P>
+void Heap<T, C, P>::Pop()
 {
     RemoveAt(0u);
 }
 
-template<typename T, typename C>
-typename Heap<T, C>::ConstIterator Heap<T, C>::Find(const DataType& value) const noexcept
+template<typename T, typename C, bool P>
+bool Heap<T, C, P>::Remove(Handle handle)
 {
-    return data.Find(value);
+    static_assert(P, "Handles require tracking positions");
+
+    if (!Contains(handle))
+    {
+        return false;
+    }
+
+    RemoveAt(positions[handle.id]);
+    return true;
 }
 
-template<typename T, typename C>
-typename Heap<T, C>::Iterator Heap<T, C>::Find(const DataType& value) noexcept
+template<typename T, typename C, bool P>
+bool Heap<T, C, P>::Update(Handle handle, const DataType& value)
 {
-    return data.Find(value);
+    static_assert(P, "Handles require tracking positions");
+
+    if (!Contains(handle))
+    {
+        return false;
+    }
+
+    data[positions[handle.id]] = value;
+    RestoreUp(positions[handle.id]);
+    RestoreDown(positions[handle.id]);
+    return true;
 }
 
-template<typename T, typename C>
-const DynamicArray<T>& Heap<T, C>::Array() const
+template<typename T, typename C, bool P>
+bool Heap<T, C, P>::Contains(Handle handle) const noexcept
 {
-    return data;
+    static_assert(P, "Handles require tracking positions");
+
+    return handle.id < numberOfHandles && positions[handle.id] != NOT_IN_HEAP;
 }
 
-template<typename T, typename C>
-const typename Heap<T, C>::DataType& Heap<T, C>::First() const
+template<typename T, typename C, bool P>
+const typename Heap<T, C, P>::DataType& Heap<T, C, P>::Get(Handle handle) const
 {
+    static_assert(P, "Handles require tracking positions");
+
+    if (!Contains(handle))
+    {
+        throw std::out_of_range("No such element exists");
+    }
+    return data[positions[handle.id]];
+}
+
+template<typename T, typename C, bool P>
+typename Heap<T, C, P>::Handle Heap<T, C, P>::FirstHandle() const
+{
+    static_assert(P, "Handles require tracking positions");
+
+    if (size == 0u)
+    {
+        throw std::out_of_range("Index is out of range");
+    }
+    return Handle {handles[0]};
+}
+
+template<typename T, typename C, bool P>
+typename Heap<T, C, P>::ConstIterator Heap<T, C, P>::Find(const DataType& value) const noexcept
+{
+    return std::find(cbegin(), cend(), value);
+}
+
+template<typename T, typename C, bool P>
+typename Heap<T, C, P>::Iterator Heap<T, C, P>::Find(const DataType& value) noexcept
+{
+    return std::find(begin(), end(), value);
+}
+
+template<typename T, typename C, bool P>
+Utils::Range<typename Heap<T, C, P>::ConstIterator> Heap<T, C, P>::Array() const noexcept
+{
+    return {cbegin(), cend()};
+}
+
+template<typename T, typename C, bool P>
+const typename Heap<T, C, P>::DataType& Heap<T, C, P>::First() const
+{
+    if (size == 0u)
+    {
+        throw std::out_of_range("Index is out of range");
+    }
     return data[0];
 }
 
-template<typename T, typename C>
-void Heap<T, C>::Clear()
+template<typename T, typename C, bool P>
+void Heap<T, C, P>::Clear()
 {
     data.Clear();
+    handles.Clear();
+    positions.Clear();
+    freeHandles.Clear();
+    size = numberOfHandles = numberOfFreeHandles = 0u;
 }
 
-template<typename T, typename C>
-size_t Heap<T, C>::Size() const noexcept
+template<typename T, typename C, bool P>
+size_t Heap<T, C, P>::Size() const noexcept
 {
-    return data.Size();
+    return size;
 }
 
-template<typename T, typename C>
-size_t Heap<T, C>::Find(const DataType& value, size_t root) const
+template<typename T, typename C, bool P>
+size_t Heap<T, C, P>::Find(const DataType& value, size_t root) const
 {
-    if (root >= data.Size())
+    if (root >= size)
     {
-        return data.Size();
+        return size;
     }
-    if (data[root] < value)
-    {
-        return data.Size();
+    if (comparator(value, data[root]))                              // Poddrzewo zawiera tylko elementy
+    {                                                               // nie wyprzedzające korzenia
+        return size;
     }
     if (data[root] == value)
     {
@@ -185,66 +343,90 @@ size_t Heap<T, C>::Find(const DataType& value, size_t root) const
     size_t leftFind = Find(value, Left(root));
     size_t rightFind = Find(value, Right(root));
 
-    return leftFind != data.Size() ? leftFind : rightFind;
+    return leftFind != size ? leftFind : rightFind;
 }
 
-template<typename T, typename C>
-size_t Heap<T, C>::Left(size_t parent) const noexcept
+template<typename T, typename C, bool P>
+size_t Heap<T, C, P>::Left(size_t parent) const noexcept
 {
     size_t left = 2u * parent + 1u;
-    if (left >= data.Size())
+    if (left >= size)
     {
-        return data.Size();
+        return size;
     }
     return left;
 }
 
-template<typename T, typename C>
-size_t Heap<T, C>::Right(size_t parent) const noexcept
+template<typename T, typename C, bool P>
+size_t Heap<T, C, P>::Right(size_t parent) const noexcept
 {
     size_t right = 2u * parent + 2u;
-    if (right >= data.Size())
+    if (right >= size)
     {
-        return data.Size();
+        return size;
     }
     return right;
 }
 
-template<typename T, typename C>
-size_t Heap<T, C>::Parent(size_t node) noexcept
+template<typename T, typename C, bool P>
+size_t Heap<T, C, P>::Parent(size_t node) noexcept
 {
     return (node - 1) / 2;
 }
 
-template<typename T, typename C>
-void Heap<T, C>::RemoveAt(size_t node)
+template<typename T, typename C, bool P>
+template<typename U>
+void Heap<T, C, P>::Reserve(DynamicArray<U>& array, size_t count)
 {
-    if (node >= Size())
+    if (count > array.Size())
     {
-        return;
+        array.Resize(Utils::Max(count, 2u * array.Size()));
     }
-    if (Size() == 1u)
+}
+
+template<typename T, typename C, bool P>
+void Heap<T, C, P>::RemoveAt(size_t node)
+{
+    if (node >= size)
     {
-        data.RemoveBack();
         return;
     }
 
-    data[node] = data[Size() - 1];
-    data.RemoveBack();
+    SwapNodes(node, --size);                                        // Usunięty element zostaje poza [0, size)
+    if constexpr (P)
+    {
+        positions[handles[size]] = NOT_IN_HEAP;
+        Reserve(freeHandles, numberOfFreeHandles + 1);
+        freeHandles[numberOfFreeHandles++] = handles[size];
+    }
 
-    RestoreDown(node);
+    if (node < size)                                              // Ostatni element mógł pochodzić
+    {                                                               // z innego poddrzewa
+        RestoreUp(node);
+        RestoreDown(node);
+    }
 }
 
-template<typename T, typename C>
-void Heap<T, C>::RestoreDown(size_t node)
+template<typename T, typename C, bool P>
+void Heap<T, C, P>::RestoreUp(size_t node)
+{
+    while (node != 0u && comparator(data[node], data[Parent(node)]))
+    {
+        SwapNodes(node, Parent(node));
+        node = Parent(node);
+    }
+}
+
+template<typename T, typename C, bool P>
+void Heap<T, C, P>::RestoreDown(size_t node)
 {
     size_t current_position = node;
 
     size_t left = Left(current_position);
-    bool isLeft = left != data.Size();
+    bool isLeft = left != size;
 
     size_t right = Right(current_position);
-    bool isRight = right != data.Size();
+    bool isRight = right != size;
 
     while ((isLeft && comparator(data[left], data[current_position])) ||
           (isRight && comparator(data[right], data[current_position])))
@@ -258,57 +440,69 @@ void Heap<T, C>::RestoreDown(size_t node)
         {
             next_position = isLeft ? left : right;
         }
-        Utils::Swap(data[current_position], data[next_position]);
+        SwapNodes(current_position, next_position);
         current_position = next_position;
 
         left = Left(current_position);
-        isLeft = left != data.Size();
+        isLeft = left != size;
 
         right = Right(current_position);
-        isRight = right != data.Size();
+        isRight = right != size;
     }
 }
 
-template<typename T, typename C>
-typename Heap<T, C>::Iterator Heap<T, C>::begin() noexcept
+template<typename T, typename C, bool P>
+void Heap<T, C, P>::SwapNodes(size_t lhs, size_t rhs)
+{
+    Utils::Swap(data[lhs], data[rhs]);
+    if constexpr (P)
+    {
+        Utils::Swap(handles[lhs], handles[rhs]);
+        positions[handles[lhs]] = lhs;
+        positions[handles[rhs]] = rhs;
+    }
+}
+
+template<typename T, typename C, bool P>
+typename Heap<T, C, P>::Iterator Heap<T, C, P>::begin() noexcept
 {
     return data.begin();
 }
 
-template<typename T, typename C>
-typename Heap<T, C>::Iterator Heap<T, C>::end() noexcept
+template<typename T, typename C, bool P>
+typename Heap<T, C, P>::Iterator Heap<T, C, P>::end() noexcept
 {
-    return data.end();
+    return data.begin() + static_cast<std::ptrdiff_t>(size);
 }
 
-template<typename T, typename C>
-typename Heap<T, C>::ConstIterator Heap<T, C>::begin() const noexcept
+template<typename T, typename C, bool P>
+typename Heap<T, C, P>::ConstIterator Heap<T, C, P>::begin() const noexcept
 {
     return data.begin();
 }
 
-template<typename T, typename C>
-typename Heap<T, C>::ConstIterator Heap<T, C>::end() const noexcept
+template<typename T, typename C, bool P>
+typename Heap<T, C, P>::ConstIterator Heap<T, C, P>::end() const noexcept
 {
-    return data.end();
+    return data.begin() + static_cast<std::ptrdiff_t>(size);
 }
 
-template<typename T, typename C>
-typename Heap<T, C>::ConstIterator Heap<T, C>::cbegin() const noexcept
+template<typename T, typename C, bool P>
+typename Heap<T, C, P>::ConstIterator Heap<T, C, P>::cbegin() const noexcept
 {
     return data.cbegin();
 }
 
-template<typename T, typename C>
-typename Heap<T, C>::ConstIterator Heap<T, C>::cend() const noexcept
+template<typename T, typename C, bool P>
+typename Heap<T, C, P>::ConstIterator Heap<T, C, P>::cend() const noexcept
 {
-    return data.cend();
+    return data.cbegin() + static_cast<std::ptrdiff_t>(size);
 }
 
-template<typename T, typename C>
-void Heap<T, C>::ToString(std::string& result, const std::string& prefix, size_t node, bool isRight) const
+template<typename T, typename C, bool P>
+void Heap<T, C, P>::ToString(std::string& result, const std::string& prefix, size_t node, bool isRight) const
 {
-    if (node != data.Size())
+    if (node != size)
     {
         result += prefix;
 
@@ -322,22 +516,29 @@ void Heap<T, C>::ToString(std::string& result, const std::string& prefix, size_t
     }
 }
 
-template<typename T, typename C>
-std::string Heap<T, C>::ToString() const
+template<typename T, typename C, bool P>
+std::string Heap<T, C, P>::ToString() const
 {
     std::string result;
     ToString(result, "", 0, false);
     return result;
 }
 
-template<typename T, typename C>
-std::ostream& operator<<(std::ostream& os, const Heap<T, C>& heap)
+template<typename T, typename C, bool P>
+std::ostream& operator<<(std::ostream& os, const Heap<T, C, P>& heap)
 {
-    return os << heap.data;
+    DynamicArray<T> array(heap.size);
+    std::copy(heap.cbegin(), heap.cend(), array.begin());
+
+    return os << array;
 }
 
-template<typename T, typename C>
-std::istream& operator>>(std::istream& is, Heap<T, C>& array)
+template<typename T, typename C, bool P>
+std::istream& operator>>(std::istream& is, Heap<T, C, P>& heap)
 {
-    return is >> array.data;
+    DynamicArray<T> array;
+    is >> array;
+    heap.Assign(array);
+
+    return is;
 }
\ No newline at end of file
@@ -0,0 +1,200 @@
+#pragma once
+
+#include "DynamicArray.h"
+
+/**
+ * Binary heap of keys from [0, capacity) ordered by their priorities.
+ * Position of every key is tracked, so priority of a key can be decreased in O(log n)
+ */
+template<typename P, typename C = Utils::Less<P>>
+class IndexedHeap
+{
+public:
+    using Key = uint32_t;
+    using Priority = P;
+    using Comparator = C;
+
+    [[nodiscard]] static constexpr const char* ClassName() { return "IndexedHeap"; }
+
+    explicit IndexedHeap(Key capacity, const Comparator& comparator = Comparator());
+
+    /**
+     * Inserts the key or, if it is already in the heap, changes its priority when the new one goes first
+     * @return true if the key was inserted or its priority was changed
+     */
+    bool Push(Key key, const Priority& priority);
+    void Pop();
+    void Clear() noexcept;
+
+    [[nodiscard]] Key Top() const;
+    [[nodiscard]] const Priority& TopPriority() const;
+    [[nodiscard]] const Priority& GetPriority(Key key) const;
+
+    [[nodiscard]] bool Contains(Key key) const noexcept;
+    [[nodiscard]] bool IsEmpty() const noexcept;
+    [[nodiscard]] size_t Size() const noexcept;
+    [[nodiscard]] Key Capacity() const noexcept;
+
+private:
+    static constexpr size_t NOT_IN_HEAP = SIZE_MAX;
+
+    void RestoreUp(size_t node);
+    void RestoreDown(size_t node);
+    void Place(size_t node, Key key);
+
+    [[nodiscard]] bool GoesFirst(Key lhs, Key rhs) const;
+
+    Comparator comparator;
+    DynamicArray<Key> keys;
+    DynamicArray<size_t> positions;
+    DynamicArray<Priority> priorities;
+    size_t size;
+};
+
+template<typename P, typename C>
+IndexedHeap<P, C>::IndexedHeap(Key capacity, const Comparator& comparator)
+    : comparator(comparator)
+    , keys(capacity)
+    , positions(capacity, NOT_IN_HEAP)
+    , priorities(capacity)
+    , size(0)
+{ }
+
+template<typename P, typename C>
+bool IndexedHeap<P, C>::Push(Key key, const Priority& priority)
+{
+    if (!Contains(key))
+    {
+        priorities[key] = priority;
+        Place(size, key);
+        RestoreUp(size++);
+        return true;
+    }
+    if (comparator(priority, priorities[key]))
+    {
+        priorities[key] = priority;
+        RestoreUp(positions[key]);
+        return true;
+    }
+    return false;
+}
+
+template<typename P, typename C>
+void IndexedHeap<P, C>::Pop()
+{
+    if (IsEmpty())
+    {
+        return;
+    }
+
+    positions[keys[0]] = NOT_IN_HEAP;
+    size--;
+    if (size > 0)
+    {
+        Place(0, keys[size]);
+        RestoreDown(0);
+    }
+}
+
+template<typename P, typename C>
+void IndexedHeap<P, C>::Clear() noexcept
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        positions[keys[i]] = NOT_IN_HEAP;
+    }
+    size = 0;
+}
+
+template<typename P, typename C>
+typename IndexedHeap<P, C>::Key IndexedHeap<P, C>::Top() const
+{
+    return keys[0];
+}
+
+template<typename P, typename C>
+const typename IndexedHeap<P, C>::Priority& IndexedHeap<P, C>::TopPriority() const
+{
+    return priorities[keys[0]];
+}
+
+template<typename P, typename C>
+const typename IndexedHeap<P, C>::Priority& IndexedHeap<P, C>::GetPriority(Key key) const
+{
+    return priorities[key];
+}
+
+template<typename P, typename C>
+bool IndexedHeap<P, C>::Contains(Key key) const noexcept
+{
+    return key < Capacity() && positions[key] != NOT_IN_HEAP;
+}
+
+template<typename P, typename C>
+bool IndexedHeap<P, C>::IsEmpty() const noexcept
+{
+    return size == 0;
+}
+
+template<typename P, typename C>
+size_t IndexedHeap<P, C>::Size() const noexcept
+{
+    return size;
+}
+
+template<typename P, typename C>
+typename IndexedHeap<P, C>::Key IndexedHeap<P, C>::Capacity() const noexcept
+{
+    return static_cast<Key>(keys.Size());
+}
+
+template<typename P, typename C>
+void IndexedHeap<P, C>::RestoreUp(size_t node)
+{
+    const Key key = keys[node];
+    while (node > 0)
+    {
+        const size_t parent = (node - 1) / 2;
+        if (!GoesFirst(key, keys[parent]))
+        {
+            break;
+        }
+        Place(node, keys[parent]);
+        node = parent;
+    }
+    Place(node, key);
+}
+
+template<typename P, typename C>
+void IndexedHeap<P, C>::RestoreDown(size_t node)
+{
+    const Key key = keys[node];
+    while (2 * node + 1 < size)
+    {
+        size_t child = 2 * node + 1;
+        if (child + 1 < size && GoesFirst(keys[child + 1], keys[child]))
+        {
+            child++;
+        }
+        if (!GoesFirst(keys[child], key))
+        {
+            break;
+        }
+        Place(node, keys[child]);
+        node = child;
+    }
+    Place(node, key);
+}
+
+template<typename P, typename C>
+void IndexedHeap<P, C>::Place(size_t node, Key key)
+{
+    keys[node] = key;
+    positions[key] = node;
+}
+
+template<typename P, typename C>
+bool IndexedHeap<P, C>::GoesFirst(Key lhs, Key rhs) const
+{
+    return comparator(priorities[lhs], priorities[rhs]);
+}
@@ -39,6 +39,36 @@ public:
     [[nodiscard]] ConstIterator Find(const KeyType& key) const noexcept;
     [[nodiscard]] Iterator Find(const KeyType& key) noexcept;
 
+    /**
+     * @return first pair with key not less than the given one or end()
+     */
+    [[nodiscard]] ConstIterator LowerBound(const KeyType& key) const noexcept;
+    [[nodiscard]] Iterator LowerBound(const KeyType& key) noexcept;
+
+    /**
+     * @return first pair with key greater than the given one or end()
+     */
+    [[nodiscard]] ConstIterator UpperBound(const KeyType& key) const noexcept;
+    [[nodiscard]] Iterator UpperBound(const KeyType& key) noexcept;
+
+    [[nodiscard]] Utils::Range<ConstIterator> EqualRange(const KeyType& key) const noexcept;
+    [[nodiscard]] Utils::Range<Iterator> EqualRange(const KeyType& key) noexcept;
+
+    /**
+     * Lazily iterated view of pairs with keys in range [lo, hi]
+     */
+    [[nodiscard]] Utils::Range<ConstIterator> Range(const KeyType& lo, const KeyType& hi) const noexcept;
+    [[nodiscard]] Utils::Range<Iterator> Range(const KeyType& lo, const KeyType& hi) noexcept;
+
+    /**
+     * Calls the visitor with every pair with key in range [lo, hi], nothing is copied
+     */
+    template<typename F>
+    void ForEachInRange(const KeyType& lo, const KeyType& hi, F&& visitor) const;
+
+    template<typename F>
+    void ForEachInRange(const KeyType& lo, const KeyType& hi, F&& visitor);
+
     [[nodiscard]] const DataType& Min() const noexcept;
     [[nodiscard]] const DataType& Max() const noexcept;
 
@@ -151,6 +181,74 @@ typename Map<K, V, C>::Iterator Map<K, V, C>::Find(const KeyType& key) noexcept
     return tree.Find({key, ValueType()});
 }
 
+template<typename K, typename V, typename C>
+typename Map<K, V, C>::ConstIterator Map<K, V, C>::LowerBound(const KeyType& key) const noexcept
+{
+    return tree.LowerBound({key, ValueType()});
+}
+
+template<typename K, typename V, typename C>
+typename Map<K, V, C>::Iterator Map<K, V, C>::LowerBound(const KeyType& key) noexcept
+{
+    return tree.LowerBound({key, ValueType()});
+}
+
+template<typename K, typename V, typename C>
+typename Map<K, V, C>::ConstIterator Map<K, V, C>::UpperBound(const KeyType& key) const noexcept
+{
+    return tree.UpperBound({key, ValueType()});
+}
+
+template<typename K, typename V, typename C>
+typename Map<K, V, C>::Iterator Map<K, V, C>::UpperBound(const KeyType& key) noexcept
+{
+    return tree.UpperBound({key, ValueType()});
+}
+
+template<typename K, typename V, typename C>
+Utils::Range<typename Map<K, V, C>::ConstIterator> Map<K, V, C>::EqualRange(const KeyType& key) const noexcept
+{
+    return tree.EqualRange({key, ValueType()});
+}
+
+template<typename K, typename V, typename C>
+Utils::Range<typename Map<K, V, C>::Iterator> Map<K, V, C>::EqualRange(const KeyType& key) noexcept
+{
+    return tree.EqualRange({key, ValueType()});
+}
+
+template<typename K, typename V, typename C>
+Utils::Range<typename Map<K, V, C>::ConstIterator> Map<K, V, C>::Range(const KeyType& lo, const KeyType& hi) const noexcept
+{
+    return tree.Range({lo, ValueType()}, {hi, ValueType()});
+}
+
+template<typename K, typename V, typename C>
+Utils::Range<typename Map<K, V, C>::Iterator> Map<K, V, C>::Range(const KeyType& lo, const KeyType& hi) noexcept
+{
+    return tree.Range({lo, ValueType()}, {hi, ValueType()});
+}
+
+template<typename K, typename V, typename C>
+template<typename F>
+void Map<K, V, C>::ForEachInRange(const KeyType& lo, const KeyType& hi, F&& visitor) const
+{
+    for (const auto& pair : Range(lo, hi))
+    {
+        visitor(pair);
+    }
+}
+
+template<typename K, typename V, typename C>
+template<typename F>
+void Map<K, V, C>::ForEachInRange(const KeyType& lo, const KeyType& hi, F&& visitor)
+{
+    for (auto& pair : Range(lo, hi))
+    {
+        visitor(pair);
+    }
+}
+
 template<typename K, typename V, typename C>
 const typename Map<K, V, C>::DataType& Map<K, V, C>::Min() const noexcept
 {
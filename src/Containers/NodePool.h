@@ -0,0 +1,307 @@
+#pragma once
+
+#include "Utils/Utils.h"
+
+#include <atomic>
+
+/**
+ * Allocates nodes from contiguous blocks and recycles released ones. Trees which exchange nodes
+ * share or merge their pools, so groups of blocks are reference counted and freed with the last pool using them.
+ * Every pool allocates from its own free slots and adds blocks only to a group no other pool uses,
+ * so pools sharing blocks can be used concurrently
+ */
+template<typename T>
+class NodePool
+{
+public:
+    NodePool() = default;
+    NodePool(const NodePool& rhs) = delete;
+    NodePool(NodePool&& rhs) noexcept;
+    NodePool& operator=(const NodePool& rhs) = delete;
+    NodePool& operator=(NodePool&& rhs) noexcept;
+    ~NodePool();
+
+    /**
+     * @return uninitialized memory for one node
+     */
+    [[nodiscard]] void* Allocate();
+
+    /**
+     * Destroys the node and keeps its memory for next allocations
+     */
+    void Release(T* node) noexcept;
+
+    /**
+     * Makes room for count nodes in one contiguous block
+     */
+    void Reserve(size_t count);
+
+    /**
+     * Starts using blocks of rhs too, nodes allocated by any of the pools can be then released by both of them
+     */
+    void Share(const NodePool& rhs);
+
+    /**
+     * Takes over blocks and free slots of rhs, which is left empty
+     */
+    void Merge(NodePool&& rhs) noexcept;
+
+    /**
+     * @return true if no other pool uses the blocks, so dropping them frees every node allocated from them
+     */
+    [[nodiscard]] bool IsUnique() const noexcept;
+
+    /**
+     * Stops using the blocks, which are freed if no other pool uses them. Nodes are not destroyed
+     */
+    void Reset() noexcept;
+
+private:
+    union Slot
+    {
+        Slot* next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    /**
+     * Blocks freed together, shared by pools
+     */
+    struct Group
+    {
+        std::atomic<size_t> owners = 1;
+        Slot* firstBlock = nullptr;                 // Pierwszy slot każdego bloku wskazuje kolejny blok
+    };
+
+    struct GroupReference
+    {
+        Group* group;
+        GroupReference* next;
+    };
+
+    inline static constexpr size_t MIN_BLOCK_SIZE = 16;
+    inline static constexpr size_t MAX_BLOCK_SIZE = 1024;
+
+    void AddBlock(size_t count);
+    void PushFreeSlot(Slot* slot) noexcept;
+
+    /**
+     * Moves the unused part of the last block to free slots
+     */
+    void RecycleRest() noexcept;
+
+    [[nodiscard]] bool Uses(const Group* group) const noexcept;
+    static void Drop(Group* group) noexcept;
+
+    GroupReference* groups = nullptr;               // Nowe bloki trafiają do pierwszej grupy
+    Slot* freeSlots = nullptr;
+    Slot* lastFreeSlot = nullptr;
+    Slot* current = nullptr;                        // Nieużyty fragment
+    Slot* end = nullptr;                            // ostatniego bloku
+    size_t blockSize = 0;
+};
+
+template<typename T>
+NodePool<T>::NodePool(NodePool&& rhs) noexcept
+{
+    Merge(std::move(rhs));
+}
+
+template<typename T>
+NodePool<T>& NodePool<T>::operator=(NodePool&& rhs) noexcept
+{
+    if (this == &rhs)
+    {
+        return *this;
+    }
+    Reset();
+    Merge(std::move(rhs));
+
+    return *this;
+}
+
+template<typename T>
+NodePool<T>::~NodePool()
+{
+    Reset();
+}
+
+template<typename T>
+void* NodePool<T>::Allocate()
+{
+    if (freeSlots != nullptr)
+    {
+        Slot* slot = freeSlots;
+        freeSlots = slot->next;
+        return slot;
+    }
+    if (current == end)
+    {
+        AddBlock(Utils::Max(MIN_BLOCK_SIZE, Utils::Min(2 * blockSize, MAX_BLOCK_SIZE)));
+    }
+    return current++;
+}
+
+template<typename T>
+void NodePool<T>::Release(T* node) noexcept
+{
+    node->~T();
+    PushFreeSlot(reinterpret_cast<Slot*>(node));
+}
+
+template<typename T>
+void NodePool<T>::Reserve(size_t count)
+{
+    if (static_cast<size_t>(end - current) < count)
+    {
+        AddBlock(count);
+    }
+}
+
+template<typename T>
+void NodePool<T>::Share(const NodePool& rhs)
+{
+    for (const GroupReference* reference = rhs.groups; reference != nullptr; reference = reference->next)
+    {
+        if (!Uses(reference->group))
+        {
+            reference->group->owners.fetch_add(1, std::memory_order_relaxed);
+            groups = new GroupReference {reference->group, groups};
+        }
+    }
+}
+
+template<typename T>
+void NodePool<T>::Merge(NodePool&& rhs) noexcept
+{
+    if (this == &rhs)
+    {
+        return;
+    }
+
+    while (rhs.groups != nullptr)
+    {
+        GroupReference* reference = rhs.groups;
+        rhs.groups = reference->next;
+        if (Uses(reference->group))
+        {
+            Drop(reference->group);
+            delete reference;
+        }
+        else
+        {
+            reference->next = groups;
+            groups = reference;
+        }
+    }
+
+    rhs.RecycleRest();
+    if (rhs.freeSlots != nullptr)
+    {
+        if (freeSlots == nullptr)
+        {
+            lastFreeSlot = rhs.lastFreeSlot;
+        }
+        rhs.lastFreeSlot->next = freeSlots;
+        freeSlots = rhs.freeSlots;
+    }
+    rhs.Reset();
+}
+
+template<typename T>
+bool NodePool<T>::IsUnique() const noexcept
+{
+    for (const GroupReference* reference = groups; reference != nullptr; reference = reference->next)
+    {
+        if (reference->group->owners.load(std::memory_order_acquire) != 1)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename T>
+void NodePool<T>::Reset() noexcept
+{
+    while (groups != nullptr)
+    {
+        GroupReference* next = groups->next;
+        Drop(groups->group);
+        delete groups;
+        groups = next;
+    }
+    freeSlots = lastFreeSlot = nullptr;
+    current = end = nullptr;
+    blockSize = 0;
+}
+
+template<typename T>
+void NodePool<T>::AddBlock(size_t count)
+{
+    RecycleRest();
+
+    if (groups == nullptr || groups->group->owners.load(std::memory_order_acquire) != 1)
+    {
+        // Do współdzielonej grupy mogą jednocześnie dodawać bloki inne pule
+        auto* group = new Group;
+        groups = new GroupReference {group, groups};
+    }
+
+    Slot* block = new Slot[count + 1];
+    block->next = groups->group->firstBlock;
+    groups->group->firstBlock = block;
+    current = block + 1;
+    end = block + count + 1;
+    blockSize = count;
+}
+
+template<typename T>
+void NodePool<T>::PushFreeSlot(Slot* slot) noexcept
+{
+    if (freeSlots == nullptr)
+    {
+        lastFreeSlot = slot;
+    }
+    slot->next = freeSlots;
+    freeSlots = slot;
+}
+
+template<typename T>
+void NodePool<T>::RecycleRest() noexcept
+{
+    while (current != end)
+    {
+        PushFreeSlot(current++);
+    }
+}
+
+template<typename T>
+bool NodePool<T>::Uses(const Group* group) const noexcept
+{
+    for (const GroupReference* reference = groups; reference != nullptr; reference = reference->next)
+    {
+        if (reference->group == group)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+template<typename T>
+void NodePool<T>::Drop(Group* group) noexcept
+{
+    if (group->owners.fetch_sub(1, std::memory_order_acq_rel) != 1)
+    {
+        return;
+    }
+
+    Slot* block = group->firstBlock;
+    while (block != nullptr)
+    {
+        Slot* next = block->next;
+        delete[] block;
+        block = next;
+    }
+    delete group;
+}
\ No newline at end of file
@@ -0,0 +1,278 @@
+#pragma once
+
+#include "Map.h"
+#include "PersistentRedBlackTree.h"
+#include "Utils/Pair.h"
+
+/**
+ * Map with O(1) snapshots. Readers keep a snapshot while the writer updates the map, only the paths
+ * to the changed pairs are copied. Pairs are shared, so they are accessible only as const
+ */
+template<typename K, typename V, typename C = MapComparator<Utils::Pair<const K, V>>>
+class PersistentMap
+{
+public:
+    using KeyType = K;
+    using ValueType = V;
+    using Comparator = C;
+    using DataType = Utils::Pair<const K, V>;
+    using Iterator = typename PersistentRedBlackTree<DataType, C>::Iterator;
+    using ConstIterator = typename PersistentRedBlackTree<DataType, C>::ConstIterator;
+
+    [[nodiscard]] static constexpr const char* ClassName() noexcept { return "PersistentMap"; }
+
+    PersistentMap(const Comparator& comparator = Comparator());
+    PersistentMap(std::initializer_list<DataType> initList, const Comparator& comparator = Comparator());
+
+    /**
+     * @return map sharing all pairs with this one in O(1). Later updates of any of them are not visible in the other
+     */
+    [[nodiscard]] PersistentMap Snapshot() const noexcept;
+
+    [[nodiscard]] const ValueType& at(const KeyType& key) const;
+
+    ConstIterator Insert(const DataType& value);
+
+    /**
+     * Inserts the pair or replaces the value of the existing key
+     */
+    ConstIterator InsertOrAssign(const DataType& value);
+    bool Remove(const KeyType& key);
+    void Clear() noexcept;
+
+    [[nodiscard]] ConstIterator Find(const KeyType& key) const;
+
+    /**
+     * @return value of the key or nullptr. Unlike Find it does not allocate
+     */
+    [[nodiscard]] const ValueType* Lookup(const KeyType& key) const;
+
+    /**
+     * @return first pair with key not less than the given one or end()
+     */
+    [[nodiscard]] ConstIterator LowerBound(const KeyType& key) const;
+
+    /**
+     * @return first pair with key greater than the given one or end()
+     */
+    [[nodiscard]] ConstIterator UpperBound(const KeyType& key) const;
+
+    [[nodiscard]] Utils::Range<ConstIterator> EqualRange(const KeyType& key) const;
+
+    /**
+     * Lazily iterated view of pairs with keys in range [lo, hi]
+     */
+    [[nodiscard]] Utils::Range<ConstIterator> Range(const KeyType& lo, const KeyType& hi) const;
+
+    /**
+     * Calls the visitor with every pair with key in range [lo, hi], nothing is copied
+     */
+    template<typename F>
+    void ForEachInRange(const KeyType& lo, const KeyType& hi, F&& visitor) const;
+
+    [[nodiscard]] const DataType& Min() const noexcept;
+    [[nodiscard]] const DataType& Max() const noexcept;
+
+    [[nodiscard]] size_t Size() const noexcept;
+
+    [[nodiscard]] ConstIterator begin() const;
+    [[nodiscard]] ConstIterator end() const noexcept;
+    [[nodiscard]] ConstIterator cbegin() const;
+    [[nodiscard]] ConstIterator cend() const noexcept;
+
+    [[nodiscard]] std::string ToString() const;
+
+    template<typename T, typename U, typename D>
+    friend std::ostream& operator<<(std::ostream& os, const PersistentMap<T, U, D>& map);
+
+    template<typename T, typename U, typename D>
+    friend std::istream& operator>>(std::istream& is, PersistentMap<T, U, D>& map);
+
+private:
+
+    PersistentRedBlackTree<DataType, C> tree;
+};
+
+template<typename K, typename V, typename C>
+PersistentMap<K, V, C>::PersistentMap(const Comparator& comparator)
+    : tree(comparator)
+{}
+
+template<typename K, typename V, typename C>
+PersistentMap<K, V, C>::PersistentMap(std::initializer_list<DataType> initList, const Comparator& comparator)
+    : tree(comparator)
+{
+    for (const auto& value : initList)
+    {
+        Insert(value);
+    }
+}
+
+template<typename K, typename V, typename C>
+PersistentMap<K, V, C> PersistentMap<K, V, C>::Snapshot() const noexcept
+{
+    return *this;
+}
+
+template<typename K, typename V, typename C>
+const typename PersistentMap<K, V, C>::ValueType& PersistentMap<K, V, C>::at(const KeyType& key) const
+{
+    auto it = Find(key);
+    if (it != end())
+    {
+        return it->second;
+    }
+
+    throw std::out_of_range("No such element exists");
+}
+
+template<typename K, typename V, typename C>
+typename PersistentMap<K, V, C>::ConstIterator PersistentMap<K, V, C>::Insert(const DataType& value)
+{
+    if (Find(value.first) != end())
+    {
+        return end();
+    }
+    return tree.Insert(value);
+}
+
+template<typename K, typename V, typename C>
+typename PersistentMap<K, V, C>::ConstIterator PersistentMap<K, V, C>::InsertOrAssign(const DataType& value)
+{
+    if (tree.Replace(value))
+    {
+        return Find(value.first);
+    }
+    return tree.Insert(value);
+}
+
+template<typename K, typename V, typename C>
+bool PersistentMap<K, V, C>::Remove(const KeyType& key)
+{
+    return tree.Remove({key, ValueType()});
+}
+
+template<typename K, typename V, typename C>
+void PersistentMap<K, V, C>::Clear() noexcept
+{
+    tree.Clear();
+}
+
+template<typename K, typename V, typename C>
+typename PersistentMap<K, V, C>::ConstIterator PersistentMap<K, V, C>::Find(const KeyType& key) const
+{
+    return tree.Find({key, ValueType()});
+}
+
+template<typename K, typename V, typename C>
+const typename PersistentMap<K, V, C>::ValueType* PersistentMap<K, V, C>::Lookup(const KeyType& key) const
+{
+    const auto* pair = tree.Lookup({key, ValueType()});
+    return pair != nullptr ? &pair->second : nullptr;
+}
+
+template<typename K, typename V, typename C>
+typename PersistentMap<K, V, C>::ConstIterator PersistentMap<K, V, C>::LowerBound(const KeyType& key) const
+{
+    return tree.LowerBound({key, ValueType()});
+}
+
+template<typename K, typename V, typename C>
+typename PersistentMap<K, V, C>::ConstIterator PersistentMap<K, V, C>::UpperBound(const KeyType& key) const
+{
+    return tree.UpperBound({key, ValueType()});
+}
+
+template<typename K, typename V, typename C>
+Utils::Range<typename PersistentMap<K, V, C>::ConstIterator> PersistentMap<K, V, C>::EqualRange(const KeyType& key) const
+{
+    return tree.EqualRange({key, ValueType()});
+}
+
+template<typename K, typename V, typename C>
+Utils::Range<typename PersistentMap<K, V, C>::ConstIterator> PersistentMap<K, V, C>::Range(const KeyType& lo, const KeyType& hi) const
+{
+    return tree.Range({lo, ValueType()}, {hi, ValueType()});
+}
+
+template<typename K, typename V, typename C>
+template<typename F>
+void PersistentMap<K, V, C>::ForEachInRange(const KeyType& lo, const KeyType& hi, F&& visitor) const
+{
+    for (const auto& pair : Range(lo, hi))
+    {
+        visitor(pair);
+    }
+}
+
+template<typename K, typename V, typename C>
+const typename PersistentMap<K, V, C>::DataType& PersistentMap<K, V, C>::Min() const noexcept
+{
+    return tree.Min();
+}
+
+template<typename K, typename V, typename C>
+const typename PersistentMap<K, V, C>::DataType& PersistentMap<K, V, C>::Max() const noexcept
+{
+    return tree.Max();
+}
+
+template<typename K, typename V, typename C>
+size_t PersistentMap<K, V, C>::Size() const noexcept
+{
+    return tree.Size();
+}
+
+template<typename K, typename V, typename C>
+typename PersistentMap<K, V, C>::ConstIterator PersistentMap<K, V, C>::begin() const
+{
+    return tree.begin();
+}
+
+template<typename K, typename V, typename C>
+typename PersistentMap<K, V, C>::ConstIterator PersistentMap<K, V, C>::end() const noexcept
+{
+    return tree.end();
+}
+
+template<typename K, typename V, typename C>
+typename PersistentMap<K, V, C>::ConstIterator PersistentMap<K, V, C>::cbegin() const
+{
+    return tree.cbegin();
+}
+
+template<typename K, typename V, typename C>
+typename PersistentMap<K, V, C>::ConstIterator PersistentMap<K, V, C>::cend() const noexcept
+{
+    return tree.cend();
+}
+
+template<typename K, typename V, typename C>
+std::string PersistentMap<K, V, C>::ToString() const
+{
+    size_t i = 0;
+    std::string result = "{";
+    for (const auto& pair : tree)
+    {
+        result += Utils::Parser::ToString(pair.first) + ": " + Utils::Parser::ToString(pair.second);
+        if (++i < tree.Size())
+        {
+            result += ", ";
+        }
+    }
+    result += "}";
+
+    return result;
+}
+
+template<typename K, typename V, typename C>
+std::ostream& operator<<(std::ostream& os, const PersistentMap<K, V, C>& map)
+{
+    return os << map.tree;
+}
+
+template<typename K, typename V, typename C>
+std::istream& operator>>(std::istream& is, PersistentMap<K, V, C>& map)
+{
+    return is >> map.tree;
+}
\ No newline at end of file
@@ -0,0 +1,895 @@
+#pragma once
+
+#include "DynamicArray.h"
+#include "Utils/Range.h"
+#include "Utils/Utils.h"
+
+#include <atomic>
+#include <iterator>
+#include <limits>
+
+template<typename T, typename C>
+struct PersistentRedBlackTreeConstIterator;
+
+/**
+ * Red-black tree with nodes shared between snapshots. Nodes are reference counted and changed in place
+ * only while a single tree uses them, otherwise the path to the change is copied, so Snapshot() is O(1)
+ * and updates stay O(log n). A tree object must not be used concurrently, but snapshots handed over
+ * to other threads can be read while the original is updated. Iterators are forward only
+ * and are invalidated by updates of the tree they come from
+ */
+template<typename T, typename C = Utils::Less<T>>
+class PersistentRedBlackTree
+{
+public:
+    friend struct PersistentRedBlackTreeConstIterator<T, C>;
+
+    using DataType = T;
+    using Comparator = C;
+    using ConstIterator = PersistentRedBlackTreeConstIterator<T, C>;
+    using Iterator = ConstIterator;
+
+    [[nodiscard]] static constexpr const char* ClassName() noexcept { return "PersistentRedBlackTree"; }
+
+    explicit PersistentRedBlackTree(const Comparator& comparator = Comparator());
+    PersistentRedBlackTree(std::initializer_list<DataType> initList, const Comparator& comparator = Comparator());
+
+    /**
+     * Shares all nodes with rhs in O(1)
+     */
+    PersistentRedBlackTree(const PersistentRedBlackTree& rhs) noexcept;
+    PersistentRedBlackTree(PersistentRedBlackTree&& rhs) noexcept;
+    PersistentRedBlackTree& operator=(const PersistentRedBlackTree& rhs) noexcept;
+    PersistentRedBlackTree& operator=(PersistentRedBlackTree&& rhs) noexcept;
+    ~PersistentRedBlackTree();
+
+    /**
+     * @return tree sharing all nodes with this one in O(1). Later updates of any of them are not visible in the other
+     */
+    [[nodiscard]] PersistentRedBlackTree Snapshot() const noexcept;
+
+    ConstIterator Insert(const DataType& value);
+    bool Remove(const DataType& value);
+
+    /**
+     * Replaces the first element equivalent to the value
+     * @return false if there is no such element
+     */
+    bool Replace(const DataType& value);
+    void Clear() noexcept;
+
+    [[nodiscard]] ConstIterator Find(const DataType& value) const;
+
+    /**
+     * @return element equivalent to the value or nullptr. Unlike Find it does not allocate
+     */
+    [[nodiscard]] const DataType* Lookup(const DataType& value) const noexcept;
+
+    /**
+     * @return first element not less than the value or end()
+     */
+    [[nodiscard]] ConstIterator LowerBound(const DataType& value) const;
+
+    /**
+     * @return first element greater than the value or end()
+     */
+    [[nodiscard]] ConstIterator UpperBound(const DataType& value) const;
+
+    [[nodiscard]] Utils::Range<ConstIterator> EqualRange(const DataType& value) const;
+
+    /**
+     * Lazily iterated view of elements in range [lo, hi], empty if hi is less than lo
+     */
+    [[nodiscard]] Utils::Range<ConstIterator> Range(const DataType& lo, const DataType& hi) const;
+
+    [[nodiscard]] const DataType& Min() const noexcept;
+    [[nodiscard]] const DataType& Max() const noexcept;
+
+    [[nodiscard]] size_t Size() const noexcept;
+
+    [[nodiscard]] ConstIterator begin() const;
+    [[nodiscard]] ConstIterator end() const noexcept;
+    [[nodiscard]] ConstIterator cbegin() const;
+    [[nodiscard]] ConstIterator cend() const noexcept;
+
+    [[nodiscard]] std::string ToString() const;
+
+    template<typename U, typename V>
+    friend std::ostream& operator<<(std::ostream& os, const PersistentRedBlackTree<U, V>& tree);
+
+    template<typename U, typename V>
+    friend std::istream& operator>>(std::istream& is, PersistentRedBlackTree<U, V>& tree);
+
+private:
+    struct Node
+    {
+        enum class Color : uint8_t
+        {
+            RED,
+            BLACK
+        };
+
+        std::atomic<size_t> references;
+        Color color;
+        DataType value;
+        Node* left;
+        Node* right;
+    };
+
+    /**
+     * Height of a red-black tree is at most 2 * log2(n + 1). One more slot is used while removing
+     */
+    inline static constexpr size_t MAX_HEIGHT = 2 * std::numeric_limits<size_t>::digits + 2;
+
+    [[nodiscard]] static Node* MakeNode(const DataType& value, typename Node::Color color, Node* left, Node* right);
+    static void Acquire(Node* node) noexcept;
+
+    /**
+     * Drops one reference to the node and deletes nodes which are not used anymore
+     */
+    static void Release(Node* node) noexcept;
+
+    /**
+     * Copies the node held by the slot if it is shared. The slot has to belong to the tree
+     * or to a node used only by it
+     */
+    static void MakeUnique(Node*& slot);
+
+    [[nodiscard]] static bool IsRed(const Node* node) noexcept;
+    static void LeftRotate(Node*& slot) noexcept;
+    static void RightRotate(Node*& slot) noexcept;
+
+    /**
+     * Path holds slots from the root to the inserted node
+     */
+    void InsertFix(Node** path[], size_t depth) noexcept;
+
+    /**
+     * Path holds slots from the root to the slot, which took the place of the removed black node
+     */
+    void RemoveFix(Node** path[], size_t depth);
+
+    [[nodiscard]] const Node* FindNode(const DataType& value) const noexcept;
+    [[nodiscard]] ConstIterator Bound(const DataType& value, bool isUpper) const;
+    [[nodiscard]] ConstIterator MakeIterator(const Node* target) const;
+    [[nodiscard]] size_t StackCapacity() const noexcept;
+
+    void ToString(std::string& result, const std::string& prefix, const Node* node, bool isRight) const;
+
+    Node* root = nullptr;
+    size_t size = 0u;
+    Comparator comparator;
+};
+
+template<typename T, typename C>
+struct PersistentRedBlackTreeConstIterator
+{
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = typename PersistentRedBlackTree<T, C>::DataType;
+    using pointer = const value_type*;
+    using reference = const value_type&;
+
+    PersistentRedBlackTreeConstIterator() = default;
+
+    [[nodiscard]] reference operator*() const noexcept;
+
+    [[nodiscard]] pointer operator->() const noexcept;
+
+    PersistentRedBlackTreeConstIterator& operator++();
+    PersistentRedBlackTreeConstIterator operator++(int);
+
+    [[nodiscard]] bool operator==(const PersistentRedBlackTreeConstIterator& rhs) const noexcept;
+    [[nodiscard]] bool operator!=(const PersistentRedBlackTreeConstIterator& rhs) const noexcept;
+
+protected:
+    friend class PersistentRedBlackTree<T, C>;
+
+    using Node = typename PersistentRedBlackTree<T, C>::Node;
+
+    explicit PersistentRedBlackTreeConstIterator(size_t capacity);
+
+    void Push(const Node* node);
+    void PushLeftPath(const Node* node);
+    [[nodiscard]] const Node* Top() const noexcept;
+
+    DynamicArray<const Node*> stack;                                // Bieżący węzeł na szczycie,
+    size_t depth = 0u;                                              // pod nim nieodwiedzeni przodkowie
+};
+
+template<typename T, typename C>
+PersistentRedBlackTree<T, C>::PersistentRedBlackTree(const Comparator& comparator)
+    : comparator(comparator)
+{ }
+
+template<typename T, typename C>
+PersistentRedBlackTree<T, C>::PersistentRedBlackTree(std::initializer_list<DataType> initList, const Comparator& comparator)
+    : comparator(comparator)
+{
+    for (const auto& value : initList)
+    {
+        Insert(value);
+    }
+}
+
+template<typename T, typename C>
+PersistentRedBlackTree<T, C>::PersistentRedBlackTree(const PersistentRedBlackTree& rhs) noexcept
+    : root(rhs.root)
+    , size(rhs.size)
+    , comparator(rhs.comparator)
+{
+    Acquire(root);
+}
+
+template<typename T, typename C>
+PersistentRedBlackTree<T, C>::PersistentRedBlackTree(PersistentRedBlackTree&& rhs) noexcept
+    : root(rhs.root)
+    , size(rhs.size)
+    , comparator(std::move(rhs.comparator))
+{
+    rhs.root = nullptr;
+    rhs.size = 0u;
+}
+
+template<typename T, typename C>
+PersistentRedBlackTree<T, C>& PersistentRedBlackTree<T, C>::operator=(const PersistentRedBlackTree& rhs) noexcept
+{
+    Acquire(rhs.root);
+    Release(root);
+
+    root = rhs.root;
+    size = rhs.size;
+    comparator = rhs.comparator;
+
+    return *this;
+}
+
+template<typename T, typename C>
+PersistentRedBlackTree<T, C>& PersistentRedBlackTree<T, C>::operator=(PersistentRedBlackTree&& rhs) noexcept
+{
+    if (this == &rhs)
+    {
+        return *this;
+    }
+    Release(root);
+
+    root = rhs.root;
+    size = rhs.size;
+    comparator = std::move(rhs.comparator);
+    rhs.root = nullptr;
+    rhs.size = 0u;
+
+    return *this;
+}
+
+template<typename T, typename C>
+PersistentRedBlackTree<T, C>::~PersistentRedBlackTree()
+{
+    Release(root);
+}
+
+template<typename T, typename C>
+PersistentRedBlackTree<T, C> PersistentRedBlackTree<T, C>::Snapshot() const noexcept
+{
+    return *this;
+}
+
+template<typename T, typename C>
+typename PersistentRedBlackTree<T, C>::ConstIterator PersistentRedBlackTree<T, C>::Insert(const DataType& value)
+{
+    Node** path[MAX_HEIGHT];
+    size_t depth = 0;
+
+    Node** slot = &root;
+    while (*slot != nullptr)
+    {
+        MakeUnique(*slot);
+        path[depth++] = slot;
+        slot = comparator(value, (*slot)->value) ? &(*slot)->left : &(*slot)->right;
+    }
+    Node* inserted = MakeNode(value, Node::Color::RED, nullptr, nullptr);
+    *slot = inserted;
+    path[depth++] = slot;
+    size++;
+
+    InsertFix(path, depth);
+
+    return MakeIterator(inserted);
+}
+
+template<typename T, typename C>
+bool PersistentRedBlackTree<T, C>::Remove(const DataType& value)
+{
+    if (FindNode(value) == nullptr)                                 // Nie kopiujemy ścieżki na próżno
+    {
+        return false;
+    }
+
+    Node** path[MAX_HEIGHT];
+    size_t depth = 0;
+
+    Node** slot = &root;
+    while (true)
+    {
+        MakeUnique(*slot);
+        path[depth++] = slot;
+        if (comparator(value, (*slot)->value))
+        {
+            slot = &(*slot)->left;
+        }
+        else if (comparator((*slot)->value, value))
+        {
+            slot = &(*slot)->right;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    const size_t removedDepth = depth - 1;
+    Node* removed = *path[removedDepth];
+    auto removedColor = removed->color;
+    size_t childDepth = removedDepth;
+
+    if (removed->left == nullptr || removed->right == nullptr)
+    {
+        *path[removedDepth] = removed->left != nullptr ? removed->left : removed->right;
+    }
+    else
+    {
+        slot = &removed->right;                                     // Następnik zajmie miejsce
+        while (true)                                                // usuwanego węzła
+        {
+            MakeUnique(*slot);
+            path[depth++] = slot;
+            if ((*slot)->left == nullptr)
+            {
+                break;
+            }
+            slot = &(*slot)->left;
+        }
+        Node* successor = *slot;
+        removedColor = successor->color;
+        *slot = successor->right;
+        childDepth = depth - 1;
+
+        successor->left = removed->left;
+        successor->right = removed->right;
+        successor->color = removed->color;
+        *path[removedDepth] = successor;
+        path[removedDepth + 1] = &successor->right;                 // Wskazywał na pole usuwanego węzła
+    }
+
+    removed->left = removed->right = nullptr;
+    Release(removed);
+    size--;
+
+    if (removedColor == Node::Color::BLACK)
+    {
+        RemoveFix(path, childDepth);
+    }
+    return true;
+}
+
+template<typename T, typename C>
+bool PersistentRedBlackTree<T, C>::Replace(const DataType& value)
+{
+    if (FindNode(value) == nullptr)
+    {
+        return false;
+    }
+
+    Node** slot = &root;
+    while (comparator(value, (*slot)->value) || comparator((*slot)->value, value))
+    {
+        MakeUnique(*slot);
+        slot = comparator(value, (*slot)->value) ? &(*slot)->left : &(*slot)->right;
+    }
+
+    Node* replaced = *slot;                                         // Nowy węzeł zamiast przypisania,
+    *slot = MakeNode(value, replaced->color, replaced->left, replaced->right);  // więc klucz może być const
+    Acquire(replaced->left);
+    Acquire(replaced->right);
+    Release(replaced);
+
+    return true;
+}
+
+template<typename T, typename C>
+void PersistentRedBlackTree<T, C>::Clear() noexcept
+{
+    Release(root);
+    root = nullptr;
+    size = 0u;
+}
+
+template<typename T, typename C>
+typename PersistentRedBlackTree<T, C>::ConstIterator PersistentRedBlackTree<T, C>::Find(const DataType& value) const
+{
+    auto it = LowerBound(value);
+    if (it != end() && !comparator(value, *it))
+    {
+        return it;
+    }
+    return end();
+}
+
+template<typename T, typename C>
+const typename PersistentRedBlackTree<T, C>::DataType* PersistentRedBlackTree<T, C>::Lookup(const DataType& value) const noexcept
+{
+    const Node* node = FindNode(value);
+    return node != nullptr ? &node->value : nullptr;
+}
+
+template<typename T, typename C>
+typename PersistentRedBlackTree<T, C>::ConstIterator PersistentRedBlackTree<T, C>::LowerBound(const DataType& value) const
+{
+    return Bound(value, false);
+}
+
+template<typename T, typename C>
+typename PersistentRedBlackTree<T, C>::ConstIterator PersistentRedBlackTree<T, C>::UpperBound(const DataType& value) const
+{
+    return Bound(value, true);
+}
+
+template<typename T, typename C>
+Utils::Range<typename PersistentRedBlackTree<T, C>::ConstIterator> PersistentRedBlackTree<T, C>::EqualRange(const DataType& value) const
+{
+    return {LowerBound(value), UpperBound(value)};
+}
+
+template<typename T, typename C>
+Utils::Range<typename PersistentRedBlackTree<T, C>::ConstIterator> PersistentRedBlackTree<T, C>::Range(const DataType& lo, const DataType& hi) const
+{
+    if (comparator(hi, lo))
+    {
+        return {end(), end()};
+    }
+    return {LowerBound(lo), UpperBound(hi)};
+}
+
+template<typename T, typename C>
+const typename PersistentRedBlackTree<T, C>::DataType& PersistentRedBlackTree<T, C>::Min() const noexcept
+{
+    const Node* node = root;
+    while (node->left != nullptr)
+    {
+        node = node->left;
+    }
+    return node->value;
+}
+
+template<typename T, typename C>
+const typename PersistentRedBlackTree<T, C>::DataType& PersistentRedBlackTree<T, C>::Max() const noexcept
+{
+    const Node* node = root;
+    while (node->right != nullptr)
+    {
+        node = node->right;
+    }
+    return node->value;
+}
+
+template<typename T, typename C>
+size_t PersistentRedBlackTree<T, C>::Size() const noexcept
+{
+    return size;
+}
+
+template<typename T, typename C>
+typename PersistentRedBlackTree<T, C>::ConstIterator PersistentRedBlackTree<T, C>::begin() const
+{
+    ConstIterator it(StackCapacity());
+    it.PushLeftPath(root);
+
+    return it;
+}
+
+template<typename T, typename C>
+typename PersistentRedBlackTree<T, C>::ConstIterator PersistentRedBlackTree<T, C>::end() const noexcept
+{
+    return ConstIterator();
+}
+
+template<typename T, typename C>
+typename PersistentRedBlackTree<T, C>::ConstIterator PersistentRedBlackTree<T, C>::cbegin() const
+{
+    return begin();
+}
+
+template<typename T, typename C>
+typename PersistentRedBlackTree<T, C>::ConstIterator PersistentRedBlackTree<T, C>::cend() const noexcept
+{
+    return end();
+}
+
+template<typename T, typename C>
+std::string PersistentRedBlackTree<T, C>::ToString() const
+{
+    std::string result;
+    ToString(result, "", root, false);
+    return result;
+}
+
+template<typename T, typename C>
+std::ostream& operator<<(std::ostream& os, const PersistentRedBlackTree<T, C>& tree)
+{
+    if (os.fail())
+    {
+        return os;
+    }
+    os << tree.Size() << "\n";
+    for (const auto& value : tree)
+    {
+        os << value << " ";
+    }
+    return os;
+}
+
+template<typename T, typename C>
+std::istream& operator>>(std::istream& is, PersistentRedBlackTree<T, C>& tree)
+{
+    if (is.fail())
+    {
+        return is;
+    }
+    size_t size;
+    is >> size;
+
+    tree.Clear();
+    for (size_t i = 0; i < size; i++)
+    {
+        T value;
+        if (!(is >> value))
+        {
+            break;
+        }
+        tree.Insert(value);
+    }
+    return is;
+}
+
+template<typename T, typename C>
+typename PersistentRedBlackTree<T, C>::Node* PersistentRedBlackTree<T, C>::MakeNode(const DataType& value, typename Node::Color color, Node* left, Node* right)
+{
+    return new Node {{1u}, color, value, left, right};
+}
+
+template<typename T, typename C>
+void PersistentRedBlackTree<T, C>::Acquire(Node* node) noexcept
+{
+    if (node != nullptr)
+    {
+        node->references.fetch_add(1u, std::memory_order_relaxed);
+    }
+}
+
+template<typename T, typename C>
+void PersistentRedBlackTree<T, C>::Release(Node* node) noexcept
+{
+    const Node* unused[MAX_HEIGHT];                                 // Przeszukiwanie w głąb, na stosie
+    size_t depth = 0;                                               // zostaje co najwyżej jeden brat
+                                                                    // z każdego poziomu
+    auto drop = [&unused, &depth](Node* dropped) {
+        if (dropped != nullptr && dropped->references.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+        {
+            unused[depth++] = dropped;
+        }
+    };
+
+    drop(node);
+    while (depth > 0)
+    {
+        const Node* deleted = unused[--depth];
+        drop(deleted->left);
+        drop(deleted->right);
+        delete deleted;
+    }
+}
+
+template<typename T, typename C>
+void PersistentRedBlackTree<T, C>::MakeUnique(Node*& slot)
+{
+    if (slot->references.load(std::memory_order_acquire) == 1u)
+    {
+        return;
+    }
+
+    Node* shared = slot;
+    slot = MakeNode(shared->value, shared->color, shared->left, shared->right);
+    Acquire(shared->left);
+    Acquire(shared->right);
+    Release(shared);
+}
+
+template<typename T, typename C>
+bool PersistentRedBlackTree<T, C>::IsRed(const Node* node) noexcept
+{
+    return node != nullptr && node->color == Node::Color::RED;
+}
+
+template<typename T, typename C>
+void PersistentRedBlackTree<T, C>::LeftRotate(Node*& slot) noexcept
+{
+    Node* node = slot;
+    Node* child = node->right;
+
+    node->right = child->left;
+    child->left = node;
+    slot = child;
+}
+
+template<typename T, typename C>
+void PersistentRedBlackTree<T, C>::RightRotate(Node*& slot) noexcept
+{
+    Node* node = slot;
+    Node* child = node->left;
+
+    node->left = child->right;
+    child->right = node;
+    slot = child;
+}
+
+template<typename T, typename C>
+void PersistentRedBlackTree<T, C>::InsertFix(Node** path[], size_t depth) noexcept
+{
+    size_t i = depth - 1;
+    while (i >= 2 && IsRed(*path[i - 1]))                           // Czerwony rodzic nie jest korzeniem
+    {
+        Node* node = *path[i];
+        Node* parent = *path[i - 1];
+        Node* grandParent = *path[i - 2];
+        const bool isParentLeft = grandParent->left == parent;
+        Node*& uncle = isParentLeft ? grandParent->right : grandParent->left;
+
+        if (IsRed(uncle))
+        {
+            MakeUnique(uncle);
+            uncle->color = Node::Color::BLACK;
+            parent->color = Node::Color::BLACK;
+            grandParent->color = Node::Color::RED;
+            i -= 2;
+            continue;
+        }
+
+        if (isParentLeft)
+        {
+            if (parent->right == node)
+            {
+                LeftRotate(grandParent->left);
+            }
+            RightRotate(*path[i - 2]);
+        }
+        else
+        {
+            if (parent->left == node)
+            {
+                RightRotate(grandParent->right);
+            }
+            LeftRotate(*path[i - 2]);
+        }
+        (*path[i - 2])->color = Node::Color::BLACK;
+        grandParent->color = Node::Color::RED;
+        break;
+    }
+    root->color = Node::Color::BLACK;
+}
+
+template<typename T, typename C>
+void PersistentRedBlackTree<T, C>::RemoveFix(Node** path[], size_t depth)
+{
+    while (depth > 0 && !IsRed(*path[depth]))
+    {
+        Node* parent = *path[depth - 1];
+        const bool isLeft = path[depth] == &parent->left;
+        Node*& siblingSlot = isLeft ? parent->right : parent->left;
+        MakeUnique(siblingSlot);
+        Node* sibling = siblingSlot;
+
+        if (IsRed(sibling))                                         // Przypadek 1
+        {
+            sibling->color = Node::Color::BLACK;
+            parent->color = Node::Color::RED;
+            isLeft ? LeftRotate(*path[depth - 1]) : RightRotate(*path[depth - 1]);
+
+            path[depth + 1] = path[depth];                          // Rodzic zszedł poziom niżej
+            path[depth] = isLeft ? &sibling->left : &sibling->right;
+            depth++;
+            continue;
+        }
+
+        if (!IsRed(sibling->left) && !IsRed(sibling->right))        // Przypadek 2
+        {
+            sibling->color = Node::Color::RED;
+            depth--;
+            continue;
+        }
+
+        if (!IsRed(isLeft ? sibling->right : sibling->left))        // Przypadek 3
+        {
+            Node*& nearChild = isLeft ? sibling->left : sibling->right;
+            MakeUnique(nearChild);
+            nearChild->color = Node::Color::BLACK;
+            sibling->color = Node::Color::RED;
+            isLeft ? RightRotate(siblingSlot) : LeftRotate(siblingSlot);
+            sibling = siblingSlot;
+        }
+
+        Node*& farChild = isLeft ? sibling->right : sibling->left;  // Przypadek 4
+        MakeUnique(farChild);
+        sibling->color = parent->color;
+        parent->color = Node::Color::BLACK;
+        farChild->color = Node::Color::BLACK;
+        isLeft ? LeftRotate(*path[depth - 1]) : RightRotate(*path[depth - 1]);
+        return;
+    }
+
+    if (*path[depth] != nullptr)
+    {
+        MakeUnique(*path[depth]);
+        (*path[depth])->color = Node::Color::BLACK;
+    }
+}
+
+template<typename T, typename C>
+const typename PersistentRedBlackTree<T, C>::Node* PersistentRedBlackTree<T, C>::FindNode(const DataType& value) const noexcept
+{
+    const Node* node = root;
+    while (node != nullptr)
+    {
+        if (comparator(value, node->value))
+        {
+            node = node->left;
+        }
+        else if (comparator(node->value, value))
+        {
+            node = node->right;
+        }
+        else
+        {
+            return node;
+        }
+    }
+    return nullptr;
+}
+
+template<typename T, typename C>
+typename PersistentRedBlackTree<T, C>::ConstIterator PersistentRedBlackTree<T, C>::Bound(const DataType& value, bool isUpper) const
+{
+    ConstIterator it(StackCapacity());
+    const Node* node = root;
+    while (node != nullptr)
+    {
+        if (isUpper ? comparator(value, node->value) : !comparator(node->value, value))
+        {
+            it.Push(node);                                          // Kandydat, ostatni jest najmniejszy
+            node = node->left;
+        }
+        else
+        {
+            node = node->right;
+        }
+    }
+    return it.depth > 0 ? it : end();
+}
+
+template<typename T, typename C>
+typename PersistentRedBlackTree<T, C>::ConstIterator PersistentRedBlackTree<T, C>::MakeIterator(const Node* target) const
+{
+    ConstIterator it(StackCapacity());                              // Wstawiony węzeł jest ostatni
+    const Node* node = root;                                        // wśród równoważnych
+    while (node != target)
+    {
+        if (comparator(target->value, node->value))
+        {
+            it.Push(node);
+            node = node->left;
+        }
+        else
+        {
+            node = node->right;
+        }
+    }
+    it.Push(target);
+
+    return it;
+}
+
+template<typename T, typename C>
+size_t PersistentRedBlackTree<T, C>::StackCapacity() const noexcept
+{
+    size_t height = 1;
+    while (height < std::numeric_limits<size_t>::digits && (size_t {1} << height) <= size)
+    {
+        height++;
+    }
+    return 2 * height;
+}
+
+template<typename T, typename C>
+void PersistentRedBlackTree<T, C>::ToString(std::string& result, const std::string& prefix, const Node* node, bool isRight) const
+{
+    if (node != nullptr)
+    {
+        result += prefix;
+
+        result += (isRight ? Utils::VERTICAL_BAR_RIGHT : Utils::UP_RIGHT);
+        result += Utils::HORIZONTAL_BAR;
+
+        result += Utils::Parser::NumberToString(node->value) + "\n";
+
+        ToString(result, prefix + (isRight ? Utils::VERTICAL_BAR : " ") + " ", node->right, true);
+        ToString(result, prefix + (isRight ? Utils::VERTICAL_BAR : " ") + " ", node->left, false);
+    }
+}
+
+template<typename T, typename C>
+PersistentRedBlackTreeConstIterator<T, C>::PersistentRedBlackTreeConstIterator(size_t capacity)
+    : stack(capacity)
+{ }
+
+template<typename T, typename C>
+typename PersistentRedBlackTreeConstIterator<T, C>::reference PersistentRedBlackTreeConstIterator<T, C>::operator*() const noexcept
+{
+    return Top()->value;
+}
+
+template<typename T, typename C>
+typename PersistentRedBlackTreeConstIterator<T, C>::pointer PersistentRedBlackTreeConstIterator<T, C>::operator->() const noexcept
+{
+    return &Top()->value;
+}
+
+template<typename T, typename C>
+PersistentRedBlackTreeConstIterator<T, C>& PersistentRedBlackTreeConstIterator<T, C>::operator++()
+{
+    const Node* node = stack[--depth];
+    PushLeftPath(node->right);
+
+    return *this;
+}
+
+template<typename T, typename C>
+PersistentRedBlackTreeConstIterator<T, C> PersistentRedBlackTreeConstIterator<T, C>::operator++(int)
+{
+    auto result = *this;
+    ++(*this);
+
+    return result;
+}
+
+template<typename T, typename C>
+bool PersistentRedBlackTreeConstIterator<T, C>::operator==(const PersistentRedBlackTreeConstIterator& rhs) const noexcept
+{
+    return Top() == rhs.Top();
+}
+
+template<typename T, typename C>
+bool PersistentRedBlackTreeConstIterator<T, C>::operator!=(const PersistentRedBlackTreeConstIterator& rhs) const noexcept
+{
+    return !(*this == rhs);
+}
+
+template<typename T, typename C>
+void PersistentRedBlackTreeConstIterator<T, C>::Push(const Node* node)
+{
+    stack[depth++] = node;
+}
+
+template<typename T, typename C>
+void PersistentRedBlackTreeConstIterator<T, C>::PushLeftPath(const Node* node)
+{
+    while (node != nullptr)
+    {
+        Push(node);
+        node = node->left;
+    }
+}
+
+template<typename T, typename C>
+const typename PersistentRedBlackTreeConstIterator<T, C>::Node* PersistentRedBlackTreeConstIterator<T, C>::Top() const noexcept
+{
+    return depth > 0 ? stack[depth - 1] : nullptr;
+}
\ No newline at end of file
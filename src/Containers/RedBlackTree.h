@@ -1,30 +1,40 @@
 #pragma once
 
+#include "DynamicArray.h"
+#include "NodePool.h"
+#include "TreeAugmentation.h"
+#include "Utils/Algorithms.h"
+#include "Utils/Pair.h"
+#include "Utils/Range.h"
 #include "Utils/Utils.h"
 
+#include <iterator>
+#include <type_traits>
+
 template<typename K, typename V, typename C>
 class Map;
 
-template<typename T, typename C>
+template<typename T, typename C, typename A>
 struct RedBlackTreeIterator;
 
-template<typename T, typename C>
+template<typename T, typename C, typename A>
 struct RedBlackTreeConstIterator;
 
-template<typename T, typename C = Utils::Less<T>>
+template<typename T, typename C = Utils::Less<T>, typename A = TreeAugmentation::None>
 class RedBlackTree
 {
 public:
-    friend struct RedBlackTreeIterator<T, C>;
-    friend struct RedBlackTreeConstIterator<T, C>;
+    friend struct RedBlackTreeIterator<T, C, A>;
+    friend struct RedBlackTreeConstIterator<T, C, A>;
 
     template<typename K, typename V, typename U>
     friend class Map;
 
     using DataType = T;
     using Comparator = C;
-    using Iterator = RedBlackTreeIterator<T, C>;
-    using ConstIterator = RedBlackTreeConstIterator<T, C>;
+    using Augmentation = A;
+    using Iterator = RedBlackTreeIterator<T, C, A>;
+    using ConstIterator = RedBlackTreeConstIterator<T, C, A>;
 
     [[nodiscard]] static constexpr const char* ClassName() noexcept { return "RedBlackTree"; }
 
@@ -36,16 +46,96 @@ public:
     RedBlackTree& operator=(RedBlackTree&& rhs) noexcept;
     ~RedBlackTree();
 
+    /**
+     * Builds a perfectly balanced tree in O(n), the range has to be sorted according to the comparator
+     */
+    template<typename It>
+    [[nodiscard]] static RedBlackTree FromSorted(It first, It last, const Comparator& comparator = Comparator());
+
     Iterator Insert(const DataType& value);
+
+    /**
+     * Sorts the range and merges it with the tree in O(n + m log m),
+     * ranges which are small compared to the tree are inserted one by one
+     */
+    template<typename It>
+    void InsertRange(It first, It last);
+
     bool Remove(const DataType& value);
+
+    /**
+     * Releases all nodes at once if no other tree shares the node pool and elements need no destructor
+     */
     void Clear();
 
     [[nodiscard]] ConstIterator Find(const DataType& value) const noexcept;
     [[nodiscard]] Iterator Find(const DataType& value) noexcept;
 
+    /**
+     * @return first element not less than the value or end()
+     */
+    [[nodiscard]] ConstIterator LowerBound(const DataType& value) const noexcept;
+    [[nodiscard]] Iterator LowerBound(const DataType& value) noexcept;
+
+    /**
+     * @return first element greater than the value or end()
+     */
+    [[nodiscard]] ConstIterator UpperBound(const DataType& value) const noexcept;
+    [[nodiscard]] Iterator UpperBound(const DataType& value) noexcept;
+
+    [[nodiscard]] Utils::Range<ConstIterator> EqualRange(const DataType& value) const noexcept;
+    [[nodiscard]] Utils::Range<Iterator> EqualRange(const DataType& value) noexcept;
+
+    /**
+     * Lazily iterated view of elements in range [lo, hi], empty if hi is less than lo
+     */
+    [[nodiscard]] Utils::Range<ConstIterator> Range(const DataType& lo, const DataType& hi) const noexcept;
+    [[nodiscard]] Utils::Range<Iterator> Range(const DataType& lo, const DataType& hi) noexcept;
+
     [[nodiscard]] const DataType& Min() const noexcept;
     [[nodiscard]] const DataType& Max() const noexcept;
 
+    /**
+     * Requires TreeAugmentation::OrderStatistics
+     * @return k-th smallest element, counting from 0, or end() if the tree has no more than k elements
+     */
+    [[nodiscard]] ConstIterator Select(size_t k) const noexcept;
+    [[nodiscard]] Iterator Select(size_t k) noexcept;
+
+    /**
+     * Requires TreeAugmentation::OrderStatistics
+     * @return number of elements less than the value
+     */
+    [[nodiscard]] size_t Rank(const DataType& value) const noexcept;
+
+    /**
+     * Requires TreeAugmentation::OrderStatistics
+     * @return number of elements in range [lo, hi]
+     */
+    [[nodiscard]] size_t CountRange(const DataType& lo, const DataType& hi) const noexcept;
+
+    /**
+     * Joins trees in O(log n), elements of the left tree have to be not greater than the pivot
+     * and elements of the right tree not less than it. Both trees are left empty
+     */
+    [[nodiscard]] static RedBlackTree Join(RedBlackTree&& left, const DataType& pivot, RedBlackTree&& right);
+
+    /**
+     * Splits the tree in O(log n) into elements less than the value and the rest, the tree is left empty.
+     * Without TreeAugmentation::OrderStatistics counting sizes of the parts takes O(min(k, n - k)).
+     * Parts keep the nodes allocated by the tree, but allocate new ones separately, so they can be modified concurrently
+     */
+    [[nodiscard]] static Utils::Pair<RedBlackTree, RedBlackTree> Split(RedBlackTree&& tree, const DataType& value);
+
+    /**
+     * Set operations in O(m log(n / m + 1)), where m is the size of the smaller tree. Elements of rhs which
+     * are equivalent to an element of lhs are dropped, the result keeps the comparator of lhs.
+     * Both trees are left empty
+     */
+    [[nodiscard]] static RedBlackTree Union(RedBlackTree&& lhs, RedBlackTree&& rhs);
+    [[nodiscard]] static RedBlackTree Intersection(RedBlackTree&& lhs, RedBlackTree&& rhs);
+    [[nodiscard]] static RedBlackTree Difference(RedBlackTree&& lhs, RedBlackTree&& rhs);
+
     [[nodiscard]] size_t Size() const noexcept;
 
     [[nodiscard]] Iterator begin() noexcept;
@@ -57,14 +147,14 @@ public:
 
     [[nodiscard]] std::string ToString() const;
 
-    template<typename U, typename V>
-    friend std::ostream& operator<<(std::ostream& os, const RedBlackTree<U, V>& tree);
+    template<typename U, typename V, typename W>
+    friend std::ostream& operator<<(std::ostream& os, const RedBlackTree<U, V, W>& tree);
 
-    template<typename U, typename V>
-    friend std::istream& operator>>(std::istream& is, RedBlackTree<U, V>& tree);
+    template<typename U, typename V, typename W>
+    friend std::istream& operator>>(std::istream& is, RedBlackTree<U, V, W>& tree);
 
 public:
-    struct Node
+    struct Node : Augmentation::NodeData
     {
         enum class Color : uint8_t
         {
@@ -80,47 +170,123 @@ public:
     };
 
     inline static constexpr int64_t NIL_VALUE = -1;
+    inline static constexpr size_t MAX_RESERVED_NODES = 1024;     // Rozmiar ze strumienia nie jest sprawdzony
+    inline static constexpr bool HAS_ORDER_STATISTICS = std::is_base_of_v<TreeAugmentation::OrderStatistics::NodeData, Node>;
 
-    [[nodiscard]] static Node* MakeNil();
-    [[nodiscard]] Node* MakeNode(const DataType& value) const;
+    /**
+     * Sentinel shared by all trees of the same type, so nodes can be moved between them.
+     * It is never modified, the root is kept in the tree itself
+     */
+    [[nodiscard]] static Node* Nil() noexcept;
+    [[nodiscard]] Node* MakeNode(const DataType& value);
 
-    void LeftRotate(Node* node) const noexcept;
-    void RightRotate(Node* node) const noexcept;
+    void LeftRotate(Node* node) noexcept;
+    void RightRotate(Node* node) noexcept;
 
-    void SetRoot(Node* node) const noexcept;
+    void SetRoot(Node* node) noexcept;
     [[nodiscard]] Node* Root() const noexcept;
 
     [[nodiscard]] Node* Min(Node* node) const noexcept;
     [[nodiscard]] Node* Max(Node* node) const noexcept;
+    [[nodiscard]] Node* Next(Node* node) const noexcept;
+    [[nodiscard]] Node* Previous(Node* node) const noexcept;
     [[nodiscard]] Node* Find(const DataType& value, Node* root) const noexcept;
+    [[nodiscard]] Node* Bound(const DataType& value, bool isUpper) const noexcept;
+    [[nodiscard]] Node* Select(size_t k, Node* root) const noexcept;
+    [[nodiscard]] size_t CountLess(const DataType& value, bool isInclusive) const noexcept;
+
+    void InsertNode(Node* newNode) noexcept;
+    void DetachNode(Node* node) noexcept;
+
+    /**
+     * @return true if the black height of the tree has grown
+     */
+    bool InsertFix(Node* node) noexcept;
+    void RemoveFix(Node* node, Node* parent) noexcept;
+
+    void MoveSubtree(Node* from, Node* to) noexcept;
 
-    void InsertFix(Node* node) const noexcept;
-    void RemoveFix(Node* node) const noexcept;
+    /**
+     * Releases nodes without recursion, left children are rotated up until the node has none
+     */
+    void RemoveSubtree(Node* root) noexcept;
 
-    void MoveSubtree(Node* from, Node* to) const noexcept;
-    void RemoveSubtree(Node* root);
+    /**
+     * Copies nodes in preorder without recursion, walking both trees through parent links
+     */
     [[nodiscard]] Node* CopySubtree(const RedBlackTree& tree, Node* root);
 
+    /**
+     * Detaches all nodes in order and leaves the tree empty, nothing is deleted
+     */
+    [[nodiscard]] DynamicArray<Node*> ReleaseNodes();
+    void Build(DynamicArray<Node*>& nodes);
+    [[nodiscard]] Node* LinkSubtree(DynamicArray<Node*>& nodes, size_t begin, size_t end, size_t depth, size_t redDepth, Node* parent) const;
+
+    /**
+     * Subtree detached from its parent, black height counts the root as if it was black and is 0 for NIL
+     */
+    struct Subtree
+    {
+        Node* root;
+        size_t blackHeight;
+    };
+
+    /**
+     * Subtrees are rebalanced with this tree as a workspace, its root is replaced
+     */
+    [[nodiscard]] Subtree TakeSubtree() noexcept;
+    void SetSubtree(Subtree tree) noexcept;
+    [[nodiscard]] Subtree ChildSubtree(Subtree tree, Node* child) const noexcept;
+    [[nodiscard]] Subtree JoinSubtrees(Subtree left, Node* pivot, Subtree right) noexcept;
+    [[nodiscard]] Subtree JoinSubtrees(Subtree left, Subtree right) noexcept;
+
+    /**
+     * Left part gets elements less than the value, or not greater if isUpper is set
+     */
+    void SplitSubtree(Subtree tree, const DataType& value, bool isUpper, Subtree& left, Subtree& right) noexcept;
+    void SplitSubtree(Subtree tree, const DataType& value, Subtree& less, Subtree& equal, Subtree& greater) noexcept;
+
+    [[nodiscard]] Subtree UnionSubtrees(Subtree lhs, Subtree rhs);
+    [[nodiscard]] Subtree IntersectSubtrees(Subtree lhs, Subtree rhs);
+    [[nodiscard]] Subtree SubtractSubtrees(Subtree lhs, Subtree rhs);
+
+    /**
+     * @return size of the first of two trees, which have the given size together
+     */
+    [[nodiscard]] size_t SizeOfFirst(Node* first, Node* second, size_t totalSize) const noexcept;
+
     void ToString(std::string& result, const std::string& prefix, const Node* node, bool isRight) const;
-    void Serialize(std::ostream& os, Node* node) const;
-    [[nodiscard]] Node* Deserialize(std::istream& is, Node* node, size_t& sizeOfTree);
+
+    /**
+     * Writes values in preorder with NIL_VALUE in place of every missing child
+     */
+    void Serialize(std::ostream& os) const;
+
+    /**
+     * Reads the preorder written by Serialize and rebuilds the tree balanced, as colors are not stored
+     */
+    void Deserialize(std::istream& is, size_t sizeOfTree);
+    [[nodiscard]] Node* ReadNode(std::istream& is, Node* parent);
 
     Comparator comparator;
-    Node* NIL = MakeNil();
+    Node* NIL = Nil();
+    Node* root = NIL;
     size_t size = 0u;
+    NodePool<Node> pool;
 };
 
-template<typename T, typename C>
+template<typename T, typename C, typename A>
 struct RedBlackTreeConstIterator
 {
     using iterator_category = std::bidirectional_iterator_tag;
     using difference_type = std::ptrdiff_t;
-    using value_type = typename RedBlackTree<T, C>::DataType;
+    using value_type = typename RedBlackTree<T, C, A>::DataType;
     using pointer = const value_type*;
     using reference = const value_type&;
 
     RedBlackTreeConstIterator() = default;
-    RedBlackTreeConstIterator(const RedBlackTree<T, C>* redBlackTree, typename RedBlackTree<T, C>::Node* node) noexcept;
+    RedBlackTreeConstIterator(const RedBlackTree<T, C, A>* redBlackTree, typename RedBlackTree<T, C, A>::Node* node) noexcept;
 
     [[nodiscard]] reference operator*() const noexcept;
 
@@ -135,19 +301,19 @@ struct RedBlackTreeConstIterator
     [[nodiscard]] bool operator!=(const RedBlackTreeConstIterator& rhs) const noexcept;
 
 protected:
-    const RedBlackTree<T, C>* redBlackTree;
-    typename RedBlackTree<T, C>::Node* node;
+    const RedBlackTree<T, C, A>* redBlackTree;
+    typename RedBlackTree<T, C, A>::Node* node;
 };
 
-template<typename T, typename C>
-struct RedBlackTreeIterator : public RedBlackTreeConstIterator<T, C>
+template<typename T, typename C, typename A>
+struct RedBlackTreeIterator : public RedBlackTreeConstIterator<T, C, A>
 {
     using iterator_category = std::bidirectional_iterator_tag;
-    using value_type = typename RedBlackTree<T, C>::DataType;
+    using value_type = typename RedBlackTree<T, C, A>::DataType;
     using pointer = value_type*;
     using reference = value_type&;
 
-    using RedBlackTreeConstIterator<T, C>::RedBlackTreeConstIterator;
+    using RedBlackTreeConstIterator<T, C, A>::RedBlackTreeConstIterator;
 
     [[nodiscard]] reference operator*() const noexcept;
 
@@ -159,48 +325,48 @@ struct RedBlackTreeIterator : public RedBlackTreeConstIterator<T, C>
     RedBlackTreeIterator operator--(int) noexcept;
 };
 
-template<typename T, typename C>
-RedBlackTree<T, C>::RedBlackTree(const Comparator& comparator)
+template<typename T, typename C, typename A>
+RedBlackTree<T, C, A>::RedBlackTree(const Comparator& comparator)
     : comparator(comparator)
 { }
 
-template<typename T, typename C>
-RedBlackTree<T, C>::RedBlackTree(std::initializer_list<DataType> initList, const Comparator& comparator)
+template<typename T, typename C, typename A>
+RedBlackTree<T, C, A>::RedBlackTree(std::initializer_list<DataType> initList, const Comparator& comparator)
     : comparator(comparator)
 {
-    for (const auto& item: initList)
-    {
-        Insert(item);
-    }
+    InsertRange(initList.begin(), initList.end());
 }
 
-template<typename T, typename C>
-RedBlackTree<T, C>::RedBlackTree(const RedBlackTree& rhs)
+template<typename T, typename C, typename A>
+RedBlackTree<T, C, A>::RedBlackTree(const RedBlackTree& rhs)
+    : comparator(rhs.comparator)
 {
+    pool.Reserve(rhs.size);
     SetRoot(CopySubtree(rhs, rhs.Root()));
     size = rhs.size;
-    comparator = rhs.comparator;
 }
 
-template<typename T, typename C>
-RedBlackTree<T, C>::RedBlackTree(RedBlackTree&& rhs) noexcept
+template<typename T, typename C, typename A>
+RedBlackTree<T, C, A>::RedBlackTree(RedBlackTree&& rhs) noexcept
+    : pool(std::move(rhs.pool))
 {
-    NIL = rhs.NIL;
+    root = rhs.root;
     size = rhs.size;
     comparator = std::move(rhs.comparator);
 
-    rhs.NIL = nullptr;
+    rhs.root = NIL;
     rhs.size = 0u;
 }
 
-template<typename T, typename C>
-RedBlackTree<T, C>& RedBlackTree<T, C>::operator=(const RedBlackTree& rhs)
+template<typename T, typename C, typename A>
+RedBlackTree<T, C, A>& RedBlackTree<T, C, A>::operator=(const RedBlackTree& rhs)
 {
     if (this == &rhs)
     {
         return *this;
     }
     Clear();
+    pool.Reserve(rhs.size);
     SetRoot(CopySubtree(rhs, rhs.Root()));
     size = rhs.size;
     comparator = rhs.comparator;
@@ -208,32 +374,111 @@ RedBlackTree<T, C>& RedBlackTree<T, C>::operator=(const RedBlackTree& rhs)
     return *this;
 }
 
-template<typename T, typename C>
-RedBlackTree<T, C>& RedBlackTree<T, C>::operator=(RedBlackTree&& rhs) noexcept
+template<typename T, typename C, typename A>
+RedBlackTree<T, C, A>& RedBlackTree<T, C, A>::operator=(RedBlackTree&& rhs) noexcept
 {
+    if (this == &rhs)
+    {
+        return *this;
+    }
     Clear();
-    NIL = rhs.NIL;
+    root = rhs.root;
     size = rhs.size;
     comparator = std::move(rhs.comparator);
+    pool = std::move(rhs.pool);
 
-    rhs.NIL = nullptr;
+    rhs.root = NIL;
     rhs.size = 0u;
 
     return *this;
 }
 
-template<typename T, typename C>
-RedBlackTree<T, C>::~RedBlackTree()
+template<typename T, typename C, typename A>
+RedBlackTree<T, C, A>::~RedBlackTree()
 {
     Clear();
-    delete NIL;
-    NIL = nullptr;
 }
 
-template<typename T, typename C>
-typename RedBlackTree<T, C>::Iterator RedBlackTree<T, C>::Insert(const DataType& value)
+template<typename T, typename C, typename A>
+template<typename It>
+RedBlackTree<T, C, A> RedBlackTree<T, C, A>::FromSorted(It first, It last, const Comparator& comparator)
+{
+    RedBlackTree tree(comparator);
+    DynamicArray<Node*> nodes(static_cast<size_t>(std::distance(first, last)));
+    tree.pool.Reserve(nodes.Size());
+
+    for (size_t i = 0; first != last; ++first, i++)
+    {
+        nodes[i] = tree.MakeNode(*first);
+    }
+    tree.Build(nodes);
+
+    return tree;
+}
+
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::Iterator RedBlackTree<T, C, A>::Insert(const DataType& value)
 {
     Node* newNode = MakeNode(value);
+    InsertNode(newNode);
+
+    return {this, newNode};
+}
+
+template<typename T, typename C, typename A>
+template<typename It>
+void RedBlackTree<T, C, A>::InsertRange(It first, It last)
+{
+    DynamicArray<Node*> inserted(static_cast<size_t>(std::distance(first, last)));
+    pool.Reserve(inserted.Size());
+    for (size_t i = 0; first != last; ++first, i++)
+    {
+        inserted[i] = MakeNode(*first);
+    }
+
+    size_t height = 1;
+    while ((size_t{1} << height) <= size)
+    {
+        height++;
+    }
+    if (inserted.Size() * height < size)
+    {
+        for (auto* node : inserted)
+        {
+            InsertNode(node);
+        }
+        return;
+    }
+
+    const auto compareNodes = [this](const Node* lhs, const Node* rhs) {
+        return comparator(lhs->value, rhs->value);
+    };
+    DynamicArray<Node*> buffer(inserted.Size());
+    Utils::MergeSort(inserted.begin(), inserted.end(), buffer.begin(), compareNodes);
+
+    auto existing = ReleaseNodes();
+    DynamicArray<Node*> merged(existing.Size() + inserted.Size());
+    size_t left = 0;
+    size_t right = 0;
+
+    for (auto& node : merged)
+    {
+        if (right == inserted.Size() || (left < existing.Size() && !compareNodes(inserted[right], existing[left])))
+        {
+            node = existing[left++];
+        }
+        else
+        {
+            node = inserted[right++];
+        }
+    }
+
+    Build(merged);
+}
+
+template<typename T, typename C, typename A>
+void RedBlackTree<T, C, A>::InsertNode(Node* newNode) noexcept
+{
     Node* parent = NIL;
     Node* iterator = Root();
 
@@ -266,20 +511,31 @@ typename RedBlackTree<T, C>::Iterator RedBlackTree<T, C>::Insert(const DataType&
     }
 
     newNode->color = Node::Color::RED;
+    Augmentation::UpdatePath(newNode, NIL);
     InsertFix(newNode);
-
-    return {this, newNode};
 }
 
-template<typename T, typename C>
-bool RedBlackTree<T, C>::Remove(const DataType& value)
+template<typename T, typename C, typename A>
+bool RedBlackTree<T, C, A>::Remove(const DataType& value)
 {
     Node* nodeToRemove = Find(value, Root());
     if (nodeToRemove == NIL)
     {
         return false;
     }
+
+    DetachNode(nodeToRemove);
+    pool.Release(nodeToRemove);
+
+    size--;
+    return true;
+}
+
+template<typename T, typename C, typename A>
+void RedBlackTree<T, C, A>::DetachNode(Node* nodeToRemove) noexcept
+{
     Node* successor;
+    Node* parent = nodeToRemove->parent;
     Node* node = nodeToRemove;
     auto originalColor = node->color;
 
@@ -300,10 +556,11 @@ bool RedBlackTree<T, C>::Remove(const DataType& value)
         successor = node->right;
         if (node->parent == nodeToRemove)
         {
-            successor->parent = node;
+            parent = node;
         }
         else
         {
+            parent = node->parent;
             MoveSubtree(node, node->right);
             node->right = nodeToRemove->right;
             node->right->parent = node;
@@ -314,120 +571,266 @@ bool RedBlackTree<T, C>::Remove(const DataType& value)
         node->color = nodeToRemove->color;
     }
 
-    delete nodeToRemove;
-    nodeToRemove = nullptr;
-
+    Augmentation::UpdatePath(parent, NIL);
     if (originalColor == Node::Color::BLACK)
     {
-        RemoveFix(successor);
+        RemoveFix(successor, parent);
     }
-
-    size--;
-    return true;
 }
 
-template<typename T, typename C>
-void RedBlackTree<T, C>::Clear()
+template<typename T, typename C, typename A>
+void RedBlackTree<T, C, A>::Clear()
 {
-    if (NIL != nullptr)
+    if (!pool.IsUnique() || !std::is_trivially_destructible_v<Node>)
     {
-        if (Root() != nullptr)
-        {
-            RemoveSubtree(Root());
-
-        }
-        NIL->left = NIL;
+        RemoveSubtree(Root());
     }
+    pool.Reset();
+    root = NIL;
+    size = 0u;
 }
 
-template<typename T, typename C>
-typename RedBlackTree<T, C>::ConstIterator RedBlackTree<T, C>::Find(const DataType& value) const noexcept
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::ConstIterator RedBlackTree<T, C, A>::Find(const DataType& value) const noexcept
 {
     return {this, Find(value, Root())};
 }
 
-template<typename T, typename C>
-typename RedBlackTree<T, C>::Iterator RedBlackTree<T, C>::Find(const DataType& value) noexcept
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::Iterator RedBlackTree<T, C, A>::Find(const DataType& value) noexcept
 {
     return {this, Find(value, Root())};
 }
 
-template<typename T, typename C>
-const typename RedBlackTree<T, C>::DataType& RedBlackTree<T, C>::Min() const noexcept
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::ConstIterator RedBlackTree<T, C, A>::LowerBound(const DataType& value) const noexcept
+{
+    return {this, Bound(value, false)};
+}
+
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::Iterator RedBlackTree<T, C, A>::LowerBound(const DataType& value) noexcept
+{
+    return {this, Bound(value, false)};
+}
+
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::ConstIterator RedBlackTree<T, C, A>::UpperBound(const DataType& value) const noexcept
+{
+    return {this, Bound(value, true)};
+}
+
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::Iterator RedBlackTree<T, C, A>::UpperBound(const DataType& value) noexcept
+{
+    return {this, Bound(value, true)};
+}
+
+template<typename T, typename C, typename A>
+Utils::Range<typename RedBlackTree<T, C, A>::ConstIterator> RedBlackTree<T, C, A>::EqualRange(const DataType& value) const noexcept
+{
+    return {LowerBound(value), UpperBound(value)};
+}
+
+template<typename T, typename C, typename A>
+Utils::Range<typename RedBlackTree<T, C, A>::Iterator> RedBlackTree<T, C, A>::EqualRange(const DataType& value) noexcept
+{
+    return {LowerBound(value), UpperBound(value)};
+}
+
+template<typename T, typename C, typename A>
+Utils::Range<typename RedBlackTree<T, C, A>::ConstIterator> RedBlackTree<T, C, A>::Range(const DataType& lo, const DataType& hi) const noexcept
+{
+    if (comparator(hi, lo))
+    {
+        return {end(), end()};
+    }
+    return {LowerBound(lo), UpperBound(hi)};
+}
+
+template<typename T, typename C, typename A>
+Utils::Range<typename RedBlackTree<T, C, A>::Iterator> RedBlackTree<T, C, A>::Range(const DataType& lo, const DataType& hi) noexcept
+{
+    if (comparator(hi, lo))
+    {
+        return {end(), end()};
+    }
+    return {LowerBound(lo), UpperBound(hi)};
+}
+
+template<typename T, typename C, typename A>
+const typename RedBlackTree<T, C, A>::DataType& RedBlackTree<T, C, A>::Min() const noexcept
 {
     return Min(Root())->value;
 }
 
-template<typename T, typename C>
-const typename RedBlackTree<T, C>::DataType& RedBlackTree<T, C>::Max() const noexcept
+template<typename T, typename C, typename A>
+const typename RedBlackTree<T, C, A>::DataType& RedBlackTree<T, C, A>::Max() const noexcept
 {
     return Max(Root())->value;
 }
 
-template<typename T, typename C>
-size_t RedBlackTree<T, C>::Size() const noexcept
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::ConstIterator RedBlackTree<T, C, A>::Select(size_t k) const noexcept
+{
+    return {this, Select(k, Root())};
+}
+
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::Iterator RedBlackTree<T, C, A>::Select(size_t k) noexcept
+{
+    return {this, Select(k, Root())};
+}
+
+template<typename T, typename C, typename A>
+size_t RedBlackTree<T, C, A>::Rank(const DataType& value) const noexcept
+{
+    return CountLess(value, false);
+}
+
+template<typename T, typename C, typename A>
+size_t RedBlackTree<T, C, A>::CountRange(const DataType& lo, const DataType& hi) const noexcept
+{
+    if (comparator(hi, lo))
+    {
+        return 0;
+    }
+    return CountLess(hi, true) - CountLess(lo, false);
+}
+
+template<typename T, typename C, typename A>
+RedBlackTree<T, C, A> RedBlackTree<T, C, A>::Join(RedBlackTree&& left, const DataType& pivot, RedBlackTree&& right)
+{
+    RedBlackTree tree(left.comparator);
+    tree.pool.Merge(std::move(left.pool));
+    tree.pool.Merge(std::move(right.pool));
+    Node* pivotNode = tree.MakeNode(pivot);
+    tree.size = left.size + right.size + 1;
+    tree.SetSubtree(tree.JoinSubtrees(left.TakeSubtree(), pivotNode, right.TakeSubtree()));
+
+    return tree;
+}
+
+template<typename T, typename C, typename A>
+Utils::Pair<RedBlackTree<T, C, A>, RedBlackTree<T, C, A>> RedBlackTree<T, C, A>::Split(RedBlackTree&& tree, const DataType& value)
+{
+    Utils::Pair<RedBlackTree, RedBlackTree> parts {RedBlackTree(tree.comparator), RedBlackTree(tree.comparator)};
+    const size_t size = tree.size;
+    Subtree left;
+    Subtree right;
+
+    parts.first.SplitSubtree(tree.TakeSubtree(), value, false, left, right);
+    parts.first.SetSubtree(left);
+    parts.second.SetSubtree(right);
+    parts.second.pool.Share(tree.pool);
+    parts.first.pool = std::move(tree.pool);
+
+    parts.first.size = parts.first.SizeOfFirst(left.root, right.root, size);
+    parts.second.size = size - parts.first.size;
+
+    return parts;
+}
+
+template<typename T, typename C, typename A>
+RedBlackTree<T, C, A> RedBlackTree<T, C, A>::Union(RedBlackTree&& lhs, RedBlackTree&& rhs)
+{
+    RedBlackTree tree(lhs.comparator);
+    tree.pool.Merge(std::move(lhs.pool));
+    tree.pool.Merge(std::move(rhs.pool));
+    tree.size = lhs.size + rhs.size;
+    tree.SetSubtree(tree.UnionSubtrees(lhs.TakeSubtree(), rhs.TakeSubtree()));
+
+    return tree;
+}
+
+template<typename T, typename C, typename A>
+RedBlackTree<T, C, A> RedBlackTree<T, C, A>::Intersection(RedBlackTree&& lhs, RedBlackTree&& rhs)
+{
+    RedBlackTree tree(lhs.comparator);
+    tree.pool.Merge(std::move(lhs.pool));
+    tree.pool.Merge(std::move(rhs.pool));
+    tree.size = lhs.size + rhs.size;
+    tree.SetSubtree(tree.IntersectSubtrees(lhs.TakeSubtree(), rhs.TakeSubtree()));
+
+    return tree;
+}
+
+template<typename T, typename C, typename A>
+RedBlackTree<T, C, A> RedBlackTree<T, C, A>::Difference(RedBlackTree&& lhs, RedBlackTree&& rhs)
+{
+    RedBlackTree tree(lhs.comparator);
+    tree.pool.Merge(std::move(lhs.pool));
+    tree.pool.Merge(std::move(rhs.pool));
+    tree.size = lhs.size + rhs.size;
+    tree.SetSubtree(tree.SubtractSubtrees(lhs.TakeSubtree(), rhs.TakeSubtree()));
+
+    return tree;
+}
+
+template<typename T, typename C, typename A>
+size_t RedBlackTree<T, C, A>::Size() const noexcept
 {
     return size;
 }
 
-template<typename T, typename C>
-typename RedBlackTree<T, C>::Iterator RedBlackTree<T, C>::begin() noexcept
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::Iterator RedBlackTree<T, C, A>::begin() noexcept
 {
     return {this, Min(Root())};
 }
 
-template<typename T, typename C>
-typename RedBlackTree<T, C>::Iterator RedBlackTree<T, C>::end() noexcept
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::Iterator RedBlackTree<T, C, A>::end() noexcept
 {
     return {this, NIL};
 }
 
-template<typename T, typename C>
-typename RedBlackTree<T, C>::ConstIterator RedBlackTree<T, C>::begin() const noexcept
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::ConstIterator RedBlackTree<T, C, A>::begin() const noexcept
 {
     return {this, Min(Root())};
 }
 
-template<typename T, typename C>
-typename RedBlackTree<T, C>::ConstIterator RedBlackTree<T, C>::end() const noexcept
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::ConstIterator RedBlackTree<T, C, A>::end() const noexcept
 {
     return {this, NIL};
 }
 
-template<typename T, typename C>
-typename RedBlackTree<T, C>::ConstIterator RedBlackTree<T, C>::cbegin() const noexcept
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::ConstIterator RedBlackTree<T, C, A>::cbegin() const noexcept
 {
     return {this, Min(Root())};
 }
 
-template<typename T, typename C>
-typename RedBlackTree<T, C>::ConstIterator RedBlackTree<T, C>::cend() const noexcept
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::ConstIterator RedBlackTree<T, C, A>::cend() const noexcept
 {
     return {this, NIL};
 }
 
-template<typename T, typename C>
-std::string RedBlackTree<T, C>::ToString() const
+template<typename T, typename C, typename A>
+std::string RedBlackTree<T, C, A>::ToString() const
 {
     std::string result;
     ToString(result, "", Root(), false);
     return result;
 }
 
-template<typename T, typename C>
-std::ostream& operator<<(std::ostream& os, const RedBlackTree<T, C>& tree)
+template<typename T, typename C, typename A>
+std::ostream& operator<<(std::ostream& os, const RedBlackTree<T, C, A>& tree)
 {
     if (os.fail())
     {
         return os;
     }
     os << tree.Size() << "\n";
-    tree.Serialize(os, tree.Root());
+    tree.Serialize(os);
     return os;
 }
 
-template<typename T, typename C>
-std::istream& operator>>(std::istream& is, RedBlackTree<T, C>& tree)
+template<typename T, typename C, typename A>
+std::istream& operator>>(std::istream& is, RedBlackTree<T, C, A>& tree)
 {
     if (is.fail())
     {
@@ -436,40 +839,38 @@ std::istream& operator>>(std::istream& is, RedBlackTree<T, C>& tree)
     size_t size;
     is >> size;
 
-    tree.SetRoot(tree.Deserialize(is, tree.NIL, size));
+    tree.Deserialize(is, size);
     return is;
 }
 
-template<typename T, typename C>
-typename RedBlackTree<T, C>::Node* RedBlackTree<T, C>::MakeNil()
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::Node* RedBlackTree<T, C, A>::Nil() noexcept
 {
-    Node* nil = new Node {Node::Color::BLACK, // color
-                          DataType(),         // value
-                          nullptr,            // left
-                          nullptr,            // right
-                          nullptr};           // parent
-
-    nil->left   = nil;
-    nil->right  = nil;
-    nil->parent = nil;
-
-    return nil;
+    static Node nil {{},                 // augmentation
+                     Node::Color::BLACK, // color
+                     DataType(),         // value
+                     &nil,               // left
+                     &nil,               // right
+                     &nil};              // parent
+
+    return &nil;
 }
 
-template<typename T, typename C>
-typename RedBlackTree<T, C>::Node* RedBlackTree<T, C>::MakeNode(const DataType& value) const
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::Node* RedBlackTree<T, C, A>::MakeNode(const DataType& value)
 {
-    Node* newNode = new Node {Node::Color::BLACK, // color
-                              value,              // value
-                              NIL,                // left
-                              NIL,                // right
-                              NIL};               // parent
+    Node* newNode = new (pool.Allocate()) Node {{},                 // augmentation
+                                                Node::Color::BLACK, // color
+                                                value,              // value
+                                                NIL,                // left
+                                                NIL,                // right
+                                                NIL};               // parent
 
     return newNode;
 }
 
-template<typename T, typename C>
-void RedBlackTree<T, C>::LeftRotate(Node* node) const noexcept
+template<typename T, typename C, typename A>
+void RedBlackTree<T, C, A>::LeftRotate(Node* node) noexcept
 {
     Node* child = node->right;
     node->right = child->left;
@@ -496,10 +897,13 @@ void RedBlackTree<T, C>::LeftRotate(Node* node) const noexcept
 
     child->left = node;
     node->parent = child;
+
+    Augmentation::Update(node);
+    Augmentation::Update(child);
 }
 
-template<typename T, typename C>
-void RedBlackTree<T, C>::RightRotate(Node* node) const noexcept
+template<typename T, typename C, typename A>
+void RedBlackTree<T, C, A>::RightRotate(Node* node) noexcept
 {
     Node* child = node->left;
     node->left = child->right;
@@ -526,23 +930,29 @@ void RedBlackTree<T, C>::RightRotate(Node* node) const noexcept
 
     child->right = node;
     node->parent = child;
+
+    Augmentation::Update(node);
+    Augmentation::Update(child);
 }
 
-template<typename T, typename C>
-void RedBlackTree<T, C>::SetRoot(Node* node) const noexcept
+template<typename T, typename C, typename A>
+void RedBlackTree<T, C, A>::SetRoot(Node* node) noexcept
 {
-    NIL->left = node;
-    node->parent = NIL;
+    root = node;
+    if (node != NIL)
+    {
+        node->parent = NIL;
+    }
 }
 
-template<typename T, typename C>
-typename RedBlackTree<T, C>::Node* RedBlackTree<T, C>::Root() const noexcept
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::Node* RedBlackTree<T, C, A>::Root() const noexcept
 {
-    return NIL->left;
+    return root;
 }
 
-template<typename T, typename C>
-typename RedBlackTree<T, C>::Node* RedBlackTree<T, C>::Min(Node* node) const noexcept
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::Node* RedBlackTree<T, C, A>::Min(Node* node) const noexcept
 {
     while (node->left != NIL)
     {
@@ -551,8 +961,8 @@ typename RedBlackTree<T, C>::Node* RedBlackTree<T, C>::Min(Node* node) const noe
     return node;
 }
 
-template<typename T, typename C>
-typename RedBlackTree<T, C>::Node* RedBlackTree<T, C>::Max(Node* node) const noexcept
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::Node* RedBlackTree<T, C, A>::Max(Node* node) const noexcept
 {
     while (node->right != NIL)
     {
@@ -561,8 +971,36 @@ typename RedBlackTree<T, C>::Node* RedBlackTree<T, C>::Max(Node* node) const noe
     return node;
 }
 
-template<typename T, typename C>
-typename RedBlackTree<T, C>::Node* RedBlackTree<T, C>::Find(const DataType& value, Node* root) const noexcept
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::Node* RedBlackTree<T, C, A>::Next(Node* node) const noexcept
+{
+    if (node->right != NIL)
+    {
+        return Min(node->right);
+    }
+    while (node->parent != NIL && node == node->parent->right)
+    {
+        node = node->parent;
+    }
+    return node->parent;
+}
+
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::Node* RedBlackTree<T, C, A>::Previous(Node* node) const noexcept
+{
+    if (node->left != NIL)
+    {
+        return Max(node->left);
+    }
+    while (node->parent != NIL && node == node->parent->left)
+    {
+        node = node->parent;
+    }
+    return node->parent;
+}
+
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::Node* RedBlackTree<T, C, A>::Find(const DataType& value, Node* root) const noexcept
 {
     while (root != NIL)
     {
@@ -582,8 +1020,75 @@ typename RedBlackTree<T, C>::Node* RedBlackTree<T, C>::Find(const DataType& valu
     return NIL;
 }
 
-template<typename T, typename C>
-void RedBlackTree<T, C>::InsertFix(Node* node) const noexcept
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::Node* RedBlackTree<T, C, A>::Bound(const DataType& value, bool isUpper) const noexcept
+{
+    Node* bound = NIL;
+    Node* node = Root();
+    while (node != NIL)
+    {
+        if (isUpper ? comparator(value, node->value) : !comparator(node->value, value))
+        {
+            bound = node;
+            node = node->left;
+        }
+        else
+        {
+            node = node->right;
+        }
+    }
+    return bound;
+}
+
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::Node* RedBlackTree<T, C, A>::Select(size_t k, Node* root) const noexcept
+{
+    static_assert(HAS_ORDER_STATISTICS, "Select requires TreeAugmentation::OrderStatistics");
+
+    while (root != NIL)
+    {
+        const auto leftSize = root->left->subtreeSize;
+        if (k < leftSize)
+        {
+            root = root->left;
+        }
+        else if (k > leftSize)
+        {
+            k -= leftSize + 1;
+            root = root->right;
+        }
+        else
+        {
+            return root;
+        }
+    }
+    return NIL;
+}
+
+template<typename T, typename C, typename A>
+size_t RedBlackTree<T, C, A>::CountLess(const DataType& value, bool isInclusive) const noexcept
+{
+    static_assert(HAS_ORDER_STATISTICS, "Rank and CountRange require TreeAugmentation::OrderStatistics");
+
+    size_t count = 0;
+    Node* node = Root();
+    while (node != NIL)
+    {
+        if (comparator(node->value, value) || (isInclusive && !comparator(value, node->value)))
+        {
+            count += node->left->subtreeSize + 1;
+            node = node->right;
+        }
+        else
+        {
+            node = node->left;
+        }
+    }
+    return count;
+}
+
+template<typename T, typename C, typename A>
+bool RedBlackTree<T, C, A>::InsertFix(Node* node) noexcept
 {
     while (node->parent->color == Node::Color::RED)
     {
@@ -632,30 +1137,34 @@ void RedBlackTree<T, C>::InsertFix(Node* node) const noexcept
             }
         }
     }
+
+    const bool isHigher = Root()->color == Node::Color::RED;
     Root()->color = Node::Color::BLACK;
+    return isHigher;
 }
 
-template<typename T, typename C>
-void RedBlackTree<T, C>::RemoveFix(Node* node) const noexcept
+template<typename T, typename C, typename A>
+void RedBlackTree<T, C, A>::RemoveFix(Node* node, Node* parent) noexcept
 {
     while (node != Root() && node->color == Node::Color::BLACK)
     {
-        if (node == node->parent->left)                                 // Jeśli węzeł jest lewym dzieckiem i...
+        if (node == parent->left)                                       // Jeśli węzeł jest lewym dzieckiem i...
         {
-            Node* rightSibling = node->parent->right;
+            Node* rightSibling = parent->right;
             if (rightSibling->color == Node::Color::RED)                // Jeśli brat jest czerwony
             {                                                           // przekoloruj węzły
                 rightSibling->color = Node::Color::BLACK;               // i dokonaj obrotu wokół rodzica
-                node->parent->color = Node::Color::RED;                 //
-                LeftRotate(node->parent);                               //
-                rightSibling = node->parent->right;                     //
+                parent->color = Node::Color::RED;                       //
+                LeftRotate(parent);                                     //
+                rightSibling = parent->right;                           //
             }
 
             if (rightSibling->left->color  == Node::Color::BLACK &&     // Jeśli oboje dzieci brata są czarne
                 rightSibling->right->color == Node::Color::BLACK)       // przekoloruj brata
             {                                                           //
                 rightSibling->color = Node::Color::RED;                 //
-                node = node->parent;                                    //
+                node = parent;                                          //
+                parent = node->parent;                                  //
             }
             else                                                        // Jeśli któreś z dzieci brata jest czerwone
             {
@@ -664,31 +1173,32 @@ void RedBlackTree<T, C>::RemoveFix(Node* node) const noexcept
                     rightSibling->left->color = Node::Color::BLACK;     // i dokonaj obrotu wokół brata
                     rightSibling->color = Node::Color::RED;             //
                     RightRotate(rightSibling);                          //
-                    rightSibling = node->parent->right;                 //
+                    rightSibling = parent->right;                       //
                 }
-                rightSibling->color = node->parent->color;              // przekoloruj węzły
-                node->parent->color = Node::Color::BLACK;               // i dokonaj obrotu wokół rodzica
+                rightSibling->color = parent->color;                    // przekoloruj węzły
+                parent->color = Node::Color::BLACK;                     // i dokonaj obrotu wokół rodzica
                 rightSibling->right->color = Node::Color::BLACK;        //
-                LeftRotate(node->parent);                               //
+                LeftRotate(parent);                                     //
                 node = Root();                                          //
             }
         }
         else                                                            // Jeśli węzeł jest prawym dzieckiem i...
         {
-            Node* leftSibling = node->parent->left;
+            Node* leftSibling = parent->left;
             if (leftSibling->color == Node::Color::RED)                 // Jeśli brat jest czerwony
             {                                                           // przekoloruj węzły
                 leftSibling->color = Node::Color::BLACK;                // i dokonaj obrotu wokół rodzica
-                node->parent->color = Node::Color::RED;                 //
-                RightRotate(node->parent);                              //
-                leftSibling = node->parent->left;                       //
+                parent->color = Node::Color::RED;                       //
+                RightRotate(parent);                                    //
+                leftSibling = parent->left;                             //
             }
 
             if (leftSibling->right->color == Node::Color::BLACK &&      // Jeśli oboje dzieci brata są czarne
                 leftSibling->left->color  == Node::Color::BLACK)        // przekoloruj brata
             {                                                           //
                 leftSibling->color = Node::Color::RED;                  //
-                node = node->parent;                                    //
+                node = parent;                                          //
+                parent = node->parent;                                  //
             }
             else                                                        // Jeśli któreś z dzieci brata jest czerwone
             {
@@ -697,21 +1207,24 @@ void RedBlackTree<T, C>::RemoveFix(Node* node) const noexcept
                     leftSibling->right->color = Node::Color::BLACK;     // i dokonaj obrotu wokół brata
                     leftSibling->color = Node::Color::RED;              //
                     LeftRotate(leftSibling);                            //
-                    leftSibling = node->parent->left;                   //
+                    leftSibling = parent->left;                         //
                 }
-                leftSibling->color = node->parent->color;               // przekoloruj węzły
-                node->parent->color = Node::Color::BLACK;               // i dokonaj obrotu wokół rodzica
+                leftSibling->color = parent->color;                     // przekoloruj węzły
+                parent->color = Node::Color::BLACK;                     // i dokonaj obrotu wokół rodzica
                 leftSibling->left->color = Node::Color::BLACK;          //
-                RightRotate(node->parent);                              //
+                RightRotate(parent);                                    //
                 node = Root();                                          //
             }
         }
     }
-    node->color = Node::Color::BLACK;
+    if (node != NIL)
+    {
+        node->color = Node::Color::BLACK;
+    }
 }
 
-template<typename T, typename C>
-void RedBlackTree<T, C>::MoveSubtree(Node* from, Node* to) const noexcept
+template<typename T, typename C, typename A>
+void RedBlackTree<T, C, A>::MoveSubtree(Node* from, Node* to) noexcept
 {
     if (from->parent == NIL)
     {
@@ -725,46 +1238,403 @@ void RedBlackTree<T, C>::MoveSubtree(Node* from, Node* to) const noexcept
     {
         from->parent->right = to;
     }
-    to->parent = from->parent;
+    if (to != NIL)
+    {
+        to->parent = from->parent;
+    }
 }
 
-template<typename T, typename C>
-void RedBlackTree<T, C>::RemoveSubtree(Node* root)
+template<typename T, typename C, typename A>
+void RedBlackTree<T, C, A>::RemoveSubtree(Node* root) noexcept
 {
-    if (root == NIL)
+    while (root != NIL)
     {
-        return;
+        if (root->left != NIL)
+        {
+            Node* left = root->left;
+            root->left = left->right;
+            left->right = root;
+            root = left;
+        }
+        else
+        {
+            Node* right = root->right;
+            pool.Release(root);
+            root = right;
+            size--;
+        }
     }
-
-    RemoveSubtree(root->left);
-    RemoveSubtree(root->right);
-
-    delete root;
-    root = nullptr;
-    size--;
 }
 
-template<typename T, typename C>
-typename RedBlackTree<T, C>::Node* RedBlackTree<T, C>::CopySubtree(const RedBlackTree& tree, Node* root)
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::Node* RedBlackTree<T, C, A>::CopySubtree(const RedBlackTree& tree, Node* root)
 {
     if (root == tree.NIL)
     {
         return NIL;
     }
 
-    Node* newRoot = new Node;
-    newRoot->value = root->value;
+    Node* newRoot = MakeNode(root->value);
     newRoot->color = root->color;
-    newRoot->left = CopySubtree(tree, root->left);
-    newRoot->left->parent = newRoot;
 
-    newRoot->right = CopySubtree(tree, root->right);
-    newRoot->right->parent = newRoot;
+    Node* node = root;
+    Node* copy = newRoot;
+    while (copy != NIL)
+    {
+        Node* child = NIL;
+        if (node->left != tree.NIL && copy->left == NIL)                // Dziecko zostało już skopiowane, jeśli
+        {                                                               // kopia ma je podpięte
+            child = copy->left = MakeNode(node->left->value);
+            node = node->left;
+        }
+        else if (node->right != tree.NIL && copy->right == NIL)
+        {
+            child = copy->right = MakeNode(node->right->value);
+            node = node->right;
+        }
+
+        if (child != NIL)
+        {
+            child->color = node->color;
+            child->parent = copy;
+            copy = child;
+        }
+        else
+        {
+            Augmentation::Update(copy);
+            node = node->parent;
+            copy = copy->parent;
+        }
+    }
+
     return newRoot;
 }
 
-template<typename T, typename C>
-void RedBlackTree<T, C>::ToString(std::string& result, const std::string& prefix, const Node* node, bool isRight) const
+template<typename T, typename C, typename A>
+DynamicArray<typename RedBlackTree<T, C, A>::Node*> RedBlackTree<T, C, A>::ReleaseNodes()
+{
+    DynamicArray<Node*> nodes(size);
+    size_t i = 0;
+
+    for (Node* node = Min(Root()); node != NIL; node = Next(node))
+    {
+        nodes[i++] = node;
+    }
+
+    root = NIL;
+    size = 0u;
+    return nodes;
+}
+
+template<typename T, typename C, typename A>
+void RedBlackTree<T, C, A>::Build(DynamicArray<Node*>& nodes)
+{
+    size = nodes.Size();
+    if (size == 0)
+    {
+        root = NIL;
+        return;
+    }
+
+    size_t redDepth = 0;                                            // Wszystkie ścieżki mają redDepth czarnych
+    while ((size_t{2} << redDepth) <= size)                         // węzłów, czerwone są tylko liście na
+    {                                                               // najgłębszym, niepełnym poziomie
+        redDepth++;
+    }
+    SetRoot(LinkSubtree(nodes, 0, size, 0, redDepth, NIL));
+}
+
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::Node* RedBlackTree<T, C, A>::LinkSubtree(DynamicArray<Node*>& nodes,
+                                                                  size_t begin,
+                                                                  size_t end,
+                                                                  size_t depth,
+                                                                  size_t redDepth,
+                                                                  Node* parent) const
+{
+    if (begin == end)
+    {
+        return NIL;
+    }
+
+    const auto middle = begin + (end - begin) / 2;
+    Node* root = nodes[middle];
+
+    root->parent = parent;
+    root->color = (depth == redDepth && depth != 0) ? Node::Color::RED : Node::Color::BLACK;
+    root->left = LinkSubtree(nodes, begin, middle, depth + 1, redDepth, root);
+    root->right = LinkSubtree(nodes, middle + 1, end, depth + 1, redDepth, root);
+    Augmentation::Update(root);
+
+    return root;
+}
+
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::Subtree RedBlackTree<T, C, A>::TakeSubtree() noexcept
+{
+    Subtree tree {Root(), 0};
+    for (Node* node = Root(); node != NIL; node = node->left)
+    {
+        if (node->color == Node::Color::BLACK)
+        {
+            tree.blackHeight++;
+        }
+    }
+
+    root = NIL;
+    size = 0u;
+    return tree;
+}
+
+template<typename T, typename C, typename A>
+void RedBlackTree<T, C, A>::SetSubtree(Subtree tree) noexcept
+{
+    SetRoot(tree.root);
+    if (tree.root != NIL)
+    {
+        tree.root->color = Node::Color::BLACK;
+    }
+}
+
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::Subtree RedBlackTree<T, C, A>::ChildSubtree(Subtree tree, Node* child) const noexcept
+{
+    if (child == NIL)
+    {
+        return {NIL, 0};
+    }
+    return {child, child->color == Node::Color::BLACK ? tree.blackHeight - 1 : tree.blackHeight};
+}
+
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::Subtree RedBlackTree<T, C, A>::JoinSubtrees(Subtree left, Node* pivot, Subtree right) noexcept
+{
+    for (Node* node : {left.root, right.root})
+    {
+        if (node != NIL)
+        {
+            node->color = Node::Color::BLACK;
+        }
+    }
+
+    if (left.blackHeight == right.blackHeight)
+    {
+        pivot->color = Node::Color::BLACK;
+        pivot->left = left.root;
+        pivot->right = right.root;
+        for (Node* node : {left.root, right.root})
+        {
+            if (node != NIL)
+            {
+                node->parent = pivot;
+            }
+        }
+        SetRoot(pivot);
+        Augmentation::Update(pivot);
+
+        return {pivot, left.blackHeight + 1};
+    }
+
+    const bool isLeftHigher = left.blackHeight > right.blackHeight;
+    Subtree& higher = isLeftHigher ? left : right;
+    Subtree& lower = isLeftHigher ? right : left;
+
+    // Schodzi po skrajnej ścieżce wyższego drzewa do czarnego węzła o wysokości niższego drzewa
+    Node* parent = NIL;
+    Node* node = higher.root;
+    size_t blackHeight = higher.blackHeight;
+    while (node->color == Node::Color::RED || blackHeight != lower.blackHeight)
+    {
+        if (node->color == Node::Color::BLACK)
+        {
+            blackHeight--;
+        }
+        parent = node;
+        node = isLeftHigher ? node->right : node->left;
+    }
+
+    SetRoot(higher.root);
+    pivot->color = Node::Color::RED;
+    pivot->parent = parent;
+    pivot->left = isLeftHigher ? node : lower.root;
+    pivot->right = isLeftHigher ? lower.root : node;
+    for (Node* child : {node, lower.root})
+    {
+        if (child != NIL)
+        {
+            child->parent = pivot;
+        }
+    }
+    if (isLeftHigher)
+    {
+        parent->right = pivot;
+    }
+    else
+    {
+        parent->left = pivot;
+    }
+
+    Augmentation::UpdatePath(pivot, NIL);
+    const bool isHigher = InsertFix(pivot);
+
+    return {Root(), higher.blackHeight + (isHigher ? 1 : 0)};
+}
+
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::Subtree RedBlackTree<T, C, A>::JoinSubtrees(Subtree left, Subtree right) noexcept
+{
+    if (left.root == NIL)
+    {
+        return right;
+    }
+
+    Node* pivot = left.root;
+    const Subtree leftChild = ChildSubtree(left, pivot->left);
+    const Subtree rightChild = ChildSubtree(left, pivot->right);
+
+    return JoinSubtrees(leftChild, pivot, JoinSubtrees(rightChild, right));
+}
+
+template<typename T, typename C, typename A>
+void RedBlackTree<T, C, A>::SplitSubtree(Subtree tree, const DataType& value, bool isUpper, Subtree& left, Subtree& right) noexcept
+{
+    if (tree.root == NIL)
+    {
+        left = right = {NIL, 0};
+        return;
+    }
+
+    Node* pivot = tree.root;
+    const Subtree leftChild = ChildSubtree(tree, pivot->left);
+    const Subtree rightChild = ChildSubtree(tree, pivot->right);
+
+    if (isUpper ? !comparator(value, pivot->value) : comparator(pivot->value, value))
+    {
+        Subtree middle;
+        SplitSubtree(rightChild, value, isUpper, middle, right);
+        left = JoinSubtrees(leftChild, pivot, middle);
+    }
+    else
+    {
+        Subtree middle;
+        SplitSubtree(leftChild, value, isUpper, left, middle);
+        right = JoinSubtrees(middle, pivot, rightChild);
+    }
+}
+
+template<typename T, typename C, typename A>
+void RedBlackTree<T, C, A>::SplitSubtree(Subtree tree, const DataType& value, Subtree& less, Subtree& equal, Subtree& greater) noexcept
+{
+    Subtree notLess;
+    SplitSubtree(tree, value, false, less, notLess);
+    SplitSubtree(notLess, value, true, equal, greater);
+}
+
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::Subtree RedBlackTree<T, C, A>::UnionSubtrees(Subtree lhs, Subtree rhs)
+{
+    if (rhs.root == NIL)
+    {
+        return lhs;
+    }
+    if (lhs.root == NIL)
+    {
+        return rhs;
+    }
+
+    Node* pivot = lhs.root;
+    const Subtree leftChild = ChildSubtree(lhs, pivot->left);
+    const Subtree rightChild = ChildSubtree(lhs, pivot->right);
+
+    Subtree less;
+    Subtree equal;
+    Subtree greater;
+    SplitSubtree(rhs, pivot->value, less, equal, greater);
+    RemoveSubtree(equal.root);
+
+    const Subtree left = UnionSubtrees(leftChild, less);
+    const Subtree right = UnionSubtrees(rightChild, greater);
+    return JoinSubtrees(left, pivot, right);
+}
+
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::Subtree RedBlackTree<T, C, A>::IntersectSubtrees(Subtree lhs, Subtree rhs)
+{
+    if (lhs.root == NIL || rhs.root == NIL)
+    {
+        RemoveSubtree(lhs.root);
+        RemoveSubtree(rhs.root);
+        return {NIL, 0};
+    }
+
+    Node* pivot = rhs.root;
+    const Subtree leftChild = ChildSubtree(rhs, pivot->left);
+    const Subtree rightChild = ChildSubtree(rhs, pivot->right);
+
+    Subtree less;
+    Subtree equal;
+    Subtree greater;
+    SplitSubtree(lhs, pivot->value, less, equal, greater);
+
+    const Subtree left = IntersectSubtrees(less, leftChild);
+    const Subtree right = IntersectSubtrees(greater, rightChild);
+
+    pool.Release(pivot);
+    size--;
+
+    return JoinSubtrees(left, JoinSubtrees(equal, right));
+}
+
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::Subtree RedBlackTree<T, C, A>::SubtractSubtrees(Subtree lhs, Subtree rhs)
+{
+    if (lhs.root == NIL || rhs.root == NIL)
+    {
+        RemoveSubtree(rhs.root);
+        return lhs;
+    }
+
+    Node* pivot = rhs.root;
+    const Subtree leftChild = ChildSubtree(rhs, pivot->left);
+    const Subtree rightChild = ChildSubtree(rhs, pivot->right);
+
+    Subtree less;
+    Subtree equal;
+    Subtree greater;
+    SplitSubtree(lhs, pivot->value, less, equal, greater);
+    RemoveSubtree(equal.root);
+
+    const Subtree left = SubtractSubtrees(less, leftChild);
+    const Subtree right = SubtractSubtrees(greater, rightChild);
+
+    pool.Release(pivot);
+    size--;
+
+    return JoinSubtrees(left, right);
+}
+
+template<typename T, typename C, typename A>
+size_t RedBlackTree<T, C, A>::SizeOfFirst(Node* first, Node* second, size_t totalSize) const noexcept
+{
+    if constexpr (HAS_ORDER_STATISTICS)
+    {
+        return first->subtreeSize;
+    }
+    else
+    {
+        // Liczy oba drzewa jednocześnie, więc kończy po przejściu mniejszego z nich
+        size_t count = 0;
+        for (first = Min(first), second = Max(second); first != NIL && second != NIL; count++)
+        {
+            first = Next(first);
+            second = Previous(second);
+        }
+        return first == NIL ? count : totalSize - count;
+    }
+}
+
+template<typename T, typename C, typename A>
+void RedBlackTree<T, C, A>::ToString(std::string& result, const std::string& prefix, const Node* node, bool isRight) const
 {
     if (node != NIL)
     {
@@ -780,69 +1650,119 @@ void RedBlackTree<T, C>::ToString(std::string& result, const std::string& prefix
     }
 }
 
-template<typename T, typename C>
-void RedBlackTree<T, C>::Serialize(std::ostream& os, Node* node) const
+template<typename T, typename C, typename A>
+void RedBlackTree<T, C, A>::Serialize(std::ostream& os) const
 {
-    if (os.fail())
-    {
-        return;
-    }
-    if (node != NIL)
+    if (Root() == NIL)
     {
         os << NIL_VALUE << " ";
+        return;
     }
-    else
+
+    Node* node = Root();
+    Node* previous = NIL;
+    while (node != NIL && !os.fail())
     {
-        os << node->value << " ";
-        Serialize(os, node->left);
-        Serialize(os, node->right);
+        if (previous == node->parent)                                   // Węzeł odwiedzany pierwszy raz
+        {
+            os << node->value << " ";
+            if (node->left != NIL)
+            {
+                previous = node;
+                node = node->left;
+                continue;
+            }
+            os << NIL_VALUE << " ";
+            previous = NIL;
+        }
+        if (previous == node->left)                                     // Lewe poddrzewo zostało zapisane
+        {
+            if (node->right != NIL)
+            {
+                previous = node;
+                node = node->right;
+                continue;
+            }
+            os << NIL_VALUE << " ";
+        }
+        previous = node;
+        node = node->parent;
     }
 }
 
-template<typename T, typename C>
-typename RedBlackTree<T, C>::Node* RedBlackTree<T, C>::Deserialize(std::istream& is, Node* node, size_t& sizeOfTree)
+template<typename T, typename C, typename A>
+void RedBlackTree<T, C, A>::Deserialize(std::istream& is, size_t sizeOfTree)
 {
-    if (is.fail() || sizeOfTree == 0)
+    Clear();
+    pool.Reserve(Utils::Min(sizeOfTree, MAX_RESERVED_NODES));   // Dalsze węzły zajmują kolejne bloki
+
+    Node* node = ReadNode(is, NIL);
+    SetRoot(node);
+    bool isLeftRead = false;
+    while (node != NIL)
     {
-        return NIL;
+        Node* child = ReadNode(is, node);
+        (isLeftRead ? node->right : node->left) = child;
+        if (child != NIL)
+        {
+            node = child;
+            isLeftRead = false;
+        }
+        else if (!isLeftRead)
+        {
+            isLeftRead = true;
+        }
+        else
+        {
+            while (node->parent != NIL && node->parent->right == node)  // Wraca do najbliższego przodka,
+            {                                                           // którego prawe dziecko nie zostało
+                node = node->parent;                                    // jeszcze wczytane
+            }
+            node = node->parent;
+        }
     }
+
+    auto nodes = ReleaseNodes();
+    Build(nodes);
+}
+
+template<typename T, typename C, typename A>
+typename RedBlackTree<T, C, A>::Node* RedBlackTree<T, C, A>::ReadNode(std::istream& is, Node* parent)
+{
     int64_t value;
-    is >> value;
-    if (value == NIL_VALUE)
+    if (!(is >> value) || value == NIL_VALUE)
     {
         return NIL;
     }
-    Node* newNode = MakeNode(static_cast<DataType>(value));
-    sizeOfTree--;
 
-    newNode->parent = node;
-    newNode->left   = Deserialize(is, newNode, sizeOfTree);
-    newNode->right  = Deserialize(is, newNode, sizeOfTree);
+    Node* node = MakeNode(static_cast<DataType>(value));
+    node->parent = parent;
+    size++;
 
-    return newNode;
+    return node;
 }
 
-template<typename T, typename C>
-RedBlackTreeConstIterator<T, C>::RedBlackTreeConstIterator(const RedBlackTree<T, C>* redBlackTree,
-                                                           typename RedBlackTree<T, C>::Node* node) noexcept
+template<typename T, typename C, typename A>
+RedBlackTreeConstIterator<T, C, A>::RedBlackTreeConstIterator(const RedBlackTree<T, C, A>* redBlackTree,
+                                                           typename RedBlackTree<T, C, A>::Node* node) noexcept
     : redBlackTree(redBlackTree)
     , node(node)
 { }
 
-template<typename T, typename C>
-typename RedBlackTreeConstIterator<T, C>::reference RedBlackTreeConstIterator<T, C>::operator*() const noexcept
+template<typename T, typename C, typename A>
+typename RedBlackTreeConstIterator<T, C, A>::reference RedBlackTreeConstIterator<T, C, A>::operator*() const noexcept
 {
     return node->value;
 }
 
-template<typename T, typename C>
-typename RedBlackTreeConstIterator<T, C>::pointer RedBlackTreeConstIterator<T, C>::operator->() const noexcept
+template<typename T, typename C, typename A>
+typename RedBlackTreeConstIterator<T, C, A>::pointer RedBlackTreeConstIterator<T, C, A>::operator->() const noexcept
 {
     return &(**this);
 }
 
-template<typename T, typename C>
-RedBlackTreeConstIterator<T, C>& RedBlackTreeConstIterator<T, C>::operator++() noexcept
+template<typename T, typename C, typename A>
+RedBlackTreeConstIterator<T, C, A>& RedBlackTreeConstIterator<T, C, A>::operator++() noexcept
 {
     if (node->right == redBlackTree->NIL)
     {
@@ -861,16 +1781,16 @@ RedBlackTreeConstIterator<T, C>& RedBlackTreeConstIterator<T, C>::operator++() n
     return *this;
 }
 
-template<typename T, typename C>
-RedBlackTreeConstIterator<T, C> RedBlackTreeConstIterator<T, C>::operator++(int) noexcept
+template<typename T, typename C, typename A>
+RedBlackTreeConstIterator<T, C, A> RedBlackTreeConstIterator<T, C, A>::operator++(int) noexcept
 {
     RedBlackTreeConstIterator tmp = *this;
     ++(*this);
     return tmp;
 }
 
-template<typename T, typename C>
-RedBlackTreeConstIterator<T, C>& RedBlackTreeConstIterator<T, C>::operator--() noexcept
+template<typename T, typename C, typename A>
+RedBlackTreeConstIterator<T, C, A>& RedBlackTreeConstIterator<T, C, A>::operator--() noexcept
 {
     if (node == redBlackTree->NIL)
     {
@@ -896,64 +1816,64 @@ RedBlackTreeConstIterator<T, C>& RedBlackTreeConstIterator<T, C>::operator--() n
     return *this;
 }
 
-template<typename T, typename C>
-RedBlackTreeConstIterator<T, C> RedBlackTreeConstIterator<T, C>::operator--(int) noexcept
+template<typename T, typename C, typename A>
+RedBlackTreeConstIterator<T, C, A> RedBlackTreeConstIterator<T, C, A>::operator--(int) noexcept
 {
     RedBlackTreeConstIterator tmp = *this;
     --(*this);
     return tmp;
 }
 
-template<typename T, typename C>
-bool RedBlackTreeConstIterator<T, C>::operator==(const RedBlackTreeConstIterator& rhs) const noexcept
+template<typename T, typename C, typename A>
+bool RedBlackTreeConstIterator<T, C, A>::operator==(const RedBlackTreeConstIterator& rhs) const noexcept
 {
     return node == rhs.node;
 }
 
-template<typename T, typename C>
-bool RedBlackTreeConstIterator<T, C>::operator!=(const RedBlackTreeConstIterator& rhs) const noexcept
+template<typename T, typename C, typename A>
+bool RedBlackTreeConstIterator<T, C, A>::operator!=(const RedBlackTreeConstIterator& rhs) const noexcept
 {
     return !(*this == rhs);
 }
 
-template<typename T, typename C>
-typename RedBlackTreeIterator<T, C>::reference RedBlackTreeIterator<T, C>::operator*() const noexcept
+template<typename T, typename C, typename A>
+typename RedBlackTreeIterator<T, C, A>::reference RedBlackTreeIterator<T, C, A>::operator*() const noexcept
 {
-    return const_cast<reference>(RedBlackTreeConstIterator<T, C>::operator*());
+    return const_cast<reference>(RedBlackTreeConstIterator<T, C, A>::operator*());
 }
 
-template<typename T, typename C>
-typename RedBlackTreeIterator<T, C>::pointer RedBlackTreeIterator<T, C>::operator->() const noexcept
+template<typename T, typename C, typename A>
+typename RedBlackTreeIterator<T, C, A>::pointer RedBlackTreeIterator<T, C, A>::operator->() const noexcept
 {
     return &(**this);
 }
 
-template<typename T, typename C>
-RedBlackTreeIterator<T, C>& RedBlackTreeIterator<T, C>::operator++() noexcept
+template<typename T, typename C, typename A>
+RedBlackTreeIterator<T, C, A>& RedBlackTreeIterator<T, C, A>::operator++() noexcept
 {
-    RedBlackTreeConstIterator<T, C>::operator++();
+    RedBlackTreeConstIterator<T, C, A>::operator++();
     return *this;
 }
 
-template<typename T, typename C>
-RedBlackTreeIterator<T, C> RedBlackTreeIterator<T, C>::operator++(int) noexcept
+template<typename T, typename C, typename A>
+RedBlackTreeIterator<T, C, A> RedBlackTreeIterator<T, C, A>::operator++(int) noexcept
 {
     RedBlackTreeIterator tmp = *this;
-    RedBlackTreeConstIterator<T, C>::operator++();
+    RedBlackTreeConstIterator<T, C, A>::operator++();
     return tmp;
 }
 
-template<typename T, typename C>
-RedBlackTreeIterator<T, C>& RedBlackTreeIterator<T, C>::operator--() noexcept
+template<typename T, typename C, typename A>
+RedBlackTreeIterator<T, C, A>& RedBlackTreeIterator<T, C, A>::operator--() noexcept
 {
-    RedBlackTreeConstIterator<T, C>::operator--();
+    RedBlackTreeConstIterator<T, C, A>::operator--();
     return *this;
 }
 
-template<typename T, typename C>
-RedBlackTreeIterator<T, C> RedBlackTreeIterator<T, C>::operator--(int) noexcept
+template<typename T, typename C, typename A>
+RedBlackTreeIterator<T, C, A> RedBlackTreeIterator<T, C, A>::operator--(int) noexcept
 {
     RedBlackTreeIterator tmp = *this;
-    RedBlackTreeConstIterator<T, C>::operator--();
+    RedBlackTreeConstIterator<T, C, A>::operator--();
     return tmp;
 }
\ No newline at end of file
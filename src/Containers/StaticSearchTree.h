@@ -0,0 +1,466 @@
+#pragma once
+
+#include "DynamicArray.h"
+#include "Utils/Algorithms.h"
+#include "Utils/Utils.h"
+
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <xmmintrin.h>
+#endif
+
+enum class StaticSearchTreeLayout
+{
+    /**
+     * Binary tree in BFS order, node k has children 2k and 2k + 1
+     */
+    EYTZINGER,
+
+    /**
+     * Static B-tree with nodes filling a cache line, node k has children k * (B + 1) + i + 1
+     */
+    S_TREE
+};
+
+/**
+ * Immutable set of sorted values laid out for searching. The descent has no branches depending on the values
+ * and in Eytzinger layout prefetches nodes a cache line ahead. Searches return pointers to the stored values,
+ * duplicates of the maximum may be returned instead of it in S-tree layout
+ */
+template<typename T, typename C = Utils::Less<T>, StaticSearchTreeLayout Layout = StaticSearchTreeLayout::EYTZINGER>
+class StaticSearchTree
+{
+public:
+    using DataType = T;
+    using Comparator = C;
+
+    [[nodiscard]] static constexpr const char* ClassName() noexcept { return "StaticSearchTree"; }
+
+    explicit StaticSearchTree(const Comparator& comparator = Comparator());
+
+    /**
+     * Sorts a copy of the values, unless they are sorted already
+     */
+    explicit StaticSearchTree(const DynamicArray<DataType>& values, const Comparator& comparator = Comparator());
+    StaticSearchTree(const StaticSearchTree& rhs);
+    StaticSearchTree(StaticSearchTree&& rhs) noexcept;
+    StaticSearchTree& operator=(const StaticSearchTree& rhs);
+    StaticSearchTree& operator=(StaticSearchTree&& rhs) noexcept;
+    ~StaticSearchTree();
+
+    /**
+     * The range has to be sorted according to the comparator
+     */
+    template<typename It>
+    [[nodiscard]] static StaticSearchTree FromSorted(It first, It last, const Comparator& comparator = Comparator());
+
+    /**
+     * @return element equivalent to the value or nullptr
+     */
+    [[nodiscard]] const DataType* Find(const DataType& value) const noexcept;
+
+    /**
+     * @return first element not less than the value or nullptr
+     */
+    [[nodiscard]] const DataType* LowerBound(const DataType& value) const noexcept;
+
+    /**
+     * @return first element greater than the value or nullptr
+     */
+    [[nodiscard]] const DataType* UpperBound(const DataType& value) const noexcept;
+
+    [[nodiscard]] bool Contains(const DataType& value) const noexcept;
+
+    [[nodiscard]] size_t Size() const noexcept;
+
+    /**
+     * @return values in the order they are laid out
+     */
+    [[nodiscard]] std::string ToString() const;
+
+private:
+    inline static constexpr size_t CACHE_LINE = 64;
+
+    /**
+     * Number of values in a node of S-tree, one cache line but at least 4
+     */
+    inline static constexpr size_t NODE_SIZE = Utils::Max(CACHE_LINE / sizeof(T), size_t {4});
+
+    /**
+     * Descendants of node k from j levels below lie in [k * 2^j, (k + 1) * 2^j), so 2^j of them fitting
+     * in a cache line are fetched together
+     */
+    inline static constexpr size_t PREFETCH_STRIDE = [] {
+        size_t stride = 1;
+        while (2 * stride * sizeof(T) <= CACHE_LINE)
+        {
+            stride *= 2;
+        }
+        return stride;
+    }();
+
+    inline static constexpr bool IS_VECTORIZABLE = std::is_arithmetic_v<DataType> && std::is_same_v<Comparator, Utils::Less<DataType>>;
+
+    template<typename It>
+    void Build(It first, size_t count);
+
+    template<typename It>
+    void BuildEytzinger(It& it, size_t node);
+
+    template<typename It>
+    void BuildSTree(It& it, size_t& remaining, const DataType& maximum, size_t node);
+
+    /**
+     * Chosen at compile time, so the comparison in the descent compiles to a conditional move
+     */
+    template<bool IsUpper>
+    [[nodiscard]] const DataType* Bound(const DataType& value) const noexcept;
+
+    template<bool IsUpper>
+    [[nodiscard]] const DataType* EytzingerBound(const DataType& value) const noexcept;
+
+    template<bool IsUpper>
+    [[nodiscard]] const DataType* STreeBound(const DataType& value) const noexcept;
+
+    /**
+     * @return number of values less than the value, or not greater if isUpper is set
+     */
+    template<bool IsUpper>
+    [[nodiscard]] size_t SearchNode(const DataType* values, const DataType& value) const noexcept;
+
+    /**
+     * Requests the cache line holding the index, which may lie beyond the values
+     */
+    void Prefetch(size_t index) const noexcept;
+    void Release() noexcept;
+
+    DataType* data = nullptr;
+    size_t slots = 0u;                                              // Liczba skonstruowanych elementów
+    size_t size = 0u;
+    size_t numberOfNodes = 0u;
+    Comparator comparator;
+};
+
+template<typename T, typename C, StaticSearchTreeLayout L>
+StaticSearchTree<T, C, L>::StaticSearchTree(const Comparator& comparator)
+    : comparator(comparator)
+{ }
+
+template<typename T, typename C, StaticSearchTreeLayout L>
+StaticSearchTree<T, C, L>::StaticSearchTree(const DynamicArray<DataType>& values, const Comparator& comparator)
+    : comparator(comparator)
+{
+    bool isSorted = true;
+    for (size_t i = 1; i < values.Size() && isSorted; i++)
+    {
+        isSorted = !comparator(values[i], values[i - 1]);
+    }
+    if (isSorted)
+    {
+        Build(values.cbegin(), values.Size());
+        return;
+    }
+
+    auto sorted = values;
+    Utils::QuickSort(sorted.begin(), sorted.end(), comparator);
+    Build(sorted.cbegin(), sorted.Size());
+}
+
+template<typename T, typename C, StaticSearchTreeLayout L>
+StaticSearchTree<T, C, L>::StaticSearchTree(const StaticSearchTree& rhs)
+    : comparator(rhs.comparator)
+{
+    data = static_cast<DataType*>(::operator new(rhs.slots * sizeof(DataType), std::align_val_t {CACHE_LINE}));
+    for (; slots < rhs.slots; slots++)
+    {
+        new (data + slots) DataType(rhs.data[slots]);
+    }
+    size = rhs.size;
+    numberOfNodes = rhs.numberOfNodes;
+}
+
+template<typename T, typename C, StaticSearchTreeLayout L>
+StaticSearchTree<T, C, L>::StaticSearchTree(StaticSearchTree&& rhs) noexcept
+    : data(rhs.data)
+    , slots(rhs.slots)
+    , size(rhs.size)
+    , numberOfNodes(rhs.numberOfNodes)
+    , comparator(std::move(rhs.comparator))
+{
+    rhs.data = nullptr;
+    rhs.slots = rhs.size = rhs.numberOfNodes = 0u;
+}
+
+template<typename T, typename C, StaticSearchTreeLayout L>
+StaticSearchTree<T, C, L>& StaticSearchTree<T, C, L>::operator=(const StaticSearchTree& rhs)
+{
+    if (this == &rhs)
+    {
+        return *this;
+    }
+    return *this = StaticSearchTree(rhs);
+}
+
+template<typename T, typename C, StaticSearchTreeLayout L>
+StaticSearchTree<T, C, L>& StaticSearchTree<T, C, L>::operator=(StaticSearchTree&& rhs) noexcept
+{
+    if (this == &rhs)
+    {
+        return *this;
+    }
+    Release();
+
+    data = rhs.data;
+    slots = rhs.slots;
+    size = rhs.size;
+    numberOfNodes = rhs.numberOfNodes;
+    comparator = std::move(rhs.comparator);
+    rhs.data = nullptr;
+    rhs.slots = rhs.size = rhs.numberOfNodes = 0u;
+
+    return *this;
+}
+
+template<typename T, typename C, StaticSearchTreeLayout L>
+StaticSearchTree<T, C, L>::~StaticSearchTree()
+{
+    Release();
+}
+
+template<typename T, typename C, StaticSearchTreeLayout L>
+template<typename It>
+StaticSearchTree<T, C, L> StaticSearchTree<T, C, L>::FromSorted(It first, It last, const Comparator& comparator)
+{
+    StaticSearchTree tree(comparator);
+    tree.Build(first, static_cast<size_t>(std::distance(first, last)));
+
+    return tree;
+}
+
+template<typename T, typename C, StaticSearchTreeLayout L>
+const typename StaticSearchTree<T, C, L>::DataType* StaticSearchTree<T, C, L>::Find(const DataType& value) const noexcept
+{
+    const DataType* bound = LowerBound(value);
+    return bound != nullptr && !comparator(value, *bound) ? bound : nullptr;
+}
+
+template<typename T, typename C, StaticSearchTreeLayout L>
+const typename StaticSearchTree<T, C, L>::DataType* StaticSearchTree<T, C, L>::LowerBound(const DataType& value) const noexcept
+{
+    return Bound<false>(value);
+}
+
+template<typename T, typename C, StaticSearchTreeLayout L>
+const typename StaticSearchTree<T, C, L>::DataType* StaticSearchTree<T, C, L>::UpperBound(const DataType& value) const noexcept
+{
+    return Bound<true>(value);
+}
+
+template<typename T, typename C, StaticSearchTreeLayout L>
+bool StaticSearchTree<T, C, L>::Contains(const DataType& value) const noexcept
+{
+    return Find(value) != nullptr;
+}
+
+template<typename T, typename C, StaticSearchTreeLayout L>
+size_t StaticSearchTree<T, C, L>::Size() const noexcept
+{
+    return size;
+}
+
+template<typename T, typename C, StaticSearchTreeLayout L>
+std::string StaticSearchTree<T, C, L>::ToString() const
+{
+    std::string result = "[";
+    const size_t first = L == StaticSearchTreeLayout::EYTZINGER ? 1u : 0u;
+    for (size_t i = first; i < slots; i++)
+    {
+        result += (i > first ? " " : "") + Utils::Parser::ToString(data[i]);
+    }
+    result += "]";
+
+    return result;
+}
+
+template<typename T, typename C, StaticSearchTreeLayout L>
+template<typename It>
+void StaticSearchTree<T, C, L>::Build(It first, size_t count)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    size = count;
+    if constexpr (L == StaticSearchTreeLayout::EYTZINGER)
+    {
+        slots = count + 1;                                          // Indeksy od 1, pole 0 jest kopią
+    }                                                               // pierwszego elementu
+    else
+    {
+        numberOfNodes = (count + NODE_SIZE - 1) / NODE_SIZE;
+        slots = numberOfNodes * NODE_SIZE;
+    }
+    data = static_cast<DataType*>(::operator new(slots * sizeof(DataType), std::align_val_t {CACHE_LINE}));
+
+    if constexpr (L == StaticSearchTreeLayout::EYTZINGER)
+    {
+        new (data) DataType(*first);
+        BuildEytzinger(first, 1);
+    }
+    else
+    {
+        const DataType maximum = *std::next(first, static_cast<typename std::iterator_traits<It>::difference_type>(count - 1));
+        size_t remaining = count;
+        BuildSTree(first, remaining, maximum, 0);
+    }
+}
+
+template<typename T, typename C, StaticSearchTreeLayout L>
+template<typename It>
+void StaticSearchTree<T, C, L>::BuildEytzinger(It& it, size_t node)
+{
+    if (node > size)                                                // Przejście in-order, głębokość log n
+    {
+        return;
+    }
+    BuildEytzinger(it, 2 * node);
+    new (data + node) DataType(*it);
+    ++it;
+    BuildEytzinger(it, 2 * node + 1);
+}
+
+template<typename T, typename C, StaticSearchTreeLayout L>
+template<typename It>
+void StaticSearchTree<T, C, L>::BuildSTree(It& it, size_t& remaining, const DataType& maximum, size_t node)
+{
+    if (node >= numberOfNodes)
+    {
+        return;
+    }
+    for (size_t i = 0; i < NODE_SIZE; i++)
+    {
+        BuildSTree(it, remaining, maximum, node * (NODE_SIZE + 1) + i + 1);
+        if (remaining > 0)
+        {
+            new (data + node * NODE_SIZE + i) DataType(*it);
+            ++it;
+            remaining--;
+        }
+        else
+        {
+            new (data + node * NODE_SIZE + i) DataType(maximum);   // Dopełnienie nie zmienia porządku
+        }
+    }
+    BuildSTree(it, remaining, maximum, node * (NODE_SIZE + 1) + NODE_SIZE + 1);
+}
+
+template<typename T, typename C, StaticSearchTreeLayout L>
+template<bool IsUpper>
+const typename StaticSearchTree<T, C, L>::DataType* StaticSearchTree<T, C, L>::Bound(const DataType& value) const noexcept
+{
+    if constexpr (L == StaticSearchTreeLayout::EYTZINGER)
+    {
+        return EytzingerBound<IsUpper>(value);
+    }
+    else
+    {
+        return STreeBound<IsUpper>(value);
+    }
+}
+
+template<typename T, typename C, StaticSearchTreeLayout L>
+template<bool IsUpper>
+const typename StaticSearchTree<T, C, L>::DataType* StaticSearchTree<T, C, L>::EytzingerBound(const DataType& value) const noexcept
+{
+    size_t node = 1;
+    while (node <= size)
+    {
+        Prefetch(node * PREFETCH_STRIDE);
+        node = 2 * node + static_cast<size_t>(IsUpper ? !comparator(value, data[node]) : comparator(data[node], value));
+    }
+
+    // Po ostatnim skręcie w lewo nastąpiły same skręty w prawo, usuwamy je wraz z nim
+    size_t rightTurns = 0;
+    while ((node >> rightTurns) & 1u)
+    {
+        rightTurns++;
+    }
+    node >>= rightTurns + 1;
+
+    return node != 0 ? data + node : nullptr;
+}
+
+template<typename T, typename C, StaticSearchTreeLayout L>
+template<bool IsUpper>
+const typename StaticSearchTree<T, C, L>::DataType* StaticSearchTree<T, C, L>::STreeBound(const DataType& value) const noexcept
+{
+    const DataType* bound = nullptr;
+    size_t node = 0;
+    while (node < numberOfNodes)
+    {
+        const DataType* values = data + node * NODE_SIZE;
+        const size_t index = SearchNode<IsUpper>(values, value);
+        if (index < NODE_SIZE)
+        {
+            bound = values + index;
+        }
+        node = node * (NODE_SIZE + 1) + index + 1;
+    }
+    return bound;
+}
+
+template<typename T, typename C, StaticSearchTreeLayout L>
+template<bool IsUpper>
+size_t StaticSearchTree<T, C, L>::SearchNode(const DataType* values, const DataType& value) const noexcept
+{
+    if constexpr (IS_VECTORIZABLE)
+    {
+        return Utils::CountLess(values, NODE_SIZE, value, IsUpper);
+    }
+    else
+    {
+        size_t low = 0;
+        size_t high = NODE_SIZE;
+        while (low < high)
+        {
+            const size_t middle = low + (high - low) / 2;
+            if (IsUpper ? !comparator(value, values[middle]) : comparator(values[middle], value))
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+        return low;
+    }
+}
+
+template<typename T, typename C, StaticSearchTreeLayout L>
+void StaticSearchTree<T, C, L>::Prefetch([[maybe_unused]] size_t index) const noexcept
+{
+#if defined(__SSE2__) || defined(_M_X64)
+    // Prefetch adresu spoza tablicy nie powoduje błędu, wskaźnik liczymy bez arytmetyki wskaźników
+    const auto address = reinterpret_cast<uintptr_t>(data) + index * sizeof(DataType);
+    _mm_prefetch(reinterpret_cast<const char*>(address), _MM_HINT_T0);
+#endif
+}
+
+template<typename T, typename C, StaticSearchTreeLayout L>
+void StaticSearchTree<T, C, L>::Release() noexcept
+{
+    for (size_t i = 0; i < slots; i++)
+    {
+        data[i].~DataType();
+    }
+    ::operator delete(data, std::align_val_t {CACHE_LINE});
+
+    data = nullptr;
+    slots = size = numberOfNodes = 0u;
+}
\ No newline at end of file
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+
+/**
+ * Policies of RedBlackTree and AvlTree, which decide what additional data are kept in the nodes.
+ * Update recomputes the data of a node from its children and is called by the trees after every
+ * change of the subtree, NIL nodes are never updated
+ */
+namespace TreeAugmentation
+{
+
+/**
+ * Default policy, nodes carry no additional data
+ */
+struct None
+{
+    struct NodeData
+    { };
+
+    template<typename Node>
+    static void Update(Node*) noexcept
+    { }
+
+    template<typename Node>
+    static void UpdatePath(Node*, const Node*) noexcept
+    { }
+};
+
+/**
+ * Keeps the size of every subtree in its root, enables Select, Rank and CountRange in O(log n)
+ */
+struct OrderStatistics
+{
+    struct NodeData
+    {
+        size_t subtreeSize;
+    };
+
+    template<typename Node>
+    static void Update(Node* node) noexcept
+    {
+        node->subtreeSize = node->left->subtreeSize + node->right->subtreeSize + 1;
+    }
+
+    /**
+     * Updates the node and all of its ancestors up to the root
+     */
+    template<typename Node>
+    static void UpdatePath(Node* node, const Node* nil) noexcept
+    {
+        for (; node != nil; node = node->parent)
+        {
+            Update(node);
+        }
+    }
+};
+
+}
\ No newline at end of file
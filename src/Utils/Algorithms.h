@@ -2,6 +2,10 @@
 
 #include "Utils.h"
 
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
 namespace Utils
 {
 
@@ -41,6 +45,19 @@ void QuickSort(It first, It last, Comparator comparator);
 template<typename It>
 void QuickSort(It first, It last);
 
+/**
+ * Sorts a range [first, last) with bottom-up merge sort, stable and without recursion
+ * @tparam It random access iterator
+ * @tparam Buffer random access iterator
+ * @tparam Comparator
+ * @param first
+ * @param last
+ * @param buffer beginning of a range at least as long as [first, last)
+ * @param comparator
+ */
+template<typename It, typename Buffer, typename Comparator>
+void MergeSort(It first, It last, Buffer buffer, Comparator comparator);
+
 /**
  * @tparam It
  * @param first
@@ -59,6 +76,17 @@ It MinElement(It first, It last);
 template<typename It>
 It MaxElement(It first, It last);
 
+/**
+ * Counts without branches, which lets the compiler vectorize the loop. Values of int32_t are compared with SSE2
+ * @tparam T arithmetic type
+ * @param values sorted range of count values
+ * @param value
+ * @param isUpper
+ * @return number of values less than the value, or not greater if isUpper is set
+ */
+template<typename T>
+[[nodiscard]] size_t CountLess(const T* values, size_t count, const T& value, bool isUpper) noexcept;
+
 /**
  * DEFINITIONS
  */
@@ -69,6 +97,12 @@ namespace Impl
 template<typename It, typename Comparator>
 It Partition(It first, It last, Comparator comparator);
 
+/**
+ * Merges every pair of neighbouring sorted runs of the given width from one range into the other
+ */
+template<typename From, typename To, typename Difference, typename Comparator>
+void MergeRuns(From from, To to, Difference length, Difference width, Comparator& comparator);
+
 }
 
 template<typename It>
@@ -100,6 +134,34 @@ void QuickSort(It first, It last)
     QuickSort(first, last, Less<decltype(*first)>());
 }
 
+template<typename It, typename Buffer, typename Comparator>
+void MergeSort(It first, It last, Buffer buffer, Comparator comparator)
+{
+    const auto length = last - first;
+    bool isInBuffer = false;
+
+    for (decltype(last - first) width = 1; width < length; width *= 2)
+    {
+        if (isInBuffer)
+        {
+            Impl::MergeRuns(buffer, first, length, width, comparator);
+        }
+        else
+        {
+            Impl::MergeRuns(first, buffer, length, width, comparator);
+        }
+        isInBuffer = !isInBuffer;
+    }
+
+    if (isInBuffer)
+    {
+        for (decltype(last - first) i = 0; i < length; i++)
+        {
+            first[i] = buffer[i];
+        }
+    }
+}
+
 template<typename It>
 It MinElement(It first, It last)
 {
@@ -128,6 +190,52 @@ It MaxElement(It first, It last)
     return maximum;
 }
 
+template<typename T>
+size_t CountLess(const T* values, size_t count, const T& value, bool isUpper) noexcept
+{
+    static_assert(std::is_arithmetic_v<T>, "Only arithmetic types can be counted without branches");
+
+    size_t result = 0;
+    size_t i = 0;
+#if defined(__SSE2__) || defined(_M_X64)
+    if constexpr (std::is_same_v<T, int32_t>)
+    {
+        // Maski porównań są równe -1, więc odejmowanie zlicza spełniające je klucze
+        const __m128i needle = _mm_set1_epi32(value);
+        __m128i counter = _mm_setzero_si128();
+        const size_t vectorCount = count - count % 4;
+        for (; i < vectorCount; i += 4)
+        {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+            counter = _mm_sub_epi32(counter, isUpper ? _mm_cmpgt_epi32(block, needle) : _mm_cmplt_epi32(block, needle));
+        }
+
+        int32_t lanes[4];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), counter);
+        result = static_cast<size_t>(lanes[0]) + static_cast<size_t>(lanes[1]) + static_cast<size_t>(lanes[2]) + static_cast<size_t>(lanes[3]);
+        if (isUpper)
+        {
+            result = i - result;
+        }
+    }
+#endif
+    if (isUpper)
+    {
+        for (; i < count; i++)
+        {
+            result += static_cast<size_t>(!(value < values[i]));
+        }
+    }
+    else
+    {
+        for (; i < count; i++)
+        {
+            result += static_cast<size_t>(values[i] < value);
+        }
+    }
+    return result;
+}
+
 namespace Impl
 {
 
@@ -147,4 +255,30 @@ It Partition(It first, It last, Comparator comparator)
     return i;
 }
 
+template<typename From, typename To, typename Difference, typename Comparator>
+void MergeRuns(From from, To to, Difference length, Difference width, Comparator& comparator)
+{
+    for (Difference begin = 0; begin < length; begin += 2 * width)
+    {
+        const auto middle = Min(begin + width, length);
+        const auto end = Min(begin + 2 * width, length);
+        auto left = begin;
+        auto right = middle;
+        auto output = begin;
+
+        while (left < middle && right < end)
+        {
+            to[output++] = comparator(from[right], from[left]) ? from[right++] : from[left++];
+        }
+        while (left < middle)
+        {
+            to[output++] = from[left++];
+        }
+        while (right < end)
+        {
+            to[output++] = from[right++];
+        }
+    }
+}
+
 }}
\ No newline at end of file
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+
+namespace Utils
+{
+
+/**
+ * Epoch-based reclamation shared by all threads. Readers enter a critical section with Guard,
+ * a writer unlinks an object, calls Advance() and may free the object once every thread still
+ * in a critical section entered it at or after the returned epoch
+ */
+class Epoch
+{
+public:
+    /**
+     * Keeps objects reachable at its creation alive until its destruction. Guards may be nested.
+     * Entering and leaving never waits, only the first guard of a thread allocates its record,
+     * so only that one may throw std::bad_alloc
+     */
+    class Guard
+    {
+    public:
+        Guard();
+        Guard(const Guard& rhs) = delete;
+        Guard& operator=(const Guard& rhs) = delete;
+        ~Guard();
+    };
+
+    /**
+     * Starts a new epoch, objects unlinked before the call can be freed once IsQuiescent(returned epoch)
+     * @return the new epoch
+     */
+    static uint64_t Advance() noexcept;
+
+    /**
+     * @return smallest epoch in which a thread currently in a critical section entered it or maximum of uint64_t
+     */
+    [[nodiscard]] static uint64_t MinActive() noexcept;
+
+    [[nodiscard]] static bool IsQuiescent(uint64_t epoch) noexcept;
+
+private:
+    /**
+     * Records are never freed, a record of a finished thread is reused by the next one
+     */
+    struct alignas(64) Record
+    {
+        std::atomic<uint64_t> epoch {0u};                           // 0 poza sekcją krytyczną
+        std::atomic<bool> inUse {true};
+        Record* next = nullptr;
+        uint32_t nesting = 0u;                                      // Używane tylko przez właściciela
+    };
+
+    struct ThreadRecord
+    {
+        ThreadRecord();
+        ThreadRecord(const ThreadRecord& rhs) = delete;
+        ThreadRecord& operator=(const ThreadRecord& rhs) = delete;
+        ~ThreadRecord();
+
+        Record* record;
+    };
+
+    [[nodiscard]] static Record& GetRecord();
+
+    inline static std::atomic<uint64_t> globalEpoch {1u};
+    inline static std::atomic<Record*> records {nullptr};
+};
+
+inline Epoch::Guard::Guard()
+{
+    auto& record = GetRecord();
+    if (record.nesting++ == 0u)
+    {
+        record.epoch.store(globalEpoch.load());                     // seq_cst: zapis musi poprzedzać
+    }                                                               // odczyty chronionych wskaźników
+}
+
+inline Epoch::Guard::~Guard()
+{
+    auto& record = GetRecord();
+    if (--record.nesting == 0u)
+    {
+        record.epoch.store(0u, std::memory_order_release);
+    }
+}
+
+inline uint64_t Epoch::Advance() noexcept
+{
+    return globalEpoch.fetch_add(1u) + 1u;
+}
+
+inline uint64_t Epoch::MinActive() noexcept
+{
+    auto result = std::numeric_limits<uint64_t>::max();
+    for (auto* record = records.load(std::memory_order_acquire); record != nullptr; record = record->next)
+    {
+        auto epoch = record->epoch.load();
+        if (epoch != 0u && epoch < result)
+        {
+            result = epoch;
+        }
+    }
+    return result;
+}
+
+inline bool Epoch::IsQuiescent(uint64_t epoch) noexcept
+{
+    return epoch <= MinActive();
+}
+
+inline Epoch::ThreadRecord::ThreadRecord()
+{
+    for (record = records.load(std::memory_order_acquire); record != nullptr; record = record->next)
+    {
+        bool expected = false;
+        if (record->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire))
+        {
+            return;
+        }
+    }
+
+    record = new Record;
+    record->next = records.load(std::memory_order_relaxed);
+    while (!records.compare_exchange_weak(record->next, record, std::memory_order_release, std::memory_order_relaxed))
+    { }
+}
+
+inline Epoch::ThreadRecord::~ThreadRecord()
+{
+    record->epoch.store(0u, std::memory_order_release);
+    record->inUse.store(false, std::memory_order_release);
+}
+
+inline Epoch::Record& Epoch::GetRecord()
+{
+    thread_local ThreadRecord threadRecord;
+    return *threadRecord.record;
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,140 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Utils
+{
+    std::optional<MappedFile> MappedFile::Open(const std::string& path)
+    {
+        MappedFile file;
+#ifdef _WIN32
+        HANDLE handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (handle == INVALID_HANDLE_VALUE)
+        {
+            return {};
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(handle, &fileSize) || fileSize.QuadPart == 0)
+        {
+            CloseHandle(handle);
+            return {};
+        }
+
+        HANDLE mapping = CreateFileMappingA(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(handle);
+        if (mapping == nullptr)
+        {
+            return {};
+        }
+
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (view == nullptr)
+        {
+            CloseHandle(mapping);
+            return {};
+        }
+
+        file.mapping = mapping;
+        file.data = static_cast<const uint8_t*>(view);
+        file.size = static_cast<size_t>(fileSize.QuadPart);
+#else
+        int descriptor = open(path.c_str(), O_RDONLY);
+        if (descriptor < 0)
+        {
+            return {};
+        }
+
+        struct stat status{};
+        if (fstat(descriptor, &status) != 0 || status.st_size <= 0)
+        {
+            close(descriptor);
+            return {};
+        }
+
+        void* view = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+        close(descriptor);
+        if (view == MAP_FAILED)
+        {
+            return {};
+        }
+
+        file.data = static_cast<const uint8_t*>(view);
+        file.size = static_cast<size_t>(status.st_size);
+#endif
+        return file;
+    }
+
+    MappedFile::MappedFile(MappedFile&& rhs) noexcept
+        : data(rhs.data)
+        , size(rhs.size)
+#ifdef _WIN32
+        , mapping(rhs.mapping)
+#endif
+    {
+        rhs.data = nullptr;
+        rhs.size = 0;
+#ifdef _WIN32
+        rhs.mapping = nullptr;
+#endif
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            Unmap();
+            data = rhs.data;
+            size = rhs.size;
+            rhs.data = nullptr;
+            rhs.size = 0;
+#ifdef _WIN32
+            mapping = rhs.mapping;
+            rhs.mapping = nullptr;
+#endif
+        }
+        return *this;
+    }
+
+    MappedFile::~MappedFile()
+    {
+        Unmap();
+    }
+
+    const uint8_t* MappedFile::Data() const noexcept
+    {
+        return data;
+    }
+
+    size_t MappedFile::Size() const noexcept
+    {
+        return size;
+    }
+
+    void MappedFile::Unmap() noexcept
+    {
+        if (data == nullptr)
+        {
+            return;
+        }
+#ifdef _WIN32
+        UnmapViewOfFile(data);
+        CloseHandle(mapping);
+        mapping = nullptr;
+#else
+        munmap(const_cast<uint8_t*>(data), size);
+#endif
+        data = nullptr;
+        size = 0;
+    }
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace Utils
+{
+    /**
+     * Read-only view of a whole file mapped into memory. The mapping lives as long as the object
+     */
+    class MappedFile
+    {
+    public:
+        [[nodiscard]] static std::optional<MappedFile> Open(const std::string& path);
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile(MappedFile&& rhs) noexcept;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile& operator=(MappedFile&& rhs) noexcept;
+        ~MappedFile();
+
+        [[nodiscard]] const uint8_t* Data() const noexcept;
+        [[nodiscard]] size_t Size() const noexcept;
+
+    private:
+        MappedFile() = default;
+
+        void Unmap() noexcept;
+
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+#ifdef _WIN32
+        void* mapping = nullptr;
+#endif
+    };
+}
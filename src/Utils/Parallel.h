@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+
+#include "Containers/DynamicArray.h"
+#include "Utils/Utils.h"
+
+namespace Utils
+{
+
+/**
+ * @return number of threads supported by the hardware, at least 1
+ */
+[[nodiscard]] inline uint32_t GetNumberOfThreads() noexcept
+{
+    return Max(std::thread::hardware_concurrency(), 1u);
+}
+
+/**
+ * @return first element of the part when [0, size) is split into numberOfParts nearly equal parts,
+ * computed without overflow also for sizes which do not fit in 32 bits
+ */
+template<typename T>
+[[nodiscard]] inline T GetPartBegin(T size, uint32_t part, uint32_t numberOfParts) noexcept
+{
+    static_assert(std::is_unsigned_v<T> && sizeof(T) <= sizeof(uint64_t));
+
+    const uint64_t quotient = size / numberOfParts;
+    const uint64_t remainder = size % numberOfParts;
+    return static_cast<T>(quotient * part + remainder * part / numberOfParts);
+}
+
+/**
+ * Runs task(i) for every i from [0, numberOfTasks), each task on its own thread.
+ * The calling thread runs the first task and waits for the rest
+ */
+template<typename F>
+void ParallelFor(uint32_t numberOfTasks, F&& task)
+{
+    if (numberOfTasks == 0)
+    {
+        return;
+    }
+
+    DynamicArray<std::thread> threads(numberOfTasks - 1);
+    for (uint32_t i = 1; i < numberOfTasks; i++)
+    {
+        threads[i - 1] = std::thread([&task, i]() {
+            task(i);
+        });
+    }
+
+    task(0u);
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+}
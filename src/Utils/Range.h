@@ -0,0 +1,39 @@
+#pragma once
+
+namespace Utils
+{
+
+/**
+ * Non-owning view of [first, last), usable in range-based for loops
+ */
+template<typename It>
+class Range
+{
+public:
+    using Iterator = It;
+
+    constexpr Range(It first, It last) noexcept
+        : first(first), last(last)
+    { }
+
+    [[nodiscard]] constexpr It begin() const noexcept
+    {
+        return first;
+    }
+
+    [[nodiscard]] constexpr It end() const noexcept
+    {
+        return last;
+    }
+
+    [[nodiscard]] constexpr bool IsEmpty() const noexcept
+    {
+        return !(first != last);
+    }
+
+private:
+    It first;
+    It last;
+};
+
+}
@@ -109,6 +109,13 @@ constexpr void Swap(T& val1, T& val2) noexcept(std::is_nothrow_move_constructibl
 template<typename T>
 [[nodiscard]] constexpr const T& Max(const T& val1, const T& val2) noexcept(noexcept(val1 > val2));
 
+/**
+ * Own implementation of std::min
+ * @return minimum of two values
+ */
+template<typename T>
+[[nodiscard]] constexpr const T& Min(const T& val1, const T& val2) noexcept(noexcept(val1 < val2));
+
 /**
  * @tparam T type of object to be retrieved
  * @param is stream
@@ -168,6 +175,12 @@ constexpr const T& Max(const T& val1, const T& val2) noexcept(noexcept(val1 > va
     return val1 > val2 ? val1 : val2;
 }
 
+template<typename T>
+constexpr const T& Min(const T& val1, const T& val2) noexcept(noexcept(val1 < val2))
+{
+    return val1 < val2 ? val1 : val2;
+}
+
 template<typename T, std::enable_if_t<std::is_arithmetic_v<T>, bool>>
 [[nodiscard]] constexpr T Abs(T number) noexcept
 {
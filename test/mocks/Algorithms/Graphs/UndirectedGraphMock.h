@@ -8,6 +8,7 @@ class UndirectedGraphMock : public UndirectedGraph
 {
 public:
     MOCK_METHOD(Vertex, AddVertex, (), (override));
+    MOCK_METHOD(void, AddVertices, (uint32_t), (override));
     MOCK_METHOD(void, Clear, (), (override));
     MOCK_METHOD(bool, AddEdge, (const EdgeData&), (override));
     MOCK_METHOD(bool, RemoveEdge, (Edge), (override));
@@ -29,6 +30,7 @@ public:
 protected:
     MOCK_METHOD(void, Serialize, (std::ostream&), (const, override));
     MOCK_METHOD(void, Deserialize, (std::istream&), (override));
+    MOCK_METHOD(void, AppendEdges, (const DynamicArray<EdgeData>&), (override));
 };
 
 inline std::ostream& operator<<(std::ostream& os, const UndirectedGraph::EdgeData& edge)
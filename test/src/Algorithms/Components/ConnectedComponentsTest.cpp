@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+
+#include "Algorithms/Components/ConnectedComponents.h"
+#include "Algorithms/Graphs/UndirectedGraphs/ListGraph.h"
+#include "Algorithms/Graphs/UndirectedGraphs/MatrixGraph.h"
+
+namespace
+{
+
+template<typename T>
+T GenerateGraph()
+{
+    T graph;
+    graph.AddVertices(9);
+    graph.AddEdgesBulk({{{0, 4}, 1},
+                        {{4, 7}, 2},
+                        {{1, 2}, 3},
+                        {{3, 5}, 4},
+                        {{5, 8}, 5},
+                        {{8, 3}, 6}});
+    return graph;
+}
+
+void ExpectComponents(const ConnectedComponents::Result& result)
+{
+    EXPECT_EQ(result.numberOfComponents, 4);
+    DynamicArray<uint32_t> expected = {0, 1, 1, 2, 0, 2, 3, 0, 2};
+    ASSERT_EQ(result.componentIds.Size(), expected.Size());
+    for (size_t i = 0; i < expected.Size(); i++)
+    {
+        EXPECT_EQ(result.componentIds[i], expected[i]);
+    }
+}
+
+}
+
+TEST(ConnectedComponentsTest, DsuTest)
+{
+    ExpectComponents(ConnectedComponents::FindWithDsuOf(GenerateGraph<ListGraph>()));
+    ExpectComponents(ConnectedComponents::FindWithDsuOf(GenerateGraph<MatrixGraph>()));
+}
+
+TEST(ConnectedComponentsTest, BfsTest)
+{
+    ExpectComponents(ConnectedComponents::FindWithBfsOf(GenerateGraph<ListGraph>()));
+    ExpectComponents(ConnectedComponents::FindWithBfsOf(GenerateGraph<MatrixGraph>()));
+}
+
+TEST(ConnectedComponentsTest, LabelPropagationTest)
+{
+    for (uint32_t numberOfThreads : {1u, 2u, 4u})
+    {
+        ExpectComponents(ConnectedComponents::FindWithLabelPropagationOf(GenerateGraph<ListGraph>(), numberOfThreads));
+    }
+}
+
+TEST(ConnectedComponentsTest, LongPathTest)
+{
+    constexpr uint32_t order = 2000;
+    ListGraph graph;
+    graph.AddVertices(order);
+
+    DynamicArray<UndirectedGraph::EdgeData> edges(order - 2);
+    for (uint32_t i = 0; i + 2 < order; i++)
+    {
+        edges[i] = {{order - 1 - i, order - 2 - i}, 1};
+    }
+    graph.AddEdgesBulk(edges);
+
+    auto result = ConnectedComponents::FindWithLabelPropagationOf(graph, 3);
+    EXPECT_EQ(result.numberOfComponents, 2);
+    EXPECT_EQ(result.componentIds[0], 0);
+    EXPECT_EQ(result.componentIds[1], 1);
+    EXPECT_EQ(result.componentIds[order - 1], 1);
+
+    EXPECT_EQ(ConnectedComponents::FindWithDsuOf(graph).numberOfComponents, 2);
+    EXPECT_EQ(ConnectedComponents::FindWithBfsOf(graph).numberOfComponents, 2);
+}
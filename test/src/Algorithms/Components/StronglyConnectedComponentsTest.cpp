@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include "Algorithms/Components/StronglyConnectedComponents.h"
+#include "Algorithms/Graphs/DirectedGraphs/DirectedMatrixGraph.h"
+
+namespace
+{
+
+template<typename T>
+T GenerateGraph()
+{
+    T graph;
+    graph.AddVertices(8);
+    graph.AddDirectedEdgesBulk({{{0, 1}, 4},
+                                {{1, 2}, 1},
+                                {{2, 0}, 2},
+                                {{2, 3}, 7},
+                                {{1, 3}, 5},
+                                {{3, 4}, 1},
+                                {{4, 5}, 2},
+                                {{5, 3}, 3},
+                                {{6, 5}, 9},
+                                {{6, 7}, 1}});
+    return graph;
+}
+
+template<typename T>
+void ExpectComponents(const T& graph, const StronglyConnectedComponents::Result& result)
+{
+    ASSERT_EQ(result.componentIds.Size(), 8);
+    EXPECT_EQ(result.numberOfComponents, 4);
+
+    const auto& ids = result.componentIds;
+    EXPECT_EQ(ids[0], ids[1]);
+    EXPECT_EQ(ids[1], ids[2]);
+    EXPECT_EQ(ids[3], ids[4]);
+    EXPECT_EQ(ids[4], ids[5]);
+    EXPECT_NE(ids[0], ids[3]);
+    EXPECT_NE(ids[6], ids[7]);
+    EXPECT_NE(ids[0], ids[6]);
+
+    for (const auto& edge : graph.GetDirectedEdges())
+    {
+        EXPECT_LE(ids[edge.vertices.first], ids[edge.vertices.second]);
+    }
+}
+
+template<typename T>
+void ExpectCondensation(const T& graph)
+{
+    auto components = StronglyConnectedComponents::FindWithTarjanOf(graph);
+    auto condensation = StronglyConnectedComponents::GetCondensationOf(graph, components);
+    const auto& ids = components.componentIds;
+
+    EXPECT_EQ(condensation.GetOrder(), 4);
+    EXPECT_EQ(condensation.GetSize(), 3);
+    EXPECT_EQ(condensation.GetWeight({ids[0], ids[3]}), 5);
+    EXPECT_EQ(condensation.GetWeight({ids[6], ids[3]}), 9);
+    EXPECT_EQ(condensation.GetWeight({ids[6], ids[7]}), 1);
+}
+
+}
+
+TEST(StronglyConnectedComponentsTest, TarjanTest)
+{
+    auto listGraph = GenerateGraph<DirectedListGraph>();
+    ExpectComponents(listGraph, StronglyConnectedComponents::FindWithTarjanOf(listGraph));
+
+    auto matrixGraph = GenerateGraph<DirectedMatrixGraph>();
+    ExpectComponents(matrixGraph, StronglyConnectedComponents::FindWithTarjanOf(matrixGraph));
+}
+
+TEST(StronglyConnectedComponentsTest, KosarajuTest)
+{
+    auto listGraph = GenerateGraph<DirectedListGraph>();
+    ExpectComponents(listGraph, StronglyConnectedComponents::FindWithKosarajuOf(listGraph));
+
+    auto matrixGraph = GenerateGraph<DirectedMatrixGraph>();
+    ExpectComponents(matrixGraph, StronglyConnectedComponents::FindWithKosarajuOf(matrixGraph));
+}
+
+TEST(StronglyConnectedComponentsTest, CondensationTest)
+{
+    ExpectCondensation(GenerateGraph<DirectedListGraph>());
+    ExpectCondensation(GenerateGraph<DirectedMatrixGraph>());
+}
+
+TEST(StronglyConnectedComponentsTest, TopologicalOrderTest)
+{
+    EXPECT_FALSE(StronglyConnectedComponents::GetTopologicalOrderOf(GenerateGraph<DirectedListGraph>()).has_value());
+
+    DirectedListGraph graph;
+    graph.AddVertices(5);
+    graph.AddDirectedEdgesBulk({{{3, 1}, 1}, {{1, 0}, 1}, {{3, 4}, 1}, {{4, 0}, 1}, {{2, 3}, 1}});
+
+    auto order = StronglyConnectedComponents::GetTopologicalOrderOf(graph);
+    ASSERT_TRUE(order.has_value());
+    ASSERT_EQ(order->Size(), 5);
+
+    DynamicArray<size_t> positions(5);
+    for (size_t i = 0; i < order->Size(); i++)
+    {
+        positions[(*order)[i]] = i;
+    }
+    for (const auto& edge : graph.GetDirectedEdges())
+    {
+        EXPECT_LT(positions[edge.vertices.first], positions[edge.vertices.second]);
+    }
+}
+
+TEST(StronglyConnectedComponentsTest, LongCycleTest)
+{
+    constexpr uint32_t order = 5000;
+    DirectedListGraph graph;
+    graph.AddVertices(order);
+
+    DynamicArray<DirectedGraph::DirectedEdgeData> edges(order);
+    for (uint32_t i = 0; i < order; i++)
+    {
+        edges[i] = {{i, (i + 1) % order}, 1};
+    }
+    graph.AddDirectedEdgesBulk(edges);
+
+    Traversal::Scratch<DirectedListGraph> scratch;
+    EXPECT_EQ(StronglyConnectedComponents::FindWithTarjanOf(graph, scratch).numberOfComponents, 1);
+    EXPECT_EQ(StronglyConnectedComponents::FindWithKosarajuOf(graph, scratch).numberOfComponents, 1);
+}
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include "Algorithms/Graphs/CsrGraph.h"
+#include "Algorithms/Graphs/DirectedGraphs/DirectedListGraph.h"
+#include "Algorithms/Graphs/UndirectedGraphs/MatrixGraph.h"
+
+#include <filesystem>
+#include <fstream>
+
+class CsrGraphTest : public testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        std::filesystem::remove(binaryPath);
+        std::filesystem::remove(textPath);
+    }
+
+    template<typename T>
+    static void ExpectSameNeighbours(const T& graph, const CsrGraph& csrGraph)
+    {
+        ASSERT_EQ(graph.GetOrder(), csrGraph.GetOrder());
+        ASSERT_EQ(graph.GetSize(), csrGraph.GetSize());
+
+        for (auto vertex : csrGraph.GetVertexRange())
+        {
+            auto expected = graph.GetNeighboursOf(vertex).value();
+            ASSERT_EQ(csrGraph.GetNumberOfNeighboursOf(vertex), expected.Size());
+
+            size_t i = 0;
+            for (const auto& neighbour : csrGraph.GetNeighbourRangeOf(vertex))
+            {
+                EXPECT_EQ(neighbour.vertex, expected[i].vertex);
+                EXPECT_EQ(neighbour.weight, expected[i].weight);
+                i++;
+            }
+        }
+    }
+
+    const std::string binaryPath = (std::filesystem::temp_directory_path() / "CsrGraphTest.dsgr").string();
+    const std::string textPath = (std::filesystem::temp_directory_path() / "CsrGraphTest.txt").string();
+};
+
+TEST_F(CsrGraphTest, DirectedRoundTripTest)
+{
+    DirectedListGraph graph;
+    graph.AddVertices(5);
+    graph.AddDirectedEdgesBulk({{{0, 1}, 1}, {{4, 0}, 2}, {{3, 1}, 3}, {{1, 3}, 4}});
+
+    ASSERT_TRUE(CsrGraph::Save(binaryPath, graph));
+
+    auto csrGraph = CsrGraph::Load(binaryPath);
+    ASSERT_TRUE(csrGraph.has_value());
+    EXPECT_TRUE(csrGraph->IsDirected());
+    ExpectSameNeighbours(graph, *csrGraph);
+
+    EXPECT_FALSE(csrGraph->DoesExist(5));
+    EXPECT_TRUE(csrGraph->GetNeighbourRangeOf(5).IsEmpty());
+}
+
+TEST_F(CsrGraphTest, UndirectedRoundTripTest)
+{
+    MatrixGraph graph;
+    graph.AddVertices(5);
+    graph.AddEdgesBulk({{{0, 1}, 1}, {{4, 0}, 2}, {{3, 1}, 3}});
+
+    ASSERT_TRUE(CsrGraph::Save(binaryPath, graph));
+
+    auto csrGraph = CsrGraph::Load(binaryPath, CsrGraph::LoadPolicy::VALIDATE_NEIGHBOURS);
+    ASSERT_TRUE(csrGraph.has_value());
+    EXPECT_FALSE(csrGraph->IsDirected());
+    ExpectSameNeighbours(graph, *csrGraph);
+}
+
+TEST_F(CsrGraphTest, ConvertTextFileTest)
+{
+    DirectedListGraph graph;
+    graph.AddVertices(4);
+    graph.AddDirectedEdgesBulk({{{0, 1}, 5}, {{1, 2}, 6}, {{2, 3}, 7}, {{3, 0}, 8}});
+
+    {
+        std::ofstream fout(textPath);
+        fout << graph;
+    }
+
+    ASSERT_TRUE(CsrGraph::ConvertTextFile(textPath, binaryPath, true));
+
+    auto csrGraph = CsrGraph::Load(binaryPath);
+    ASSERT_TRUE(csrGraph.has_value());
+    ExpectSameNeighbours(graph, *csrGraph);
+}
+
+TEST_F(CsrGraphTest, InvalidFileTest)
+{
+    EXPECT_FALSE(CsrGraph::Load(binaryPath).has_value());
+
+    {
+        std::ofstream fout(binaryPath, std::ios::binary);
+        fout << "not a graph file at all, just some text";
+    }
+    EXPECT_FALSE(CsrGraph::Load(binaryPath).has_value());
+
+    DirectedListGraph graph;
+    graph.AddVertices(3);
+    graph.AddDirectedEdgesBulk({{{0, 1}, 1}, {{1, 2}, 2}});
+    ASSERT_TRUE(CsrGraph::Save(binaryPath, graph));
+    std::filesystem::resize_file(binaryPath, std::filesystem::file_size(binaryPath) - 4);
+    EXPECT_FALSE(CsrGraph::Load(binaryPath).has_value());
+
+    ASSERT_TRUE(CsrGraph::Save(binaryPath, graph));
+    {
+        std::fstream file(binaryPath, std::ios::binary | std::ios::in | std::ios::out);
+        const Graph::Neighbour neighbour {3, 2};                   // Wierzchołek spoza grafu
+        file.seekp(-static_cast<std::streamoff>(sizeof(neighbour)), std::ios::end);
+        file.write(reinterpret_cast<const char*>(&neighbour), sizeof(neighbour));
+    }
+    EXPECT_FALSE(CsrGraph::Load(binaryPath, CsrGraph::LoadPolicy::VALIDATE_NEIGHBOURS).has_value());
+    EXPECT_TRUE(CsrGraph::Load(binaryPath).has_value());               // Sąsiedzi nie są sprawdzani
+}
@@ -224,4 +224,70 @@ TEST_F(DirectedListGraphTest, DoesExistTest)
     EXPECT_TRUE(graph.DoesExist({3, 1}));
     EXPECT_FALSE(graph.DoesExist({1, 1}));
     EXPECT_FALSE(graph.DoesExist({5, 1}));
+}
+
+TEST_F(DirectedListGraphTest, RangesTest)
+{
+    graph.AddVertex();
+    graph.AddVertex();
+    graph.AddVertex();
+    graph.AddVertex();
+    graph.AddVertex();
+
+    graph.AddDirectedEdge({{0, 1}, 1});
+    graph.AddDirectedEdge({{4, 0}, 2});
+    graph.AddDirectedEdge({{3, 1}, 3});
+    graph.AddDirectedEdge({{0, 3}, 4});
+
+    Vertex expectedVertex = 0;
+    for (auto vertex : graph.GetVertexRange())
+    {
+        EXPECT_EQ(vertex, expectedVertex++);
+    }
+    EXPECT_EQ(expectedVertex, graph.GetOrder());
+
+    for (auto vertex : graph.GetVertexRange())
+    {
+        auto expected = graph.GetNeighboursOf(vertex).value();
+        size_t i = 0;
+        for (auto neighbour : graph.GetNeighbourRangeOf(vertex))
+        {
+            ASSERT_LT(i, expected.Size());
+            EXPECT_EQ(neighbour.vertex, expected[i].vertex);
+            EXPECT_EQ(neighbour.weight, expected[i].weight);
+            i++;
+        }
+        EXPECT_EQ(i, expected.Size());
+    }
+
+    EXPECT_TRUE(graph.GetNeighbourRangeOf(5).IsEmpty());
+}
+
+TEST_F(DirectedListGraphTest, AddDirectedEdgesBulkTest)
+{
+    graph.AddVertices(5);
+    ASSERT_EQ(graph.GetOrder(), 5);
+
+    DirectedEdges edges = {DirectedEdgeData {DirectedEdge{0, 1}, Weight{1}},
+                   DirectedEdgeData {DirectedEdge{4, 0}, Weight{2}},
+                   DirectedEdgeData {DirectedEdge{1, 0}, Weight{5}},
+                   DirectedEdgeData {DirectedEdge{0, 1}, Weight{6}},
+                   DirectedEdgeData {DirectedEdge{3, 3}, Weight{1}},
+                   DirectedEdgeData {DirectedEdge{3, 5}, Weight{1}},
+                   DirectedEdgeData {DirectedEdge{3, 1}, Weight{3}}};
+
+    EXPECT_EQ(graph.AddDirectedEdgesBulk(edges), 4);
+    ASSERT_EQ(graph.GetSize(), 4);
+
+    DirectedEdges expectedEdges = {DirectedEdgeData {DirectedEdge{0, 1}, Weight{1}},
+                           DirectedEdgeData {DirectedEdge{4, 0}, Weight{2}},
+                           DirectedEdgeData {DirectedEdge{1, 0}, Weight{5}},
+                           DirectedEdgeData {DirectedEdge{3, 1}, Weight{3}}};
+
+    EXPECT_TRUE(CompareDirectedEdges(expectedEdges, graph.GetDirectedEdges()));
+
+    EXPECT_EQ(graph.AddDirectedEdgesBulk({DirectedEdgeData {DirectedEdge{3, 1}, Weight{7}}, DirectedEdgeData {DirectedEdge{1, 3}, Weight{7}}}), 1);
+    EXPECT_EQ(graph.GetSize(), 5);
+    EXPECT_EQ(graph.GetWeight({3, 1}), 3);
+    EXPECT_EQ(graph.GetWeight({1, 3}), 7);
 }
\ No newline at end of file
@@ -2,6 +2,8 @@
 
 #include "Algorithms/Graphs/DirectedGraphs/DirectedMatrixGraph.h"
 
+#include <sstream>
+
 using Vertex           = DirectedMatrixGraph::Vertex;
 using DirectedEdge     = DirectedMatrixGraph::DirectedEdge;
 using DirectedEdgeData = DirectedMatrixGraph::DirectedEdgeData;
@@ -224,4 +226,100 @@ TEST_F(DirectedMatrixGraphTest, DoesExistTest)
     EXPECT_TRUE(graph.DoesExist({3, 1}));
     EXPECT_FALSE(graph.DoesExist({1, 1}));
     EXPECT_FALSE(graph.DoesExist({5, 1}));
+}
+
+TEST_F(DirectedMatrixGraphTest, RangesTest)
+{
+    graph.AddVertex();
+    graph.AddVertex();
+    graph.AddVertex();
+    graph.AddVertex();
+    graph.AddVertex();
+
+    graph.AddDirectedEdge({{0, 1}, 1});
+    graph.AddDirectedEdge({{4, 0}, 2});
+    graph.AddDirectedEdge({{3, 1}, 3});
+    graph.AddDirectedEdge({{0, 3}, 4});
+
+    Vertex expectedVertex = 0;
+    for (auto vertex : graph.GetVertexRange())
+    {
+        EXPECT_EQ(vertex, expectedVertex++);
+    }
+    EXPECT_EQ(expectedVertex, graph.GetOrder());
+
+    for (auto vertex : graph.GetVertexRange())
+    {
+        auto expected = graph.GetNeighboursOf(vertex).value();
+        size_t i = 0;
+        for (auto neighbour : graph.GetNeighbourRangeOf(vertex))
+        {
+            ASSERT_LT(i, expected.Size());
+            EXPECT_EQ(neighbour.vertex, expected[i].vertex);
+            EXPECT_EQ(neighbour.weight, expected[i].weight);
+            i++;
+        }
+        EXPECT_EQ(i, expected.Size());
+    }
+
+    EXPECT_TRUE(graph.GetNeighbourRangeOf(5).IsEmpty());
+}
+
+TEST_F(DirectedMatrixGraphTest, AddDirectedEdgesBulkTest)
+{
+    graph.AddVertices(5);
+    ASSERT_EQ(graph.GetOrder(), 5);
+
+    DirectedEdges edges = {DirectedEdgeData {DirectedEdge{0, 1}, Weight{1}},
+                   DirectedEdgeData {DirectedEdge{4, 0}, Weight{2}},
+                   DirectedEdgeData {DirectedEdge{1, 0}, Weight{5}},
+                   DirectedEdgeData {DirectedEdge{0, 1}, Weight{6}},
+                   DirectedEdgeData {DirectedEdge{3, 3}, Weight{1}},
+                   DirectedEdgeData {DirectedEdge{3, 5}, Weight{1}},
+                   DirectedEdgeData {DirectedEdge{3, 1}, Weight{3}}};
+
+    EXPECT_EQ(graph.AddDirectedEdgesBulk(edges), 4);
+    ASSERT_EQ(graph.GetSize(), 4);
+
+    DirectedEdges expectedEdges = {DirectedEdgeData {DirectedEdge{0, 1}, Weight{1}},
+                           DirectedEdgeData {DirectedEdge{4, 0}, Weight{2}},
+                           DirectedEdgeData {DirectedEdge{1, 0}, Weight{5}},
+                           DirectedEdgeData {DirectedEdge{3, 1}, Weight{3}}};
+
+    EXPECT_TRUE(CompareDirectedEdges(expectedEdges, graph.GetDirectedEdges()));
+
+    EXPECT_EQ(graph.AddDirectedEdgesBulk({DirectedEdgeData {DirectedEdge{3, 1}, Weight{7}}, DirectedEdgeData {DirectedEdge{1, 3}, Weight{7}}}), 1);
+    EXPECT_EQ(graph.GetSize(), 5);
+    EXPECT_EQ(graph.GetWeight({3, 1}), 3);
+    EXPECT_EQ(graph.GetWeight({1, 3}), 7);
+}
+
+TEST_F(DirectedMatrixGraphTest, StreamTest)
+{
+    graph.AddVertices(4);
+    graph.AddDirectedEdgesBulk({DirectedEdgeData {DirectedEdge{0, 1}, Weight{1}}, DirectedEdgeData {DirectedEdge{3, 2}, Weight{4}}});
+
+    std::stringstream stream;
+    stream << graph;
+    DirectedMatrixGraph read;
+    stream >> read;
+    EXPECT_EQ(read.GetOrder(), 4);
+    EXPECT_EQ(read.GetSize(), 2);
+    EXPECT_EQ(read.GetWeight({3, 2}), 4);
+
+    std::stringstream truncated("18446744073709551615 4000000000\n0 1 1\n");
+    DirectedMatrixGraph empty;
+    truncated >> empty;
+    EXPECT_TRUE(truncated.fail());
+    EXPECT_EQ(empty.GetOrder(), 0);
+
+    std::stringstream hugeOrder("0 4000000000\n");
+    hugeOrder >> empty;
+    EXPECT_TRUE(hugeOrder.fail());
+    EXPECT_EQ(empty.GetOrder(), 0);
+
+    std::stringstream outOfRange("1 3\n0 3 1\n");
+    outOfRange >> empty;
+    EXPECT_TRUE(outOfRange.fail());
+    EXPECT_EQ(empty.GetOrder(), 0);
 }
\ No newline at end of file
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include "Algorithms/Graphs/GraphParser.h"
+#include "Algorithms/Graphs/DirectedGraphs/DirectedListGraph.h"
+#include "Algorithms/Graphs/UndirectedGraphs/MatrixGraph.h"
+
+#include <filesystem>
+#include <fstream>
+
+class GraphParserTest : public testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        std::filesystem::remove(path);
+    }
+
+    static std::optional<GraphParser::ParsedGraph> Parse(const std::string& text,
+                                                        GraphParser::Format format,
+                                                        uint32_t numberOfThreads = 1)
+    {
+        return GraphParser::Parse(text.data(), text.data() + text.size(), format, numberOfThreads);
+    }
+
+    static void ExpectEdges(const GraphParser::ParsedGraph& graph,
+                            const DynamicArray<DirectedGraph::DirectedEdgeData>& expected)
+    {
+        ASSERT_EQ(graph.edges.Size(), expected.Size());
+        for (size_t i = 0; i < expected.Size(); i++)
+        {
+            EXPECT_EQ(graph.edges[i].vertices.first, expected[i].vertices.first);
+            EXPECT_EQ(graph.edges[i].vertices.second, expected[i].vertices.second);
+            EXPECT_EQ(graph.edges[i].weight, expected[i].weight);
+        }
+    }
+
+    const std::string path = (std::filesystem::temp_directory_path() / "GraphParserTest.txt").string();
+};
+
+TEST_F(GraphParserTest, NativeTest)
+{
+    auto graph = Parse("3 4\n0 1 5\r\n2 3 7\n\n1 0 2", GraphParser::Format::NATIVE);
+
+    ASSERT_TRUE(graph.has_value());
+    EXPECT_EQ(graph->order, 4);
+    ExpectEdges(*graph, {{{0, 1}, 5}, {{2, 3}, 7}, {{1, 0}, 2}});
+
+    EXPECT_FALSE(Parse("3 4\n0 1 5\n2 3 7\n", GraphParser::Format::NATIVE).has_value());
+    EXPECT_FALSE(Parse("2 4\n0 1 5\n2 x 7\n", GraphParser::Format::NATIVE).has_value());
+    EXPECT_FALSE(Parse("1 4\n0 1 5 6\n", GraphParser::Format::NATIVE).has_value());
+}
+
+TEST_F(GraphParserTest, DimacsTest)
+{
+    auto graph = Parse("c comment\np sp 3 2\nc another comment\na 1 2 10\na 3 1 4\n", GraphParser::Format::DIMACS);
+
+    ASSERT_TRUE(graph.has_value());
+    EXPECT_EQ(graph->order, 3);
+    ExpectEdges(*graph, {{{0, 1}, 10}, {{2, 0}, 4}});
+
+    EXPECT_FALSE(Parse("a 1 2 10\n", GraphParser::Format::DIMACS).has_value());
+    EXPECT_FALSE(Parse("p sp 3 1\na 0 2 10\n", GraphParser::Format::DIMACS).has_value());
+}
+
+TEST_F(GraphParserTest, EdgeListTest)
+{
+    auto graph = Parse("# comment\n0 1\n% comment\n5 2 3\n", GraphParser::Format::EDGE_LIST);
+
+    ASSERT_TRUE(graph.has_value());
+    EXPECT_EQ(graph->order, 6);
+    ExpectEdges(*graph, {{{0, 1}, 1}, {{5, 2}, 3}});
+
+    EXPECT_FALSE(Parse("0\n", GraphParser::Format::EDGE_LIST).has_value());
+}
+
+TEST_F(GraphParserTest, MultithreadedTest)
+{
+    std::string text = "1000 100\n";
+    for (uint32_t i = 0; i < 1000; i++)
+    {
+        text += std::to_string(i % 100) + " " + std::to_string((i * 7) % 100) + " " + std::to_string(i) + "\n";
+    }
+
+    auto expected = Parse(text, GraphParser::Format::NATIVE);
+    ASSERT_TRUE(expected.has_value());
+
+    for (uint32_t numberOfThreads : {2u, 3u, 8u, 64u})
+    {
+        auto graph = Parse(text, GraphParser::Format::NATIVE, numberOfThreads);
+        ASSERT_TRUE(graph.has_value());
+        EXPECT_EQ(graph->order, expected->order);
+        ExpectEdges(*graph, expected->edges);
+    }
+
+    text += "1 2\n";
+    EXPECT_FALSE(Parse(text, GraphParser::Format::NATIVE, 4).has_value());
+}
+
+TEST_F(GraphParserTest, LoadGraphTest)
+{
+    std::ofstream(path) << "4 3\n0 1 1\n1 0 1\n1 2 3\n0 0 2\n";
+
+    auto directedGraph = GraphParser::LoadGraph<DirectedListGraph>(path, GraphParser::Format::NATIVE, 2);
+    ASSERT_TRUE(directedGraph.has_value());
+    EXPECT_EQ(directedGraph->GetOrder(), 3);
+    EXPECT_EQ(directedGraph->GetSize(), 3);
+
+    auto undirectedGraph = GraphParser::LoadGraph<MatrixGraph>(path, GraphParser::Format::NATIVE, 2);
+    ASSERT_TRUE(undirectedGraph.has_value());
+    EXPECT_EQ(undirectedGraph->GetOrder(), 3);
+    EXPECT_EQ(undirectedGraph->GetSize(), 2);
+
+    EXPECT_FALSE(GraphParser::LoadGraph<MatrixGraph>(path + ".missing", GraphParser::Format::NATIVE).has_value());
+    EXPECT_EQ(GraphParser::DetectFormat("graph.gr"), GraphParser::Format::DIMACS);
+    EXPECT_EQ(GraphParser::DetectFormat("graph.el"), GraphParser::Format::EDGE_LIST);
+    EXPECT_EQ(GraphParser::DetectFormat("graph.txt"), GraphParser::Format::NATIVE);
+}
@@ -2,6 +2,8 @@
 
 #include "Algorithms/Graphs/UndirectedGraphs/MatrixGraph.h"
 
+#include <sstream>
+
 using Vertex   = MatrixGraph::Vertex;
 using Edge     = MatrixGraph::Edge;
 using EdgeData = MatrixGraph::EdgeData;
@@ -222,4 +224,98 @@ TEST_F(MatrixGraphTest, DoesExistTest)
     EXPECT_TRUE(graph.DoesExist({3, 1}));
     EXPECT_FALSE(graph.DoesExist({1, 1}));
     EXPECT_FALSE(graph.DoesExist({5, 1}));
+}
+
+TEST_F(MatrixGraphTest, RangesTest)
+{
+    graph.AddVertex();
+    graph.AddVertex();
+    graph.AddVertex();
+    graph.AddVertex();
+    graph.AddVertex();
+
+    graph.AddEdge({{0, 1}, 1});
+    graph.AddEdge({{4, 0}, 2});
+    graph.AddEdge({{3, 1}, 3});
+    graph.AddEdge({{0, 3}, 4});
+
+    Vertex expectedVertex = 0;
+    for (auto vertex : graph.GetVertexRange())
+    {
+        EXPECT_EQ(vertex, expectedVertex++);
+    }
+    EXPECT_EQ(expectedVertex, graph.GetOrder());
+
+    for (auto vertex : graph.GetVertexRange())
+    {
+        auto expected = graph.GetNeighboursOf(vertex).value();
+        size_t i = 0;
+        for (auto neighbour : graph.GetNeighbourRangeOf(vertex))
+        {
+            ASSERT_LT(i, expected.Size());
+            EXPECT_EQ(neighbour.vertex, expected[i].vertex);
+            EXPECT_EQ(neighbour.weight, expected[i].weight);
+            i++;
+        }
+        EXPECT_EQ(i, expected.Size());
+    }
+
+    EXPECT_TRUE(graph.GetNeighbourRangeOf(5).IsEmpty());
+}
+
+TEST_F(MatrixGraphTest, AddEdgesBulkTest)
+{
+    graph.AddVertices(5);
+    ASSERT_EQ(graph.GetOrder(), 5);
+
+    Edges edges = {EdgeData {Edge{0, 1}, Weight{1}},
+                   EdgeData {Edge{4, 0}, Weight{2}},
+                   EdgeData {Edge{1, 0}, Weight{5}},
+                   EdgeData {Edge{3, 3}, Weight{1}},
+                   EdgeData {Edge{3, 5}, Weight{1}},
+                   EdgeData {Edge{3, 1}, Weight{3}}};
+
+    EXPECT_EQ(graph.AddEdgesBulk(edges), 3);
+    ASSERT_EQ(graph.GetSize(), 3);
+
+    Edges expectedEdges = {EdgeData {Edge{0, 1}, Weight{1}},
+                           EdgeData {Edge{0, 4}, Weight{2}},
+                           EdgeData {Edge{3, 1}, Weight{3}}};
+
+    EXPECT_TRUE(CompareEdges(expectedEdges, graph.GetEdges()));
+
+    EXPECT_EQ(graph.AddEdgesBulk({EdgeData {Edge{1, 3}, Weight{7}}, EdgeData {Edge{2, 4}, Weight{7}}}), 1);
+    EXPECT_EQ(graph.GetSize(), 4);
+    EXPECT_EQ(graph.GetWeight({1, 3}), 3);
+    EXPECT_EQ(graph.GetWeight({4, 2}), 7);
+}
+
+TEST_F(MatrixGraphTest, StreamTest)
+{
+    graph.AddVertices(4);
+    graph.AddEdgesBulk({EdgeData {Edge{0, 1}, Weight{1}}, EdgeData {Edge{3, 2}, Weight{4}}});
+
+    std::stringstream stream;
+    stream << graph;
+    MatrixGraph read;
+    stream >> read;
+    EXPECT_EQ(read.GetOrder(), 4);
+    EXPECT_EQ(read.GetSize(), 2);
+    EXPECT_EQ(read.GetWeight({3, 2}), 4);
+
+    std::stringstream truncated("18446744073709551615 4000000000\n0 1 1\n");
+    MatrixGraph empty;
+    truncated >> empty;
+    EXPECT_TRUE(truncated.fail());
+    EXPECT_EQ(empty.GetOrder(), 0);
+
+    std::stringstream hugeOrder("0 4000000000\n");
+    hugeOrder >> empty;
+    EXPECT_TRUE(hugeOrder.fail());
+    EXPECT_EQ(empty.GetOrder(), 0);
+
+    std::stringstream outOfRange("1 3\n0 3 1\n");
+    outOfRange >> empty;
+    EXPECT_TRUE(outOfRange.fail());
+    EXPECT_EQ(empty.GetOrder(), 0);
 }
\ No newline at end of file
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include "Algorithms/MST/Boruvka.h"
+#include "Algorithms/MST/Kruskal.h"
+#include "Algorithms/Graphs/UndirectedGraphs/ListGraph.h"
+
+namespace
+{
+
+ListGraph GenerateGraph(uint32_t order, uint32_t numberOfEdges, uint32_t maxWeight)
+{
+    ListGraph graph;
+    graph.AddVertices(order);
+
+    DynamicArray<UndirectedGraph::EdgeData> edges(numberOfEdges + order - 1);
+    for (uint32_t i = 1; i < order; i++)
+    {
+        edges[i - 1] = {{i - 1, i}, maxWeight};
+    }
+
+    uint32_t seed = 12345;
+    for (uint32_t i = 0; i < numberOfEdges; i++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        auto first = (seed >> 8u) % order;
+        seed = seed * 1103515245u + 12345u;
+        auto second = (seed >> 8u) % order;
+        edges[order - 1 + i] = {{first, second}, 1 + (seed >> 16u) % maxWeight};
+    }
+    graph.AddEdgesBulk(edges);
+
+    return graph;
+}
+
+}
+
+TEST(BoruvkaTest, SameWeightAsKruskal)
+{
+    for (uint32_t maxWeight : {1u, 5u, 1000u})
+    {
+        auto graph = GenerateGraph(300, 2000, maxWeight);
+        auto expected = MST::Kruskal::FindMstOf(graph);
+
+        for (uint32_t numberOfThreads : {1u, 2u, 4u, 7u})
+        {
+            auto result = MST::Boruvka::FindMstOf(graph, numberOfThreads);
+            EXPECT_EQ(result.edges.Size(), 299);
+            EXPECT_EQ(result.weight, expected.weight);
+        }
+    }
+}
+
+TEST(BoruvkaTest, MstDoesNotExists)
+{
+    auto graph = GenerateGraph(50, 100, 10);
+    graph.AddVertex();
+
+    auto result = MST::Boruvka::FindMstOf(graph, 4);
+    EXPECT_EQ(result.edges.Size(), 0);
+    EXPECT_EQ(result.weight, 0);
+
+    EXPECT_EQ(MST::Boruvka::FindMstOf(ListGraph()).edges.Size(), 0);
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include "Algorithms/MST/ConcurrentDSU.h"
+#include "Algorithms/MST/DSU.h"
+#include "Utils/Parallel.h"
+
+TEST(DSUTest, UnionFindTest)
+{
+    DSU forest(6);
+
+    EXPECT_TRUE(forest.Union(0, 1));
+    EXPECT_TRUE(forest.Union(2, 3));
+    EXPECT_FALSE(forest.Union(1, 0));
+    EXPECT_TRUE(forest.Union(1, 3));
+
+    EXPECT_EQ(forest.Find(0), forest.Find(3));
+    EXPECT_NE(forest.Find(0), forest.Find(4));
+    EXPECT_EQ(forest.GetSizeOf(2), 4);
+    EXPECT_EQ(forest.GetSizeOf(5), 1);
+
+    EXPECT_EQ(forest.Find(10), 10);
+    EXPECT_FALSE(forest.Union(0, 10));
+}
+
+TEST(DSUTest, DeepChainTest)
+{
+    constexpr uint32_t numberOfVertices = 1'000'000;
+    DSU forest(numberOfVertices);
+
+    for (uint32_t i = 1; i < numberOfVertices; i++)
+    {
+        EXPECT_TRUE(forest.Union(i, i - 1));
+    }
+
+    auto root = forest.Find(0);
+    EXPECT_EQ(forest.Find(numberOfVertices - 1), root);
+    EXPECT_EQ(forest.GetSizeOf(numberOfVertices / 2), numberOfVertices);
+}
+
+TEST(DSUTest, ResetTest)
+{
+    DSU forest(4);
+    forest.Union(0, 1);
+    forest.Union(2, 3);
+
+    forest.Reset(3);
+    EXPECT_EQ(forest.GetNumberOfVertices(), 3);
+    EXPECT_NE(forest.Find(0), forest.Find(1));
+    EXPECT_EQ(forest.Find(3), 3);
+
+    forest.Reset(8);
+    EXPECT_EQ(forest.GetNumberOfVertices(), 8);
+    EXPECT_TRUE(forest.Union(6, 7));
+    EXPECT_EQ(forest.GetSizeOf(7), 2);
+}
+
+TEST(DSUTest, ConcurrentUnionTest)
+{
+    constexpr uint32_t numberOfVertices = 100'000;
+    constexpr uint32_t numberOfThreads = 4;
+    ConcurrentDSU forest(numberOfVertices);
+    DynamicArray<uint32_t> merges(numberOfThreads, 0);
+
+    Utils::ParallelFor(numberOfThreads, [&forest, &merges](uint32_t thread) {
+        for (uint32_t i = 1; i < numberOfVertices; i++)
+        {
+            auto vertex = (i * (thread + 1)) % numberOfVertices;
+            if (vertex % 10 != 0 && forest.Union(vertex, vertex - 1))
+            {
+                merges[thread]++;
+            }
+        }
+    });
+
+    uint32_t numberOfMerges = 0;
+    for (auto threadMerges : merges)
+    {
+        numberOfMerges += threadMerges;
+    }
+
+    EXPECT_EQ(numberOfMerges, numberOfVertices - numberOfVertices / 10);
+    EXPECT_TRUE(forest.AreConnected(1, 9));
+    EXPECT_FALSE(forest.AreConnected(9, 10));
+    EXPECT_EQ(forest.Find(19), forest.Find(10));
+}
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include "Algorithms/MST/DynamicMst.h"
+#include "Algorithms/MST/Kruskal.h"
+#include "Algorithms/Graphs/UndirectedGraphs/ListGraph.h"
+
+TEST(DynamicMstTest, InsertDeleteTest)
+{
+    MST::DynamicMst mst(4);
+
+    EXPECT_TRUE(mst.InsertEdge({{0, 1}, 5}));
+    EXPECT_TRUE(mst.InsertEdge({{1, 2}, 3}));
+    EXPECT_FALSE(mst.InsertEdge({{2, 1}, 1}));
+    EXPECT_FALSE(mst.InsertEdge({{3, 3}, 1}));
+    EXPECT_FALSE(mst.InsertEdge({{3, 4}, 1}));
+    EXPECT_EQ(mst.GetMst().edges.Size(), 0);
+
+    EXPECT_TRUE(mst.InsertEdge({{2, 3}, 4}));
+    EXPECT_EQ(mst.GetMst().weight, 12);
+
+    EXPECT_TRUE(mst.InsertEdge({{0, 3}, 1}));
+    EXPECT_EQ(mst.GetNumberOfTreeEdges(), 3);
+    EXPECT_EQ(mst.GetWeight(), 8);
+
+    EXPECT_TRUE(mst.DeleteEdge({3, 0}));
+    EXPECT_FALSE(mst.DeleteEdge({3, 0}));
+    EXPECT_EQ(mst.GetWeight(), 12);
+
+    EXPECT_TRUE(mst.UpdateWeight({1, 0}, 10));
+    EXPECT_EQ(mst.GetWeight(), 17);
+    EXPECT_TRUE(mst.DeleteEdge({1, 2}));
+    EXPECT_EQ(mst.GetNumberOfTreeEdges(), 2);
+    EXPECT_EQ(mst.GetMst().edges.Size(), 0);
+}
+
+TEST(DynamicMstTest, SameWeightAsKruskal)
+{
+    constexpr uint32_t order = 30;
+    ListGraph graph;
+    graph.AddVertices(order);
+    MST::DynamicMst mst(order);
+
+    uint32_t seed = 2024;
+    auto next = [&seed](uint32_t bound) {
+        seed = seed * 1103515245u + 12345u;
+        return (seed >> 8u) % bound;
+    };
+
+    for (uint32_t i = 0; i < 3000; i++)
+    {
+        UndirectedGraph::Edge edge = {next(order), next(order)};
+        auto weight = 1 + next(20);
+
+        switch (next(4))
+        {
+        case 0:
+        case 1:
+            EXPECT_EQ(mst.InsertEdge({edge, weight}), graph.AddEdge({edge, weight}));
+            break;
+        case 2:
+            EXPECT_EQ(mst.DeleteEdge(edge), graph.RemoveEdge(edge));
+            break;
+        default:
+            EXPECT_EQ(mst.UpdateWeight(edge, weight), graph.SetWeight(edge, weight));
+            break;
+        }
+
+        ASSERT_EQ(mst.GetSize(), graph.GetSize());
+        auto expected = MST::Kruskal::FindMstOf(graph);
+        auto result = mst.GetMst();
+        ASSERT_EQ(result.edges.Size(), expected.edges.Size());
+        ASSERT_EQ(result.weight, expected.weight);
+    }
+
+    MST::DynamicMst copy(graph);
+    EXPECT_EQ(copy.GetMst().weight, mst.GetMst().weight);
+}
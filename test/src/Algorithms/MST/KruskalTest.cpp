@@ -33,7 +33,6 @@ TEST(KruskalTest, MstExists)
         {{8, 9}, 3}
     };
 
-    EXPECT_CALL(graph, GetVertices).WillOnce(Return(vertices));
     EXPECT_CALL(graph, GetEdges).WillOnce(Return(edges));
     EXPECT_CALL(graph, GetOrder).WillRepeatedly(Return(vertices.Size()));
     EXPECT_CALL(graph, GetSize).WillRepeatedly(Return(edges.Size()));
@@ -71,7 +70,6 @@ TEST(KruskalTest, MstDoesNotExists)
         {{8, 9}, 3}
     };
 
-    EXPECT_CALL(graph, GetVertices).WillOnce(Return(vertices));
     EXPECT_CALL(graph, GetEdges).WillOnce(Return(edges));
     EXPECT_CALL(graph, GetOrder).WillRepeatedly(Return(vertices.Size()));
     EXPECT_CALL(graph, GetSize).WillRepeatedly(Return(edges.Size()));
@@ -80,3 +78,80 @@ TEST(KruskalTest, MstDoesNotExists)
     EXPECT_EQ(result.edges.Size(), 0);
     EXPECT_EQ(result.weight, 0);
 }
+
+TEST(KruskalTest, FilteringGivesSameResult)
+{
+    UndirectedGraphMock graph;
+
+    constexpr uint32_t order = 200;
+    DynamicArray<UndirectedGraph::EdgeData> edges(order * 10);
+    for (uint32_t i = 0; i < edges.Size(); i++)
+    {
+        auto first = i % order;
+        auto second = (i * 7919u + 13u) % order;
+        edges[i] = {{first, second}, 1 + (i * 2654435761u) % 50u};
+    }
+    for (uint32_t i = 1; i < order; i++)
+    {
+        edges[i - 1] = {{i - 1, i}, 100};
+    }
+
+    EXPECT_CALL(graph, GetEdges).WillRepeatedly(Return(edges));
+    EXPECT_CALL(graph, GetOrder).WillRepeatedly(Return(order));
+    EXPECT_CALL(graph, GetSize).WillRepeatedly(Return(edges.Size()));
+
+    auto expected = MST::Kruskal::FindMstOf(graph);
+    auto result = MST::Kruskal::FindMstWithFilteringOf(graph);
+    EXPECT_EQ(result.edges.Size(), order - 1);
+    EXPECT_EQ(result.weight, expected.weight);
+}
+
+TEST(KruskalTest, FilteringMstDoesNotExists)
+{
+    UndirectedGraphMock graph;
+
+    DynamicArray<UndirectedGraph::EdgeData> edges = {
+        {{0, 1}, 3},
+        {{0, 2}, 6},
+        {{1, 2}, 4},
+        {{1, 2}, 2},
+        {{2, 0}, 1},
+        {{3, 4}, 5}
+    };
+
+    EXPECT_CALL(graph, GetEdges).WillOnce(Return(edges));
+    EXPECT_CALL(graph, GetOrder).WillRepeatedly(Return(5));
+    EXPECT_CALL(graph, GetSize).WillRepeatedly(Return(edges.Size()));
+
+    auto result = MST::Kruskal::FindMstWithFilteringOf(graph);
+    EXPECT_EQ(result.edges.Size(), 0);
+    EXPECT_EQ(result.weight, 0);
+}
+
+TEST(KruskalTest, SpanningForest)
+{
+    UndirectedGraphMock graph;
+
+    DynamicArray<UndirectedGraph::EdgeData> edges = {
+        {{0, 1}, 3},
+        {{3, 4}, 5},
+        {{0, 2}, 6},
+        {{1, 2}, 4},
+        {{2, 0}, 1},
+        {{4, 6}, 2}
+    };
+
+    EXPECT_CALL(graph, GetEdges).WillOnce(Return(edges));
+    EXPECT_CALL(graph, GetOrder).WillRepeatedly(Return(7));
+    EXPECT_CALL(graph, GetSize).WillRepeatedly(Return(edges.Size()));
+
+    auto forest = MST::Kruskal::FindMsfOf(graph);
+    ASSERT_EQ(forest.trees.Size(), 3);
+    EXPECT_EQ(forest.weight, 11);
+    EXPECT_EQ(forest.trees[0].edges.Size(), 2);
+    EXPECT_EQ(forest.trees[0].weight, 4);
+    EXPECT_EQ(forest.trees[1].edges.Size(), 2);
+    EXPECT_EQ(forest.trees[1].weight, 7);
+    EXPECT_EQ(forest.trees[2].edges.Size(), 0);
+    EXPECT_EQ(forest.trees[2].weight, 0);
+}
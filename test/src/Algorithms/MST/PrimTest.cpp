@@ -2,6 +2,8 @@
 
 #include "Algorithms/MST/Prim.h"
 #include "Algorithms/Graphs/UndirectedGraphs/ListGraph.h"
+#include "Algorithms/Graphs/UndirectedGraphs/MatrixGraph.h"
+#include "Algorithms/Graphs/UndirectedGraphs/UndirectedGraphConverter.h"
 
 ListGraph GenerateListGraph()
 {
@@ -53,3 +55,57 @@ TEST(PrimTest, MstDoesNotExists)
     EXPECT_EQ(result.edges.Size(), 0);
     EXPECT_EQ(result.weight, 0);
 }
+
+TEST(PrimTest, VirtualDispatchGivesSameResult)
+{
+    auto graph = GenerateListGraph();
+    const UndirectedGraph& base = graph;
+
+    auto result = MST::Prim::FindMstOf(base);
+    EXPECT_EQ(result.edges.Size(), 9);
+    EXPECT_EQ(result.weight, 38);
+}
+
+TEST(PrimTest, ArrayAndHeapVariantsGiveSameResult)
+{
+    auto listGraph = GenerateListGraph();
+    auto matrixGraph = UndirectedGraphConverter::convert<MatrixGraph>(listGraph);
+
+    auto arrayResult = MST::Prim::FindMstWithArrayOf(listGraph);
+    auto heapResult = MST::Prim::FindMstWithHeapOf(listGraph);
+    EXPECT_EQ(arrayResult.weight, 38);
+    EXPECT_EQ(heapResult.weight, 38);
+    EXPECT_EQ(heapResult.edges.Size(), 9);
+
+    EXPECT_EQ(MST::Prim::FindMstWithArrayOf(matrixGraph).weight, 38);
+    EXPECT_EQ(MST::Prim::FindMstWithHeapOf(matrixGraph).weight, 38);
+
+    for (const auto& edge : heapResult.edges)
+    {
+        EXPECT_EQ(listGraph.GetWeight(edge.vertices), edge.weight);
+    }
+
+    listGraph.AddVertex();
+    EXPECT_EQ(MST::Prim::FindMstWithHeapOf(listGraph).edges.Size(), 0);
+}
+
+TEST(PrimTest, SpanningForest)
+{
+    auto graph = GenerateListGraph();
+    graph.AddVertex();
+    graph.AddVertex();
+    graph.AddVertex();
+    graph.AddEdge({{10, 12}, 7});
+
+    auto forest = MST::Prim::FindMsfOf(graph);
+    ASSERT_EQ(forest.trees.Size(), 3);
+    EXPECT_EQ(forest.weight, 45);
+    EXPECT_EQ(forest.trees[0].edges.Size(), 9);
+    EXPECT_EQ(forest.trees[0].weight, 38);
+    EXPECT_EQ(forest.trees[1].edges.Size(), 1);
+    EXPECT_EQ(forest.trees[1].weight, 7);
+    EXPECT_EQ(forest.trees[2].edges.Size(), 0);
+
+    auto matrixForest = MST::Prim::FindMsfOf(UndirectedGraphConverter::convert<MatrixGraph>(graph));
+    EXPECT_EQ(matrixForest.weight, 45);
+}
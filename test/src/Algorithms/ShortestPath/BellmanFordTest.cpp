@@ -230,4 +230,20 @@ TEST_F(BellmanFordTest, ShortestPathForAll)
     ExpectStartingIn4();
     ExpectStartingIn5();
     ExpectStartingIn6();
+}
+
+TEST_F(BellmanFordTest, VirtualDispatchGivesSameResult)
+{
+    GenerateListGraph();
+    const DirectedGraph& base = graph;
+    for (Graph::Vertex from = 0; from < graph.GetOrder(); from++)
+    {
+        for (Graph::Vertex to = 0; to < graph.GetOrder(); to++)
+        {
+            auto expected = ShortestPath::BellmanFord::FindShortestPath(graph, from, to);
+            auto result = ShortestPath::BellmanFord::FindShortestPath(base, from, to);
+            EXPECT_EQ(result.weight, expected.weight);
+            EXPECT_EQ(result.path.Size(), expected.path.Size());
+        }
+    }
 }
\ No newline at end of file
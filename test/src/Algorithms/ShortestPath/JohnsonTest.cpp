@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include "Algorithms/ShortestPath/Johnson.h"
+#include "Algorithms/ShortestPath/Dijkstra.h"
+#include "Algorithms/Graphs/DirectedGraphs/DirectedListGraph.h"
+#include "Algorithms/Graphs/DirectedGraphs/DirectedMatrixGraph.h"
+
+namespace
+{
+
+template<typename T>
+T GenerateGraph()
+{
+    T graph;
+    graph.AddVertices(8);
+    graph.AddDirectedEdgesBulk({{{0, 1}, 4},
+                                {{0, 3}, 8},
+                                {{1, 2}, 8},
+                                {{1, 3}, 11},
+                                {{2, 4}, 2},
+                                {{2, 5}, 4},
+                                {{3, 4}, 7},
+                                {{3, 6}, 1},
+                                {{4, 6}, 6},
+                                {{5, 6}, 2},
+                                {{6, 0}, 3}});
+    return graph;
+}
+
+template<typename T>
+void ExpectSameAsDijkstra(const T& graph, const ShortestPath::Johnson::DistanceMatrix& matrix)
+{
+    ASSERT_EQ(matrix.order, graph.GetOrder());
+    for (Graph::Vertex from = 0; from < graph.GetOrder(); from++)
+    {
+        for (Graph::Vertex to = 0; to < graph.GetOrder(); to++)
+        {
+            auto expected = ShortestPath::Dijkstra::FindShortestPath(graph, from, to);
+            if (expected.path.Size() == 0)
+            {
+                EXPECT_EQ(matrix.GetDistance(from, to), ShortestPath::Johnson::DistanceMatrix::UNREACHABLE);
+            }
+            else
+            {
+                EXPECT_EQ(matrix.GetDistance(from, to), expected.weight);
+            }
+        }
+    }
+}
+
+}
+
+TEST(JohnsonTest, AllPairsTest)
+{
+    auto listGraph = GenerateGraph<DirectedListGraph>();
+    auto matrixGraph = GenerateGraph<DirectedMatrixGraph>();
+
+    for (uint32_t numberOfThreads : {1u, 2u, 4u, 16u})
+    {
+        ExpectSameAsDijkstra(listGraph, ShortestPath::Johnson::AllPairs(listGraph, numberOfThreads));
+        ExpectSameAsDijkstra(matrixGraph, ShortestPath::Johnson::AllPairs(matrixGraph, numberOfThreads));
+    }
+
+    auto matrix = ShortestPath::Johnson::AllPairs(listGraph);
+    EXPECT_EQ(matrix.GetDistance(0, 6), 9);
+    EXPECT_EQ(matrix.GetDistance(6, 2), 15);
+    EXPECT_EQ(matrix.GetDistance(3, 3), 0);
+    EXPECT_EQ(matrix.GetDistance(0, 7), ShortestPath::Johnson::DistanceMatrix::UNREACHABLE);
+}
+
+TEST(JohnsonTest, EmptyGraphTest)
+{
+    DirectedListGraph graph;
+    auto matrix = ShortestPath::Johnson::AllPairs(graph);
+    EXPECT_EQ(matrix.order, 0);
+    EXPECT_EQ(matrix.distances.Size(), 0);
+}
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+
+#include "Algorithms/ShortestPath/ShortestPathCache.h"
+#include "Algorithms/ShortestPath/Dijkstra.h"
+#include "Algorithms/Graphs/DirectedGraphs/DirectedListGraph.h"
+#include "Algorithms/Graphs/DirectedGraphs/DirectedMatrixGraph.h"
+
+class ShortestPathCacheTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        graph.AddVertices(7);
+        graph.AddDirectedEdgesBulk({{{0, 1}, 4},
+                                    {{0, 3}, 8},
+                                    {{1, 2}, 8},
+                                    {{1, 3}, 11},
+                                    {{2, 4}, 2},
+                                    {{2, 5}, 4},
+                                    {{3, 4}, 7},
+                                    {{3, 6}, 1},
+                                    {{4, 6}, 6},
+                                    {{5, 6}, 2}});
+    }
+
+    static void ExpectSameResults(const ShortestPath::Result& result, const ShortestPath::Result& expected)
+    {
+        EXPECT_EQ(result.weight, expected.weight);
+        ASSERT_EQ(result.path.Size(), expected.path.Size());
+        for (size_t i = 0; i < expected.path.Size(); i++)
+        {
+            EXPECT_EQ(result.path[i], expected.path[i]);
+        }
+    }
+
+    void ExpectSameAsDijkstra(ShortestPath::ShortestPathCache& cache)
+    {
+        for (Graph::Vertex from = 0; from < graph.GetOrder(); from++)
+        {
+            for (Graph::Vertex to = 0; to < graph.GetOrder(); to++)
+            {
+                ExpectSameResults(cache.FindShortestPath(from, to),
+                                  ShortestPath::Dijkstra::FindShortestPath(graph, from, to));
+            }
+        }
+    }
+
+    DirectedListGraph graph;
+};
+
+TEST_F(ShortestPathCacheTest, HitTest)
+{
+    ShortestPath::ShortestPathCache cache(graph);
+
+    ExpectSameAsDijkstra(cache);
+    EXPECT_EQ(cache.GetNumberOfTrees(), 7);
+    EXPECT_EQ(cache.GetNumberOfMisses(), 7);
+    EXPECT_EQ(cache.GetNumberOfHits(), 42);
+
+    ExpectSameResults(cache.FindShortestPath(0, 6), {{0, 3, 6}, 9});
+    EXPECT_EQ(cache.FindShortestPath(6, 0).path.Size(), 0);
+    EXPECT_EQ(cache.FindShortestPath(0, 7).path.Size(), 0);
+    EXPECT_EQ(cache.GetNumberOfMisses(), 7);
+}
+
+TEST_F(ShortestPathCacheTest, EvictionTest)
+{
+    ShortestPath::ShortestPathCache cache(graph, 400);
+    ASSERT_GT(cache.GetMemoryUsage(), 0);
+    EXPECT_LE(cache.GetMemoryUsage(), 400);
+
+    ExpectSameAsDijkstra(cache);
+    EXPECT_LT(cache.GetNumberOfTrees(), 7);
+    EXPECT_GT(cache.GetNumberOfTrees(), 0);
+    EXPECT_LE(cache.GetMemoryUsage(), 400);
+
+    [[maybe_unused]] auto result = cache.FindShortestPath(6, 0);
+    auto misses = cache.GetNumberOfMisses();
+    result = cache.FindShortestPath(6, 1);
+    EXPECT_EQ(cache.GetNumberOfMisses(), misses);
+    result = cache.FindShortestPath(0, 1);
+    EXPECT_EQ(cache.GetNumberOfMisses(), misses + 1);
+
+    ShortestPath::ShortestPathCache emptyCache(graph, 0);
+    ExpectSameAsDijkstra(emptyCache);
+    EXPECT_EQ(emptyCache.GetNumberOfTrees(), 0);
+    EXPECT_EQ(emptyCache.GetNumberOfHits(), 0);
+}
+
+TEST_F(ShortestPathCacheTest, InvalidationTest)
+{
+    ShortestPath::ShortestPathCache cache(graph);
+    ExpectSameResults(cache.FindShortestPath(0, 6), {{0, 3, 6}, 9});
+
+    auto version = graph.GetVersion();
+    ASSERT_TRUE(graph.SetWeight({3, 6}, 20));
+    EXPECT_NE(graph.GetVersion(), version);
+    ExpectSameResults(cache.FindShortestPath(0, 6), {{0, 1, 2, 5, 6}, 18});
+    EXPECT_EQ(cache.GetNumberOfMisses(), 2);
+
+    ASSERT_TRUE(graph.AddDirectedEdge({{0, 6}, 3}));
+    ExpectSameResults(cache.FindShortestPath(0, 6), {{0, 6}, 3});
+
+    ASSERT_TRUE(graph.RemoveDirectedEdge({0, 6}));
+    ExpectSameResults(cache.FindShortestPath(0, 6), {{0, 1, 2, 5, 6}, 18});
+
+    version = graph.GetVersion();
+    EXPECT_FALSE(graph.RemoveDirectedEdge({0, 6}));
+    EXPECT_EQ(graph.GetVersion(), version);
+
+    graph.AddVertex();
+    ExpectSameAsDijkstra(cache);
+    EXPECT_EQ(cache.GetNumberOfMisses(), 12);
+}
+
+TEST_F(ShortestPathCacheTest, AssignmentTest)
+{
+    DirectedListGraph cached;                                       // Tyle samo zmian w obu grafach
+    cached.AddVertices(7);
+    cached.AddDirectedEdgesBulk({{{0, 1}, 1}});
+    DirectedListGraph other;
+    other.AddVertices(7);
+    other.AddDirectedEdgesBulk({{{0, 6}, 1}});
+
+    ShortestPath::ShortestPathCache cache(cached);
+    ExpectSameResults(cache.FindShortestPath(0, 1), {{0, 1}, 1});
+
+    auto version = cached.GetVersion();
+    cached = other;
+    EXPECT_NE(cached.GetVersion(), version);
+    EXPECT_NE(cached.GetVersion(), other.GetVersion());
+    EXPECT_EQ(cache.FindShortestPath(0, 1).path.Size(), 0);
+    ExpectSameResults(cache.FindShortestPath(0, 6), {{0, 6}, 1});
+    EXPECT_EQ(cache.GetNumberOfMisses(), 2);
+
+    version = cached.GetVersion();
+    cached = DirectedListGraph {};
+    EXPECT_NE(cached.GetVersion(), version);
+    EXPECT_EQ(cache.FindShortestPath(0, 6).path.Size(), 0);
+}
+
+TEST_F(ShortestPathCacheTest, BellmanFordTest)
+{
+    ShortestPath::ShortestPathCache cache(graph,
+                                          ShortestPath::ShortestPathCache::DEFAULT_MEMORY_BUDGET,
+                                          ShortestPath::ShortestPathCache::Algorithm::BELLMAN_FORD);
+    ExpectSameAsDijkstra(cache);
+    EXPECT_EQ(cache.GetNumberOfMisses(), 7);
+}
+
+TEST(DirectedGraphVersionTest, MatrixGraphTest)
+{
+    DirectedMatrixGraph graph;
+    graph.AddVertices(3);
+
+    auto version = graph.GetVersion();
+    ASSERT_TRUE(graph.AddDirectedEdge({{0, 1}, 2}));
+    EXPECT_GT(graph.GetVersion(), version);
+
+    version = graph.GetVersion();
+    ASSERT_TRUE(graph.SetWeight({0, 1}, 5));
+    EXPECT_GT(graph.GetVersion(), version);
+
+    version = graph.GetVersion();
+    EXPECT_FALSE(graph.SetWeight({1, 2}, 5));
+    EXPECT_EQ(graph.GetVersion(), version);
+
+    ASSERT_TRUE(graph.RemoveDirectedEdge({0, 1}));
+    EXPECT_GT(graph.GetVersion(), version);
+}
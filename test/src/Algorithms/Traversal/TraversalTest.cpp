@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+
+#include "Algorithms/Traversal/Traversal.h"
+#include "Algorithms/Graphs/CsrGraph.h"
+#include "Algorithms/Graphs/DirectedGraphs/DirectedListGraph.h"
+#include "Algorithms/Graphs/DirectedGraphs/DirectedMatrixGraph.h"
+#include "Algorithms/Graphs/UndirectedGraphs/ListGraph.h"
+#include "Algorithms/Graphs/UndirectedGraphs/MatrixGraph.h"
+
+#include <filesystem>
+
+namespace
+{
+
+template<typename T>
+T GenerateUndirectedGraph()
+{
+    T graph;
+    graph.AddVertices(8);
+    graph.AddEdgesBulk({{{0, 1}, 1},
+                        {{0, 2}, 1},
+                        {{1, 3}, 1},
+                        {{2, 3}, 1},
+                        {{3, 4}, 1},
+                        {{4, 5}, 1},
+                        {{6, 7}, 1}});
+    return graph;
+}
+
+template<typename T>
+T GenerateDirectedGraph()
+{
+    T graph;
+    graph.AddVertices(6);
+    graph.AddDirectedEdgesBulk({{{0, 1}, 1},
+                                {{1, 2}, 1},
+                                {{2, 0}, 1},
+                                {{2, 3}, 1},
+                                {{4, 3}, 1},
+                                {{3, 5}, 1}});
+    return graph;
+}
+
+template<typename T>
+T GenerateStarOfPaths(uint32_t numberOfPaths, uint32_t length)
+{
+    T graph;
+    graph.AddVertices(numberOfPaths * length + 1);
+
+    DynamicArray<UndirectedGraph::EdgeData> edges(static_cast<size_t>(numberOfPaths) * length);
+    size_t position = 0;
+    for (uint32_t path = 0; path < numberOfPaths; path++)
+    {
+        Graph::Vertex previous = 0;
+        for (uint32_t i = 1; i <= length; i++)
+        {
+            const Graph::Vertex vertex = path * length + i;
+            edges[position++] = {{previous, vertex}, 1};
+            previous = vertex;
+        }
+    }
+    graph.AddEdgesBulk(edges);
+    return graph;
+}
+
+void ExpectDistances(const DynamicArray<uint32_t>& distances, const DynamicArray<uint32_t>& expected)
+{
+    ASSERT_EQ(distances.Size(), expected.Size());
+    for (size_t i = 0; i < expected.Size(); i++)
+    {
+        EXPECT_EQ(distances[i], expected[i]) << "vertex " << i;
+    }
+}
+
+template<typename T>
+DynamicArray<uint32_t> GetDistancesWithBfs(const T& graph, Graph::Vertex source)
+{
+    DynamicArray<uint32_t> distances(graph.GetOrder(), Traversal::UNREACHABLE);
+    Traversal::Scratch<T> scratch;
+
+    Traversal::BreadthFirstSearch(graph, source, scratch, [&distances](Graph::Vertex vertex, uint32_t depth) {
+        distances[vertex] = depth;
+    });
+
+    return distances;
+}
+
+template<typename T>
+void ExpectUndirectedTraversals(const T& graph)
+{
+    const DynamicArray<uint32_t> expected = {0, 1, 1, 2, 3, 4, Traversal::UNREACHABLE, Traversal::UNREACHABLE};
+    ExpectDistances(GetDistancesWithBfs(graph, 0), expected);
+    ExpectDistances(Traversal::GetDistances(graph, 0), expected);
+
+    Traversal::Scratch<T> scratch;
+    DynamicArray<Graph::Vertex> discovered(graph.GetOrder());
+    DynamicArray<Graph::Vertex> finished(graph.GetOrder());
+    size_t numberOfDiscovered = 0;
+    size_t numberOfFinished = 0;
+
+    Traversal::DepthFirstSearch(
+        graph, 0, scratch,
+        [&](Graph::Vertex vertex) { discovered[numberOfDiscovered++] = vertex; },
+        [&](Graph::Vertex vertex) { finished[numberOfFinished++] = vertex; });
+
+    ASSERT_EQ(numberOfDiscovered, 6);
+    ASSERT_EQ(numberOfFinished, 6);
+    EXPECT_EQ(discovered[0], 0);
+    EXPECT_EQ(finished[numberOfFinished - 1], 0);
+
+    DynamicArray<size_t> finishTimes(graph.GetOrder());
+    for (size_t i = 0; i < numberOfFinished; i++)
+    {
+        finishTimes[finished[i]] = i;
+    }
+    EXPECT_LT(finishTimes[5], finishTimes[4]);
+    EXPECT_LT(finishTimes[4], finishTimes[3]);
+    EXPECT_LT(finishTimes[3], finishTimes[0]);
+
+    numberOfDiscovered = 0;
+    Traversal::DepthFirstSearchAll(graph, scratch, [&](Graph::Vertex vertex) {
+        discovered[numberOfDiscovered++] = vertex;
+    });
+    EXPECT_EQ(numberOfDiscovered, graph.GetOrder());
+    EXPECT_EQ(discovered[6], 6);
+    EXPECT_EQ(discovered[7], 7);
+}
+
+template<typename T>
+void ExpectDirectedTraversals(const T& graph)
+{
+    ExpectDistances(Traversal::GetDistances(graph, 0), {0, 1, 2, 3, Traversal::UNREACHABLE, 4});
+    ExpectDistances(Traversal::GetDistances(graph, 4), {Traversal::UNREACHABLE,
+                                                        Traversal::UNREACHABLE,
+                                                        Traversal::UNREACHABLE,
+                                                        1, 0, 2});
+
+    Traversal::Scratch<T> scratch;
+    size_t numberOfDiscovered = 0;
+    Traversal::DepthFirstSearch(graph, 3, scratch, [&numberOfDiscovered](Graph::Vertex) { numberOfDiscovered++; });
+    EXPECT_EQ(numberOfDiscovered, 2);
+}
+
+}
+
+TEST(TraversalTest, UndirectedGraphsTest)
+{
+    ExpectUndirectedTraversals(GenerateUndirectedGraph<ListGraph>());
+    ExpectUndirectedTraversals(GenerateUndirectedGraph<MatrixGraph>());
+}
+
+TEST(TraversalTest, DirectedGraphsTest)
+{
+    ExpectDirectedTraversals(GenerateDirectedGraph<DirectedListGraph>());
+    ExpectDirectedTraversals(GenerateDirectedGraph<DirectedMatrixGraph>());
+}
+
+TEST(TraversalTest, CsrGraphTest)
+{
+    const auto path = (std::filesystem::temp_directory_path() / "TraversalTest.dsgr").string();
+
+    ASSERT_TRUE(CsrGraph::Save(path, GenerateUndirectedGraph<ListGraph>()));
+    auto undirectedGraph = CsrGraph::Load(path);
+    ASSERT_TRUE(undirectedGraph.has_value());
+    ExpectUndirectedTraversals(*undirectedGraph);
+
+    ASSERT_TRUE(CsrGraph::Save(path, GenerateDirectedGraph<DirectedListGraph>()));
+    auto directedGraph = CsrGraph::Load(path);
+    ASSERT_TRUE(directedGraph.has_value());
+    ExpectDirectedTraversals(*directedGraph);
+
+    std::filesystem::remove(path);
+}
+
+TEST(TraversalTest, DirectionOptimizingBfsTest)
+{
+    auto graph = GenerateStarOfPaths<ListGraph>(300, 3);
+    Traversal::Scratch<ListGraph> scratch;
+
+    DynamicArray<uint32_t> distances(graph.GetOrder(), Traversal::UNREACHABLE);
+    Traversal::DirectionOptimizingBfs(graph, 0, scratch, [&distances](Graph::Vertex vertex, uint32_t depth) {
+        distances[vertex] = depth;
+    });
+    ExpectDistances(distances, GetDistancesWithBfs(graph, 0));
+
+    ExpectDistances(Traversal::GetDistances(graph, 5), GetDistancesWithBfs(graph, 5));
+}
+
+TEST(TraversalTest, LongPathTest)
+{
+    auto graph = GenerateStarOfPaths<ListGraph>(1, 5000);
+    Traversal::Scratch<ListGraph> scratch;
+
+    Graph::Vertex last = 0;
+    Traversal::DepthFirstSearch(graph, 0, scratch, [&last](Graph::Vertex vertex) { last = vertex; });
+    EXPECT_EQ(last, 5000);
+}
@@ -1,9 +1,13 @@
 #include <gtest/gtest.h>
 
 #include "Containers/AvlTree.h"
+#include "Utils/Parallel.h"
 #include "Utils/Utils.h"
 
 #include <algorithm>
+#include <sstream>
+#include <utility>
+#include <functional>
 
 class AvlTreeTest : public testing::Test
 {
@@ -180,4 +184,368 @@ TEST_F(AvlTreeTest, ClearTest)
     tree.Insert(2);
     tree.Remove(5);
     tree.Clear();
+}
+
+TEST_F(AvlTreeTest, FromSortedTest)
+{
+    for (int32_t count : {0, 1, 2, 3, 7, 8, 100, 1023, 1024, 5000})
+    {
+        DynamicArray<int32_t> values(static_cast<size_t>(count));
+        for (int32_t i = 0; i < count; i++)
+        {
+            values[static_cast<size_t>(i)] = 2 * i;
+        }
+
+        auto sortedTree = AvlTree<int32_t>::FromSorted(values.begin(), values.end());
+        ASSERT_EQ(sortedTree.Size(), static_cast<size_t>(count));
+        ASSERT_TRUE(std::equal(values.begin(), values.end(), sortedTree.cbegin(), sortedTree.cend()));
+
+        for (int32_t i = 0; i < count; i++)
+        {
+            ASSERT_NE(sortedTree.Find(2 * i), sortedTree.cend());
+            ASSERT_EQ(sortedTree.Find(2 * i + 1), sortedTree.cend());
+        }
+
+        for (int32_t i = 0; i < count; i += 3)
+        {
+            ASSERT_TRUE(sortedTree.Remove(2 * i));
+            sortedTree.Insert(2 * i + 1);
+        }
+        ASSERT_TRUE(std::is_sorted(sortedTree.cbegin(), sortedTree.cend()));
+    }
+}
+
+TEST_F(AvlTreeTest, InsertRangeTest)
+{
+    DynamicArray<int32_t> values(3000);
+    for (auto& value : values)
+    {
+        value = Utils::GetRandomNumber<int32_t>(-1000, 1000);
+    }
+    tree.InsertRange(values.begin(), values.end());
+    ASSERT_EQ(tree.Size(), values.Size());
+    ASSERT_TRUE(std::is_sorted(tree.cbegin(), tree.cend()));
+
+    tree.InsertRange(values.begin(), values.end());
+    ASSERT_EQ(tree.Size(), 2 * values.Size());
+    ASSERT_TRUE(std::is_sorted(tree.cbegin(), tree.cend()));
+
+    DynamicArray<int32_t> few = {5000, -5000, 0};
+    tree.InsertRange(few.begin(), few.end());
+    ASSERT_EQ(tree.Size(), 2 * values.Size() + few.Size());
+    ASSERT_EQ(tree.Min(), -5000);
+    ASSERT_EQ(tree.Max(), 5000);
+
+    for (auto value : values)
+    {
+        ASSERT_TRUE(tree.Remove(value));
+    }
+    ASSERT_EQ(tree.Size(), values.Size() + few.Size());
+    ASSERT_TRUE(std::is_sorted(tree.cbegin(), tree.cend()));
+
+    AvlTree<int32_t, std::greater<>> descending = {3, 1, 2, 1};
+    ASSERT_EQ(descending.Size(), 4);
+    ASSERT_EQ(descending.Min(), 3);
+    ASSERT_EQ(descending.Max(), 1);
+}
+
+TEST_F(AvlTreeTest, OrderStatisticsTest)
+{
+    AvlTree<int32_t, Utils::Less<int32_t>, TreeAugmentation::OrderStatistics> ranked;
+    ASSERT_EQ(ranked.Select(0), ranked.end());
+    ASSERT_EQ(ranked.Rank(5), 0);
+    ASSERT_EQ(ranked.CountRange(0, 10), 0);
+
+    DynamicArray<int32_t> values(2000);
+    for (auto& value : values)
+    {
+        value = Utils::GetRandomNumber<int32_t>(-500, 500);
+        ranked.Insert(value);
+    }
+    for (size_t i = 0; i < values.Size(); i += 2)
+    {
+        ASSERT_TRUE(ranked.Remove(values[i]));
+    }
+
+    DynamicArray<int32_t> sorted(ranked.Size());
+    std::copy(ranked.cbegin(), ranked.cend(), sorted.begin());
+
+    auto expectStatistics = [&sorted](const auto& checked) {
+        ASSERT_EQ(checked.Size(), sorted.Size());
+        for (size_t k = 0; k < sorted.Size(); k++)
+        {
+            ASSERT_EQ(*checked.Select(k), sorted[k]);
+        }
+        ASSERT_EQ(checked.Select(sorted.Size()), checked.cend());
+
+        for (int32_t value = -502; value <= 502; value += 3)
+        {
+            auto less = static_cast<size_t>(std::lower_bound(sorted.begin(), sorted.end(), value) - sorted.begin());
+            auto notGreater = static_cast<size_t>(std::upper_bound(sorted.begin(), sorted.end(), value + 40) - sorted.begin());
+            ASSERT_EQ(checked.Rank(value), less);
+            ASSERT_EQ(checked.CountRange(value, value + 40), notGreater - less);
+            ASSERT_EQ(checked.CountRange(value + 40, value), 0);
+        }
+    };
+
+    expectStatistics(ranked);
+    expectStatistics(AvlTree<int32_t, Utils::Less<int32_t>, TreeAugmentation::OrderStatistics>(ranked));
+    expectStatistics(AvlTree<int32_t, Utils::Less<int32_t>, TreeAugmentation::OrderStatistics>::FromSorted(sorted.begin(), sorted.end()));
+
+    AvlTree<int32_t, Utils::Less<int32_t>, TreeAugmentation::OrderStatistics> merged;
+    merged.InsertRange(sorted.begin(), sorted.end());
+    expectStatistics(merged);
+}
+
+TEST_F(AvlTreeTest, BoundsTest)
+{
+    for (int32_t value : {1, 3, 3, 3, 5, 7, 9})
+    {
+        tree.Insert(value);
+    }
+
+    ASSERT_EQ(*tree.LowerBound(3), 3);
+    ASSERT_EQ(*tree.UpperBound(3), 5);
+    ASSERT_EQ(*tree.LowerBound(4), 5);
+    ASSERT_EQ(*tree.UpperBound(4), 5);
+    ASSERT_EQ(*tree.LowerBound(0), 1);
+    ASSERT_EQ(tree.LowerBound(10), tree.end());
+    ASSERT_EQ(tree.UpperBound(9), tree.end());
+
+    auto equal = tree.EqualRange(3);
+    ASSERT_EQ(std::distance(equal.begin(), equal.end()), 3);
+    ASSERT_TRUE(tree.EqualRange(4).IsEmpty());
+
+    DynamicArray<int32_t> expected = {3, 3, 3, 5, 7};
+    auto range = std::as_const(tree).Range(2, 7);
+    ASSERT_TRUE(std::equal(range.begin(), range.end(), expected.begin(), expected.end()));
+    ASSERT_TRUE(tree.Range(7, 2).IsEmpty());
+    ASSERT_TRUE(tree.Range(10, 20).IsEmpty());
+
+    int32_t sum = 0;
+    for (auto value : tree.Range(0, 100))
+    {
+        sum += value;
+    }
+    ASSERT_EQ(sum, 31);
+}
+
+TEST_F(AvlTreeTest, JoinSplitTest)
+{
+    for (int32_t leftCount : {0, 1, 5, 100, 2000})
+    {
+        for (int32_t rightCount : {0, 3, 300})
+        {
+            AvlTree<int32_t> left;
+            AvlTree<int32_t> right;
+            for (int32_t i = 0; i < leftCount; i++)
+            {
+                left.Insert(Utils::GetRandomNumber<int32_t>(-1000, 0));
+            }
+            for (int32_t i = 0; i < rightCount; i++)
+            {
+                right.Insert(Utils::GetRandomNumber<int32_t>(0, 1000));
+            }
+
+            auto joined = AvlTree<int32_t>::Join(std::move(left), 0, std::move(right));
+            ASSERT_EQ(joined.Size(), static_cast<size_t>(leftCount + rightCount + 1));
+            ASSERT_EQ(left.Size(), 0);
+            ASSERT_EQ(right.Size(), 0);
+            ASSERT_EQ(static_cast<size_t>(std::distance(joined.cbegin(), joined.cend())), joined.Size());
+            ASSERT_TRUE(std::is_sorted(joined.cbegin(), joined.cend()));
+        }
+    }
+
+    DynamicArray<int32_t> values(3000);
+    for (auto& value : values)
+    {
+        value = Utils::GetRandomNumber<int32_t>(-500, 500);
+    }
+    tree.InsertRange(values.begin(), values.end());
+
+    for (int32_t pivot : {-600, -500, -1, 0, 250, 500, 600})
+    {
+        AvlTree<int32_t> copy(tree);
+        auto parts = AvlTree<int32_t>::Split(std::move(copy), pivot);
+        auto less = static_cast<size_t>(std::count_if(values.begin(), values.end(), [pivot](int32_t value) {
+            return value < pivot;
+        }));
+
+        ASSERT_EQ(copy.Size(), 0);
+        ASSERT_EQ(parts.first.Size(), less);
+        ASSERT_EQ(parts.second.Size(), values.Size() - less);
+        ASSERT_EQ(static_cast<size_t>(std::distance(parts.first.cbegin(), parts.first.cend())), less);
+        ASSERT_TRUE(std::all_of(parts.first.cbegin(), parts.first.cend(), [pivot](int32_t value) { return value < pivot; }));
+        ASSERT_TRUE(std::all_of(parts.second.cbegin(), parts.second.cend(), [pivot](int32_t value) { return value >= pivot; }));
+        ASSERT_TRUE(std::is_sorted(parts.first.cbegin(), parts.first.cend()));
+        ASSERT_TRUE(std::is_sorted(parts.second.cbegin(), parts.second.cend()));
+
+        parts.first.Insert(pivot - 1000);
+        ASSERT_TRUE(parts.first.Remove(pivot - 1000));
+        auto rejoined = AvlTree<int32_t>::Join(std::move(parts.first), pivot, std::move(parts.second));
+        ASSERT_EQ(rejoined.Size(), values.Size() + 1);
+        ASSERT_TRUE(rejoined.Remove(pivot));
+        ASSERT_TRUE(std::equal(tree.cbegin(), tree.cend(), rejoined.cbegin(), rejoined.cend()));
+    }
+
+    using RankedTree = AvlTree<int32_t, Utils::Less<int32_t>, TreeAugmentation::OrderStatistics>;
+    RankedTree ranked;
+    ranked.InsertRange(values.begin(), values.end());
+    const auto less = ranked.Rank(100);
+
+    auto parts = RankedTree::Split(std::move(ranked), 100);
+    ASSERT_EQ(parts.first.Size(), less);
+    ASSERT_EQ(parts.second.Size(), values.Size() - less);
+    size_t k = 0;
+    for (auto value : std::as_const(parts.second))
+    {
+        ASSERT_EQ(*parts.second.Select(k++), value);
+    }
+    ASSERT_EQ(parts.first.Select(less), parts.first.cend());
+    ASSERT_EQ(parts.second.Rank(100), 0);
+}
+
+TEST_F(AvlTreeTest, SetOperationsTest)
+{
+    auto expectTree = [](const AvlTree<int32_t>& result, const DynamicArray<int32_t>& expected) {
+        ASSERT_EQ(result.Size(), expected.Size());
+        ASSERT_TRUE(std::equal(expected.begin(), expected.end(), result.cbegin(), result.cend()));
+    };
+
+    for (int32_t lhsCount : {0, 10, 1000})
+    {
+        for (int32_t rhsCount : {0, 10, 1000})
+        {
+            DynamicArray<int32_t> lhsValues(static_cast<size_t>(lhsCount));
+            DynamicArray<int32_t> rhsValues(static_cast<size_t>(rhsCount));
+            for (auto& value : lhsValues)
+            {
+                value = Utils::GetRandomNumber<int32_t>(-300, 300);
+            }
+            for (auto& value : rhsValues)
+            {
+                value = Utils::GetRandomNumber<int32_t>(-100, 500);
+            }
+            AvlTree<int32_t> lhs;
+            AvlTree<int32_t> rhs;
+            lhs.InsertRange(lhsValues.begin(), lhsValues.end());
+            rhs.InsertRange(rhsValues.begin(), rhsValues.end());
+            std::sort(lhsValues.begin(), lhsValues.end());
+            std::sort(rhsValues.begin(), rhsValues.end());
+
+            DynamicArray<int32_t> expectedUnion = lhsValues;
+            DynamicArray<int32_t> expectedIntersection;
+            DynamicArray<int32_t> expectedDifference;
+            for (auto value : rhsValues)
+            {
+                if (!std::binary_search(lhsValues.begin(), lhsValues.end(), value))
+                {
+                    expectedUnion.PushBack(value);
+                }
+            }
+            std::sort(expectedUnion.begin(), expectedUnion.end());
+            for (auto value : lhsValues)
+            {
+                if (std::binary_search(rhsValues.begin(), rhsValues.end(), value))
+                {
+                    expectedIntersection.PushBack(value);
+                }
+                else
+                {
+                    expectedDifference.PushBack(value);
+                }
+            }
+
+            expectTree(AvlTree<int32_t>::Union(AvlTree<int32_t>(lhs), AvlTree<int32_t>(rhs)), expectedUnion);
+            expectTree(AvlTree<int32_t>::Intersection(AvlTree<int32_t>(lhs), AvlTree<int32_t>(rhs)), expectedIntersection);
+            expectTree(AvlTree<int32_t>::Difference(AvlTree<int32_t>(lhs), AvlTree<int32_t>(rhs)), expectedDifference);
+
+            auto merged = AvlTree<int32_t>::Union(std::move(lhs), std::move(rhs));
+            ASSERT_EQ(lhs.Size(), 0);
+            ASSERT_EQ(rhs.Size(), 0);
+            merged.Insert(1000);
+            ASSERT_TRUE(merged.Remove(1000));
+            for (auto value : rhsValues)
+            {
+                merged.Remove(value);
+            }
+            ASSERT_TRUE(std::is_sorted(merged.cbegin(), merged.cend()));
+        }
+    }
+
+    using RankedTree = AvlTree<int32_t, Utils::Less<int32_t>, TreeAugmentation::OrderStatistics>;
+    auto ranked = RankedTree::Union(RankedTree {1, 3, 5, 7}, RankedTree {2, 3, 4});
+    ASSERT_EQ(ranked.Size(), 6);
+    for (size_t k = 0; k < ranked.Size(); k++)
+    {
+        ASSERT_EQ(*ranked.Select(k), static_cast<int32_t>(k + 1) + (k >= 5 ? 1 : 0));
+    }
+    ASSERT_EQ(RankedTree::Intersection(RankedTree {1, 3, 5, 7}, RankedTree {2, 3, 4, 7}).Rank(7), 1);
+}
+
+TEST_F(AvlTreeTest, CopyAndSerializationTest)
+{
+    for (int32_t i = 0; i < 500; i++)
+    {
+        tree.Insert(Utils::GetRandomNumber<int32_t>(0, 100));
+    }
+
+    std::stringstream stream;
+    stream << tree;
+    AvlTree<int32_t> read = {7, 8};
+    stream >> read;
+    ASSERT_EQ(read.Size(), tree.Size());
+    ASSERT_TRUE(std::equal(tree.cbegin(), tree.cend(), read.cbegin(), read.cend()));
+
+    std::stringstream chain("4\n1 -1 2 -1 3 -1 4 -1 -1 ");
+    chain >> read;
+    ASSERT_EQ(read.Size(), 4);
+    ASSERT_EQ(read.Min(), 1);
+    ASSERT_EQ(read.Max(), 4);
+
+    std::stringstream truncated("18446744073709551615\n5 -1 ");
+    truncated >> read;
+    ASSERT_EQ(read.Size(), 1);
+    ASSERT_EQ(read.Min(), 5);
+
+    auto parts = AvlTree<int32_t>::Split(AvlTree<int32_t>(tree), 50);
+    auto copy = parts.second;
+    parts.second.Clear();
+    parts.first.Insert(-1);
+    ASSERT_EQ(parts.first.Size() + copy.Size(), tree.Size() + 1);
+    ASSERT_TRUE(std::is_sorted(copy.cbegin(), copy.cend()));
+    ASSERT_TRUE(std::is_sorted(parts.first.cbegin(), parts.first.cend()));
+}
+
+TEST_F(AvlTreeTest, ConcurrentSplitPartsTest)
+{
+    AvlTree<int32_t> values;
+    for (int32_t i = 0; i < 2000; i++)
+    {
+        values.Insert(i);
+    }
+    auto parts = AvlTree<int32_t>::Split(std::move(values), 1000);
+
+    Utils::ParallelFor(2u, [&parts](uint32_t thread) {              // Części zmieniane jednocześnie
+        auto& part = thread == 0 ? parts.first : parts.second;      // zwalniają i alokują węzły
+        const int32_t offset = thread == 0 ? 0 : 1000;
+        const int32_t step = thread == 0 ? -2 : 2;                  // Części pozostają rozłączne
+        for (int32_t i = 0; i < 1000; i += 2)
+        {
+            part.Remove(offset + i);
+        }
+        for (int32_t i = 0; i < 5000; i++)
+        {
+            part.Insert(offset + step * i);
+        }
+    });
+
+    ASSERT_EQ(parts.first.Size(), 5500);
+    ASSERT_EQ(parts.second.Size(), 5500);
+    ASSERT_TRUE(std::is_sorted(parts.first.cbegin(), parts.first.cend()));
+    ASSERT_TRUE(std::is_sorted(parts.second.cbegin(), parts.second.cend()));
+
+    auto joined = AvlTree<int32_t>::Join(std::move(parts.first), 1000, std::move(parts.second));
+    ASSERT_EQ(joined.Size(), 11001);
+    ASSERT_TRUE(std::is_sorted(joined.cbegin(), joined.cend()));
 }
\ No newline at end of file
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include "Containers/BTreeMap.h"
+
+#include <string>
+
+class BTreeMapTest : public testing::Test
+{
+protected:
+    BTreeMap<int32_t, std::string> map = {{1, "a"}, {3, "b"}, {5, "c"}, {7, "d"}, {9, "e"}};
+};
+
+TEST_F(BTreeMapTest, AccessTest)
+{
+    ASSERT_EQ(map.at(5), "c");
+    ASSERT_THROW(static_cast<void>(map.at(4)), std::out_of_range);
+
+    map[4] = "x";
+    ASSERT_EQ(map.Size(), 6);
+    ASSERT_EQ(map.at(4), "x");
+    ASSERT_EQ(map.Insert({4, "y"}), map.end());
+    ASSERT_EQ(map.Insert({11, "f"})->second, "f");
+
+    ASSERT_TRUE(map.Remove(4));
+    ASSERT_FALSE(map.Remove(4));
+    ASSERT_EQ(map.Size(), 6);
+    ASSERT_EQ(map.Min().first, 1);
+    ASSERT_EQ(map.Max().first, 11);
+}
+
+TEST_F(BTreeMapTest, BoundsTest)
+{
+    ASSERT_EQ(map.LowerBound(3)->second, "b");
+    ASSERT_EQ(map.UpperBound(3)->second, "c");
+    ASSERT_EQ(map.LowerBound(4)->first, 5);
+    ASSERT_EQ(map.LowerBound(10), map.end());
+    ASSERT_EQ(map.UpperBound(9), map.end());
+
+    auto equal = map.EqualRange(7);
+    ASSERT_FALSE(equal.IsEmpty());
+    ASSERT_EQ(equal.begin()->second, "d");
+    ASSERT_TRUE(map.EqualRange(6).IsEmpty());
+}
+
+TEST_F(BTreeMapTest, RangeTest)
+{
+    std::string values;
+    for (const auto& pair : map.Range(2, 7))
+    {
+        values += pair.second;
+    }
+    ASSERT_EQ(values, "bcd");
+    ASSERT_TRUE(map.Range(8, 2).IsEmpty());
+
+    map.ForEachInRange(3, 5, [](auto& pair) {
+        pair.second += "!";
+    });
+    ASSERT_EQ(map.at(3), "b!");
+    ASSERT_EQ(map.at(5), "c!");
+    ASSERT_EQ(map.at(7), "d");
+}
+
+TEST_F(BTreeMapTest, ManyKeysTest)
+{
+    BTreeMap<int32_t, int32_t> squares;
+    for (int32_t i = 999; i >= 0; i--)
+    {
+        squares[i] = i * i;
+    }
+    for (int32_t i = 0; i < 1000; i += 3)
+    {
+        ASSERT_TRUE(squares.Remove(i));
+    }
+
+    int32_t expectedKey = 1;
+    for (const auto& pair : squares)
+    {
+        ASSERT_EQ(pair.first, expectedKey);
+        ASSERT_EQ(pair.second, expectedKey * expectedKey);
+        expectedKey += expectedKey % 3 == 1 ? 1 : 2;
+    }
+    ASSERT_EQ(squares.Size(), 666);
+}
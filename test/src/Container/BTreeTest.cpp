@@ -0,0 +1,219 @@
+#include <gtest/gtest.h>
+
+#include "Containers/BTree.h"
+#include "Utils/Utils.h"
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+class BTreeTest : public testing::Test
+{
+protected:
+    BTree<int32_t> tree;
+};
+
+namespace
+{
+
+/**
+ * Applies random insertions and removals to the tree and to a sorted vector and compares them after every step
+ */
+template<typename T>
+void ExpectSameAsSortedVector(T& tree, int32_t numberOfOperations, int32_t maxValue)
+{
+    std::vector<int32_t> expected;
+    for (int32_t i = 0; i < numberOfOperations; i++)
+    {
+        auto value = Utils::GetRandomNumber<int32_t>(0, maxValue);
+        if (Utils::GetRandomNumber<int32_t>(0, 2) > 0)
+        {
+            tree.Insert(value);
+            expected.insert(std::upper_bound(expected.begin(), expected.end(), value), value);
+        }
+        else
+        {
+            auto it = std::lower_bound(expected.begin(), expected.end(), value);
+            auto isPresent = it != expected.end() && *it == value;
+            ASSERT_EQ(tree.Remove(value), isPresent);
+            if (isPresent)
+            {
+                expected.erase(it);
+            }
+        }
+        ASSERT_EQ(tree.Size(), expected.size());
+    }
+    ASSERT_TRUE(std::equal(tree.cbegin(), tree.cend(), expected.cbegin(), expected.cend()));
+    ASSERT_TRUE(std::equal(std::make_reverse_iterator(tree.cend()), std::make_reverse_iterator(tree.cbegin()), expected.crbegin(), expected.crend()));
+
+    for (int32_t value = -1; value <= maxValue + 1; value++)
+    {
+        auto lower = std::lower_bound(expected.begin(), expected.end(), value);
+        auto upper = std::upper_bound(expected.begin(), expected.end(), value);
+        ASSERT_EQ(std::distance(tree.cbegin(), std::as_const(tree).LowerBound(value)), std::distance(expected.begin(), lower));
+        ASSERT_EQ(std::distance(tree.cbegin(), std::as_const(tree).UpperBound(value)), std::distance(expected.begin(), upper));
+        ASSERT_EQ(tree.Find(value) != tree.cend(), lower != upper);
+    }
+}
+
+}
+
+TEST_F(BTreeTest, InsertTest)
+{
+    for (int32_t value : {9, 4, 11, 7, 8, 1, 5, 2})
+    {
+        auto it = tree.Insert(value);
+        ASSERT_EQ(*it, value);
+        ASSERT_TRUE(std::is_sorted(tree.cbegin(), tree.cend()));
+        ASSERT_TRUE(tree.Find(value) != tree.end());
+    }
+    ASSERT_EQ(tree.Size(), 8);
+    ASSERT_EQ(tree.Min(), 1);
+    ASSERT_EQ(tree.Max(), 11);
+
+    for (int32_t i = 0; i < 1000; i++)
+    {
+        tree.Insert(i % 100);
+    }
+    ASSERT_EQ(tree.Size(), 1008);
+    ASSERT_TRUE(std::is_sorted(tree.cbegin(), tree.cend()));
+    ASSERT_EQ(std::distance(tree.EqualRange(7).begin(), tree.EqualRange(7).end()), 11);
+}
+
+TEST_F(BTreeTest, RemoveTest)
+{
+    for (int32_t i = 0; i < 1000; i++)
+    {
+        tree.Insert(i);
+    }
+    ASSERT_FALSE(tree.Remove(1000));
+    ASSERT_EQ(tree.Size(), 1000);
+
+    for (int32_t i = 0; i < 1000; i += 2)
+    {
+        ASSERT_TRUE(tree.Remove(i));
+    }
+    ASSERT_EQ(tree.Size(), 500);
+    ASSERT_TRUE(std::is_sorted(tree.cbegin(), tree.cend()));
+    ASSERT_EQ(tree.Min(), 1);
+    ASSERT_EQ(tree.Max(), 999);
+
+    for (int32_t i = 999; i > 0; i -= 2)
+    {
+        ASSERT_TRUE(tree.Remove(i));
+    }
+    ASSERT_EQ(tree.Size(), 0);
+    ASSERT_TRUE(tree.begin() == tree.end());
+
+    tree.Insert(3);
+    ASSERT_EQ(tree.Min(), 3);
+}
+
+TEST_F(BTreeTest, RandomOperationsTest)
+{
+    ExpectSameAsSortedVector(tree, 5000, 300);
+
+    BTree<int32_t, Utils::Less<int32_t>, 4> smallTree;
+    ExpectSameAsSortedVector(smallTree, 5000, 300);
+
+    BTree<int64_t, Utils::Less<int64_t>, 5> oddTree;
+    ExpectSameAsSortedVector(oddTree, 5000, 100);
+}
+
+TEST_F(BTreeTest, ComparatorTest)
+{
+    BTree<int32_t, Utils::Greater<int32_t>, 4> descending;
+    for (int32_t i = 0; i < 100; i++)
+    {
+        descending.Insert(i);
+    }
+    ASSERT_EQ(descending.Min(), 99);
+    ASSERT_EQ(descending.Max(), 0);
+    ASSERT_EQ(*descending.LowerBound(50), 50);
+    ASSERT_EQ(*descending.UpperBound(50), 49);
+    ASSERT_TRUE(std::is_sorted(descending.cbegin(), descending.cend(), Utils::Greater<int32_t>()));
+
+    BTree<std::string, Utils::Less<std::string>, 4> strings = {"d", "a", "c", "b", "e", "f"};
+    ASSERT_TRUE(strings.Remove("c"));
+    std::string concatenated;
+    for (const auto& value : strings)
+    {
+        concatenated += value;
+    }
+    ASSERT_EQ(concatenated, "abdef");
+}
+
+TEST_F(BTreeTest, FromSortedTest)
+{
+    for (size_t size : {0u, 1u, 4u, 5u, 63u, 64u, 65u, 1000u})
+    {
+        std::vector<int32_t> values(size);
+        for (size_t i = 0; i < size; i++)
+        {
+            values[i] = static_cast<int32_t>(i * 2);
+        }
+
+        auto built = BTree<int32_t, Utils::Less<int32_t>, 4>::FromSorted(values.begin(), values.end());
+        ASSERT_EQ(built.Size(), size);
+        ASSERT_TRUE(std::equal(built.cbegin(), built.cend(), values.cbegin(), values.cend()));
+
+        auto copy = built;
+        for (size_t i = 0; i < size; i += 3)
+        {
+            ASSERT_TRUE(copy.Remove(static_cast<int32_t>(i * 2)));
+            copy.Insert(static_cast<int32_t>(i * 2 + 1));
+        }
+        ASSERT_EQ(copy.Size(), size);
+        ASSERT_TRUE(std::is_sorted(copy.cbegin(), copy.cend()));
+        ASSERT_TRUE(std::equal(built.cbegin(), built.cend(), values.cbegin(), values.cend()));
+    }
+}
+
+TEST_F(BTreeTest, StreamTest)
+{
+    BTree<int32_t, Utils::Less<int32_t>, 4> tree;
+    for (int32_t i = 0; i < 100; i++)
+    {
+        tree.Insert((i * 37) % 100);
+    }
+
+    std::stringstream stream;
+    stream << tree;
+    BTree<int32_t, Utils::Less<int32_t>, 4> read = {7, 8};
+    stream >> read;
+    ASSERT_TRUE(std::equal(tree.cbegin(), tree.cend(), read.cbegin(), read.cend()));
+
+    std::stringstream unsorted("6\n5 3 9 1 3 7 ");
+    unsorted >> read;
+    ASSERT_EQ(read.Size(), 6);
+    ASSERT_TRUE(std::is_sorted(read.cbegin(), read.cend()));
+    ASSERT_NE(read.Find(1), read.end());
+    read.Insert(4);
+    ASSERT_EQ(*read.LowerBound(4), 4);
+
+    std::stringstream truncated("18446744073709551615\n1 2 3 ");
+    truncated >> read;
+    ASSERT_TRUE(truncated.fail());
+    ASSERT_EQ(read.Size(), 7);
+}
+
+TEST_F(BTreeTest, RangeTest)
+{
+    for (int32_t i = 0; i < 200; i++)
+    {
+        tree.Insert(i);
+    }
+
+    int32_t sum = 0;
+    for (auto value : tree.Range(10, 19))
+    {
+        sum += value;
+    }
+    ASSERT_EQ(sum, 145);
+    ASSERT_TRUE(tree.Range(20, 10).IsEmpty());
+    ASSERT_TRUE(tree.Range(300, 400).IsEmpty());
+    ASSERT_EQ(*--tree.end(), 199);
+    ASSERT_EQ(tree.LowerBound(200), tree.end());
+}
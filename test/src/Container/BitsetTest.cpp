@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+
+#include "Containers/Bitset.h"
+
+TEST(BitsetTest, SetTest)
+{
+    Bitset bitset(130);
+
+    EXPECT_EQ(bitset.Size(), 130);
+    for (size_t i = 0; i < bitset.Size(); i++)
+    {
+        EXPECT_FALSE(bitset.Test(i));
+    }
+
+    bitset.Set(0);
+    bitset.Set(63);
+    bitset.Set(64);
+    bitset.Set(129);
+    EXPECT_TRUE(bitset.Test(0));
+    EXPECT_TRUE(bitset.Test(63));
+    EXPECT_TRUE(bitset.Test(64));
+    EXPECT_TRUE(bitset.Test(129));
+    EXPECT_FALSE(bitset.Test(1));
+    EXPECT_FALSE(bitset.Test(65));
+
+    bitset.Unset(63);
+    EXPECT_FALSE(bitset.Test(63));
+    EXPECT_TRUE(bitset.Test(64));
+
+    EXPECT_FALSE(bitset.TestAndSet(100));
+    EXPECT_TRUE(bitset.TestAndSet(100));
+}
+
+TEST(BitsetTest, ResetTest)
+{
+    Bitset bitset(10);
+    bitset.Set(3);
+
+    bitset.Reset(200);
+    EXPECT_EQ(bitset.Size(), 200);
+    EXPECT_FALSE(bitset.Test(3));
+    bitset.Set(199);
+
+    bitset.Reset(5);
+    EXPECT_EQ(bitset.Size(), 5);
+    bitset.Reset(200);
+    EXPECT_FALSE(bitset.Test(199));
+
+    bitset.Set(7);
+    bitset.Clear();
+    EXPECT_FALSE(bitset.Test(7));
+}
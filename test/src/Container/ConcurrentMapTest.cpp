@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include "Containers/ConcurrentMap.h"
+#include "Utils/Parallel.h"
+
+#include <stdexcept>
+#include <string>
+
+class ConcurrentMapTest : public testing::Test
+{
+protected:
+    ConcurrentMap<int32_t, std::string> map = {{1, "a"}, {3, "b"}, {5, "c"}};
+};
+
+TEST_F(ConcurrentMapTest, AccessTest)
+{
+    ASSERT_EQ(map.Find(3), "b");
+    ASSERT_FALSE(map.Find(4).has_value());
+    ASSERT_TRUE(map.Contains(5));
+
+    auto snapshot = map.Snapshot();
+    ASSERT_TRUE(map.Insert({4, "x"}));
+    ASSERT_FALSE(map.Insert({4, "y"}));
+    map.InsertOrAssign({3, "z"});
+    ASSERT_TRUE(map.Remove(1));
+    ASSERT_FALSE(map.Remove(1));
+
+    ASSERT_EQ(map.Size(), 3);
+    ASSERT_EQ(map.ToString(), "{3: z, 4: x, 5: c}");
+    ASSERT_EQ(snapshot.ToString(), "{1: a, 3: b, 5: c}");
+
+    map.Update([](auto& version) {
+        version.Remove(4);
+        version.Insert({6, "d"});
+    });
+    ASSERT_EQ(map.ToString(), "{3: z, 5: c, 6: d}");
+
+    map.Clear();
+    ASSERT_EQ(map.Size(), 0);
+    ASSERT_EQ(snapshot.Size(), 3);
+}
+
+TEST_F(ConcurrentMapTest, ThrowingUpdateTest)
+{
+    ASSERT_THROW(map.Update([](auto& version) {
+        version.Insert({7, "d"});
+        throw std::runtime_error("Update failed");
+    }), std::runtime_error);
+
+    ASSERT_FALSE(map.Contains(7));
+    ASSERT_EQ(map.ToString(), "{1: a, 3: b, 5: c}");
+    ASSERT_TRUE(map.Insert({7, "d"}));
+}
+
+TEST_F(ConcurrentMapTest, ConcurrentUpdatesTest)
+{
+    constexpr int32_t numberOfKeys = 500;
+    constexpr uint32_t numberOfThreads = 4;
+    ConcurrentMap<int32_t, int32_t> values;
+
+    DynamicArray<uint32_t> errors(numberOfThreads, 0u);
+    Utils::ParallelFor(numberOfThreads, [&values, &errors](uint32_t thread) {
+        if (thread < 2)                                             // Pisarze wstawiają pary (k, k) i (-k, -k)
+        {                                                           // jedną aktualizacją
+            for (int32_t i = 1; i <= numberOfKeys; i++)
+            {
+                auto key = thread == 0 ? i : numberOfKeys + i;
+                values.Update([key](auto& version) {
+                    version.Insert({key, key});
+                    version.Insert({-key, -key});
+                });
+                if (i % 3 == 0)
+                {
+                    values.Update([key](auto& version) {
+                        version.Remove(key);
+                        version.Remove(-key);
+                    });
+                }
+            }
+            return;
+        }
+        for (int32_t repetition = 0; repetition < 200; repetition++)
+        {
+            auto key = (repetition * 7) % (2 * numberOfKeys) + 1;
+            auto value = values.Find(key);
+            if (value.has_value() && *value != key)
+            {
+                errors[thread]++;
+            }
+
+            int64_t sum = 0;
+            for (const auto& pair : values.Snapshot())
+            {
+                sum += pair.second;
+            }
+            if (sum != 0)
+            {
+                errors[thread]++;
+            }
+        }
+    });
+
+    for (auto threadErrors : errors)
+    {
+        ASSERT_EQ(threadErrors, 0u);
+    }
+    ASSERT_EQ(values.Size(), 2u * 2u * (numberOfKeys - numberOfKeys / 3));
+    ASSERT_FALSE(values.Contains(3));
+    ASSERT_EQ(values.Find(-(numberOfKeys + 1)), -(numberOfKeys + 1));
+}
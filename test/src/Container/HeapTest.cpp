@@ -19,7 +19,7 @@ TEST_F(HeapTest, InsertTest)
     heap.Insert(5);
 
     ASSERT_EQ(heap.Size(), 5);
-    ASSERT_TRUE(std::is_heap(heap.Array().cbegin(), heap.Array().cend()));
+    ASSERT_TRUE(std::is_heap(heap.Array().begin(), heap.Array().end()));
 
     heap.Insert(10);
     heap.Insert(8);
@@ -28,7 +28,7 @@ TEST_F(HeapTest, InsertTest)
     heap.Insert(-5);
 
     ASSERT_EQ(heap.Size(), 10);
-    ASSERT_TRUE(std::is_heap(heap.Array().cbegin(), heap.Array().cend()));
+    ASSERT_TRUE(std::is_heap(heap.Array().begin(), heap.Array().end()));
 }
 
 TEST_F(HeapTest, FindTest)
@@ -65,46 +65,46 @@ TEST_F(HeapTest, RemoveTest)
     heap.Insert(0);
 
     ASSERT_EQ(heap.Size(), 7);
-    ASSERT_TRUE(std::is_heap(heap.Array().cbegin(), heap.Array().cend()));
+    ASSERT_TRUE(std::is_heap(heap.Array().begin(), heap.Array().end()));
 
     heap.Remove(1);
     ASSERT_EQ(heap.Size(), 6);
     ASSERT_EQ(heap.Find(1), heap.cend());
-    ASSERT_TRUE(std::is_heap(heap.Array().cbegin(), heap.Array().cend()));
+    ASSERT_TRUE(std::is_heap(heap.Array().begin(), heap.Array().end()));
 
     heap.Remove(23);
     ASSERT_EQ(heap.Size(), 5);
     ASSERT_EQ(heap.Find(23), heap.cend());
-    ASSERT_TRUE(std::is_heap(heap.Array().cbegin(), heap.Array().cend()));
+    ASSERT_TRUE(std::is_heap(heap.Array().begin(), heap.Array().end()));
 
     heap.Remove(15);
     ASSERT_EQ(heap.Size(), 4);
     ASSERT_EQ(heap.Find(15), heap.cend());
-    ASSERT_TRUE(std::is_heap(heap.Array().cbegin(), heap.Array().cend()));
+    ASSERT_TRUE(std::is_heap(heap.Array().begin(), heap.Array().end()));
 
     heap.Remove(-34);
     ASSERT_EQ(heap.Size(), 3);
     ASSERT_EQ(heap.Find(-34), heap.cend());
-    ASSERT_TRUE(std::is_heap(heap.Array().cbegin(), heap.Array().cend()));
+    ASSERT_TRUE(std::is_heap(heap.Array().begin(), heap.Array().end()));
 
     heap.Remove(12);
     ASSERT_EQ(heap.Size(), 2);
     ASSERT_EQ(heap.Find(12), heap.cend());
-    ASSERT_TRUE(std::is_heap(heap.Array().cbegin(), heap.Array().cend()));
+    ASSERT_TRUE(std::is_heap(heap.Array().begin(), heap.Array().end()));
 
     heap.Remove(10);
     ASSERT_EQ(heap.Size(), 1);
     ASSERT_EQ(heap.Find(10), heap.cend());
-    ASSERT_TRUE(std::is_heap(heap.Array().cbegin(), heap.Array().cend()));
+    ASSERT_TRUE(std::is_heap(heap.Array().begin(), heap.Array().end()));
 
     heap.Remove(0);
     ASSERT_EQ(heap.Size(), 0);
     ASSERT_EQ(heap.Find(0), heap.cend());
-    ASSERT_TRUE(std::is_heap(heap.Array().cbegin(), heap.Array().cend()));
+    ASSERT_TRUE(std::is_heap(heap.Array().begin(), heap.Array().end()));
 
     heap.Remove(453);
     ASSERT_EQ(heap.Size(), 0);
-    ASSERT_TRUE(std::is_heap(heap.Array().cbegin(), heap.Array().cend()));
+    ASSERT_TRUE(std::is_heap(heap.Array().begin(), heap.Array().end()));
 }
 
 TEST_F(HeapTest, PopTest)
@@ -118,41 +118,41 @@ TEST_F(HeapTest, PopTest)
     heap.Insert(0);
 
     ASSERT_EQ(heap.Size(), 7);
-    ASSERT_TRUE(std::is_heap(heap.Array().cbegin(), heap.Array().cend()));
+    ASSERT_TRUE(std::is_heap(heap.Array().begin(), heap.Array().end()));
 
     heap.Pop();
     ASSERT_EQ(heap.Size(), 6);
     ASSERT_EQ(heap.First(), 15);
-    ASSERT_TRUE(std::is_heap(heap.Array().cbegin(), heap.Array().cend()));
+    ASSERT_TRUE(std::is_heap(heap.Array().begin(), heap.Array().end()));
 
     heap.Pop();
     ASSERT_EQ(heap.Size(), 5);
     ASSERT_EQ(heap.First(), 12);
-    ASSERT_TRUE(std::is_heap(heap.Array().cbegin(), heap.Array().cend()));
+    ASSERT_TRUE(std::is_heap(heap.Array().begin(), heap.Array().end()));
 
     heap.Pop();
     ASSERT_EQ(heap.Size(), 4);
     ASSERT_EQ(heap.First(), 10);
-    ASSERT_TRUE(std::is_heap(heap.Array().cbegin(), heap.Array().cend()));
+    ASSERT_TRUE(std::is_heap(heap.Array().begin(), heap.Array().end()));
 
     heap.Pop();
     ASSERT_EQ(heap.Size(), 3);
     ASSERT_EQ(heap.First(), 1);
-    ASSERT_TRUE(std::is_heap(heap.Array().cbegin(), heap.Array().cend()));
+    ASSERT_TRUE(std::is_heap(heap.Array().begin(), heap.Array().end()));
 
     heap.Pop();
     ASSERT_EQ(heap.Size(), 2);
     ASSERT_EQ(heap.First(), 0);
-    ASSERT_TRUE(std::is_heap(heap.Array().cbegin(), heap.Array().cend()));
+    ASSERT_TRUE(std::is_heap(heap.Array().begin(), heap.Array().end()));
 
     heap.Pop();
     ASSERT_EQ(heap.Size(), 1);
     ASSERT_EQ(heap.First(), -34);
-    ASSERT_TRUE(std::is_heap(heap.Array().cbegin(), heap.Array().cend()));
+    ASSERT_TRUE(std::is_heap(heap.Array().begin(), heap.Array().end()));
 
     heap.Pop();
     ASSERT_EQ(heap.Size(), 0);
-    ASSERT_TRUE(std::is_heap(heap.Array().cbegin(), heap.Array().cend()));
+    ASSERT_TRUE(std::is_heap(heap.Array().begin(), heap.Array().end()));
 
     EXPECT_THROW(
     {
@@ -175,8 +175,101 @@ TEST_F(HeapTest, ClearTest)
         heap.Insert(Utils::GetRandomNumber<int32_t>(INT32_MIN, INT32_MAX));
     }
     ASSERT_EQ(heap.Size(), 23455);
-    ASSERT_TRUE(std::is_heap(heap.Array().cbegin(), heap.Array().cend()));
+    ASSERT_TRUE(std::is_heap(heap.Array().begin(), heap.Array().end()));
 
     heap.Clear();
     ASSERT_EQ(heap.Size(), 0);
+}
+
+TEST_F(HeapTest, AssignTest)
+{
+    heap.Assign({1, 2});
+    ASSERT_EQ(heap.First(), 2);
+
+    heap.Assign({3, 1, 4, 1, 5, 9, 2, 6});
+    ASSERT_EQ(heap.First(), 9);
+    ASSERT_TRUE(std::is_heap(heap.Array().begin(), heap.Array().end()));
+
+    heap.Assign({});
+    ASSERT_EQ(heap.Size(), 0);
+}
+
+TEST(TrackedHeapTest, HandleTest)
+{
+    Heap<int32_t, Utils::Less<int32_t>, true> heap;
+    auto five = heap.Insert(5);
+    auto three = heap.Insert(3);
+    auto eight = heap.Insert(8);
+
+    ASSERT_EQ(heap.FirstHandle(), three);
+    ASSERT_EQ(heap.Get(eight), 8);
+
+    ASSERT_TRUE(heap.Update(eight, 1));
+    ASSERT_EQ(heap.FirstHandle(), eight);
+    ASSERT_TRUE(heap.Update(eight, 10));
+    ASSERT_EQ(heap.FirstHandle(), three);
+
+    ASSERT_TRUE(heap.Remove(three));
+    ASSERT_FALSE(heap.Contains(three));
+    ASSERT_THROW([[maybe_unused]] auto tmp = heap.Get(three), std::out_of_range);
+    ASSERT_FALSE(heap.Remove(three));
+    ASSERT_FALSE(heap.Update(three, 0));
+    ASSERT_EQ(heap.First(), 5);
+    ASSERT_EQ(heap.Get(five), 5);
+
+    heap.Pop();
+    ASSERT_FALSE(heap.Contains(five));
+    ASSERT_TRUE(heap.Contains(eight));
+    ASSERT_EQ(heap.Size(), 1);
+
+    heap.Clear();
+    ASSERT_FALSE(heap.Contains(eight));
+    ASSERT_THROW([[maybe_unused]] auto tmp = heap.FirstHandle(), std::out_of_range);
+
+    auto reused = heap.Insert(7);
+    ASSERT_EQ(heap.FirstHandle(), reused);
+    ASSERT_EQ(heap.Find(7), heap.begin());
+    ASSERT_EQ(heap.Find(5), heap.end());
+}
+
+TEST(TrackedHeapTest, RandomOperationsTest)
+{
+    Heap<int32_t, Utils::Greater<int32_t>, true> heap;
+    DynamicArray<Heap<int32_t, Utils::Greater<int32_t>, true>::Handle> handles;
+    DynamicArray<int32_t> values;
+
+    for (int32_t i = 0; i < 5000; i++)
+    {
+        auto operation = Utils::GetRandomNumber<int32_t>(0, 3);
+        if (operation < 2 || handles.Size() == 0)
+        {
+            auto value = Utils::GetRandomNumber<int32_t>(-1000, 1000);
+            handles.PushBack(heap.Insert(value));
+            values.PushBack(value);
+            continue;
+        }
+
+        auto index = Utils::GetRandomNumber<size_t>(0u, handles.Size() - 1);
+        if (operation == 2)
+        {
+            auto value = Utils::GetRandomNumber<int32_t>(-1000, 1000);
+            ASSERT_TRUE(heap.Update(handles[index], value));
+            values[index] = value;
+        }
+        else
+        {
+            ASSERT_TRUE(heap.Remove(handles[index]));
+            handles[index] = handles[handles.Size() - 1];
+            values[index] = values[values.Size() - 1];
+            handles.RemoveBack();
+            values.RemoveBack();
+        }
+
+        ASSERT_EQ(heap.Size(), handles.Size());
+        ASSERT_TRUE(std::is_heap(heap.Array().begin(), heap.Array().end()));
+        for (size_t j = 0; j < handles.Size(); j++)
+        {
+            ASSERT_EQ(heap.Get(handles[j]), values[j]);
+        }
+    }
 }
\ No newline at end of file
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+
+#include "Containers/IndexedHeap.h"
+
+class IndexedHeapTest : public testing::Test
+{
+protected:
+    IndexedHeap<int32_t> heap{10};
+};
+
+TEST_F(IndexedHeapTest, PushPopTest)
+{
+    heap.Push(3, 30);
+    heap.Push(1, 10);
+    heap.Push(7, -5);
+    heap.Push(0, 20);
+
+    ASSERT_EQ(heap.Size(), 4);
+    EXPECT_TRUE(heap.Contains(3));
+    EXPECT_FALSE(heap.Contains(2));
+    EXPECT_FALSE(heap.Contains(10));
+
+    EXPECT_EQ(heap.Top(), 7);
+    EXPECT_EQ(heap.TopPriority(), -5);
+    heap.Pop();
+    EXPECT_FALSE(heap.Contains(7));
+    EXPECT_EQ(heap.Top(), 1);
+    heap.Pop();
+    EXPECT_EQ(heap.Top(), 0);
+    heap.Pop();
+    EXPECT_EQ(heap.Top(), 3);
+    heap.Pop();
+    EXPECT_TRUE(heap.IsEmpty());
+
+    heap.Pop();
+    EXPECT_TRUE(heap.IsEmpty());
+}
+
+TEST_F(IndexedHeapTest, DecreaseKeyTest)
+{
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        heap.Push(i, static_cast<int32_t>(100 + i));
+    }
+
+    EXPECT_TRUE(heap.Push(9, 1));
+    EXPECT_FALSE(heap.Push(8, 500));
+    EXPECT_EQ(heap.GetPriority(8), 108);
+    EXPECT_TRUE(heap.Push(5, 2));
+
+    ASSERT_EQ(heap.Size(), 10);
+    EXPECT_EQ(heap.Top(), 9);
+    heap.Pop();
+    EXPECT_EQ(heap.Top(), 5);
+    heap.Pop();
+
+    int32_t previous = INT32_MIN;
+    while (!heap.IsEmpty())
+    {
+        EXPECT_LE(previous, heap.TopPriority());
+        previous = heap.TopPriority();
+        heap.Pop();
+    }
+}
+
+TEST_F(IndexedHeapTest, ClearTest)
+{
+    heap.Push(4, 1);
+    heap.Push(2, 3);
+    heap.Clear();
+
+    EXPECT_TRUE(heap.IsEmpty());
+    EXPECT_FALSE(heap.Contains(4));
+
+    heap.Push(4, 7);
+    EXPECT_EQ(heap.Top(), 4);
+    EXPECT_EQ(heap.TopPriority(), 7);
+}
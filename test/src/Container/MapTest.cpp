@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+
+#include "Containers/Map.h"
+
+#include <string>
+
+class MapTest : public testing::Test
+{
+protected:
+    Map<int32_t, std::string> map = {{1, "a"}, {3, "b"}, {5, "c"}, {7, "d"}, {9, "e"}};
+};
+
+TEST_F(MapTest, BoundsTest)
+{
+    ASSERT_EQ(map.LowerBound(3)->second, "b");
+    ASSERT_EQ(map.UpperBound(3)->second, "c");
+    ASSERT_EQ(map.LowerBound(4)->first, 5);
+    ASSERT_EQ(map.LowerBound(10), map.end());
+    ASSERT_EQ(map.UpperBound(9), map.end());
+
+    auto equal = map.EqualRange(7);
+    ASSERT_FALSE(equal.IsEmpty());
+    ASSERT_EQ(equal.begin()->second, "d");
+    ASSERT_TRUE(map.EqualRange(6).IsEmpty());
+}
+
+TEST_F(MapTest, RangeTest)
+{
+    std::string values;
+    for (const auto& pair : map.Range(2, 7))
+    {
+        values += pair.second;
+    }
+    ASSERT_EQ(values, "bcd");
+    ASSERT_TRUE(map.Range(8, 2).IsEmpty());
+
+    map.ForEachInRange(3, 5, [](auto& pair) {
+        pair.second += "!";
+    });
+    ASSERT_EQ(map.at(3), "b!");
+    ASSERT_EQ(map.at(5), "c!");
+    ASSERT_EQ(map.at(7), "d");
+
+    const auto& constMap = map;
+    size_t count = 0;
+    constMap.ForEachInRange(0, 100, [&count](const auto&) {
+        count++;
+    });
+    ASSERT_EQ(count, 5);
+}
@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+
+#include "Containers/PersistentMap.h"
+
+#include <string>
+
+class PersistentMapTest : public testing::Test
+{
+protected:
+    PersistentMap<int32_t, std::string> map = {{1, "a"}, {3, "b"}, {5, "c"}, {7, "d"}, {9, "e"}};
+};
+
+TEST_F(PersistentMapTest, AccessTest)
+{
+    ASSERT_EQ(map.at(5), "c");
+    ASSERT_THROW(static_cast<void>(map.at(4)), std::out_of_range);
+
+    ASSERT_EQ(map.Insert({4, "x"})->second, "x");
+    ASSERT_EQ(map.Size(), 6);
+    ASSERT_EQ(map.Insert({4, "y"}), map.end());
+    ASSERT_EQ(map.InsertOrAssign({4, "y"})->second, "y");
+    ASSERT_EQ(map.InsertOrAssign({11, "f"})->second, "f");
+    ASSERT_EQ(map.at(4), "y");
+
+    ASSERT_TRUE(map.Remove(4));
+    ASSERT_FALSE(map.Remove(4));
+    ASSERT_EQ(map.Size(), 6);
+    ASSERT_EQ(map.Min().first, 1);
+    ASSERT_EQ(map.Max().first, 11);
+}
+
+TEST_F(PersistentMapTest, BoundsTest)
+{
+    ASSERT_EQ(map.LowerBound(3)->second, "b");
+    ASSERT_EQ(map.UpperBound(3)->second, "c");
+    ASSERT_EQ(map.LowerBound(4)->first, 5);
+    ASSERT_EQ(map.LowerBound(10), map.end());
+    ASSERT_EQ(map.UpperBound(9), map.end());
+
+    auto equal = map.EqualRange(7);
+    ASSERT_FALSE(equal.IsEmpty());
+    ASSERT_EQ(equal.begin()->second, "d");
+    ASSERT_TRUE(map.EqualRange(6).IsEmpty());
+
+    std::string values;
+    map.ForEachInRange(2, 7, [&values](const auto& pair) {
+        values += pair.second;
+    });
+    ASSERT_EQ(values, "bcd");
+    ASSERT_TRUE(map.Range(8, 2).IsEmpty());
+}
+
+TEST_F(PersistentMapTest, SnapshotTest)
+{
+    auto snapshot = map.Snapshot();
+    map.InsertOrAssign({3, "x"});
+    map.Remove(5);
+    map.Insert({6, "y"});
+
+    ASSERT_EQ(map.ToString(), "{1: a, 3: x, 6: y, 7: d, 9: e}");
+    ASSERT_EQ(snapshot.ToString(), "{1: a, 3: b, 5: c, 7: d, 9: e}");
+
+    snapshot.Clear();
+    ASSERT_EQ(map.Size(), 5);
+    ASSERT_EQ(map.at(3), "x");
+}
@@ -0,0 +1,227 @@
+#include <gtest/gtest.h>
+
+#include "Containers/PersistentRedBlackTree.h"
+#include "Utils/Parallel.h"
+#include "Utils/Utils.h"
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+class PersistentRedBlackTreeTest : public testing::Test
+{
+protected:
+    PersistentRedBlackTree<int32_t> tree;
+};
+
+namespace
+{
+
+/**
+ * Applies random insertions and removals to the tree and to a sorted vector and compares them after every step
+ */
+void ApplyRandomOperations(PersistentRedBlackTree<int32_t>& tree, std::vector<int32_t>& expected, int32_t numberOfOperations, int32_t maxValue)
+{
+    for (int32_t i = 0; i < numberOfOperations; i++)
+    {
+        auto value = Utils::GetRandomNumber<int32_t>(0, maxValue);
+        if (Utils::GetRandomNumber<int32_t>(0, 2) > 0)
+        {
+            ASSERT_EQ(*tree.Insert(value), value);
+            expected.insert(std::upper_bound(expected.begin(), expected.end(), value), value);
+        }
+        else
+        {
+            auto it = std::lower_bound(expected.begin(), expected.end(), value);
+            auto isPresent = it != expected.end() && *it == value;
+            ASSERT_EQ(tree.Remove(value), isPresent);
+            if (isPresent)
+            {
+                expected.erase(it);
+            }
+        }
+        ASSERT_EQ(tree.Size(), expected.size());
+    }
+}
+
+void ExpectSameAsSortedVector(const PersistentRedBlackTree<int32_t>& tree, const std::vector<int32_t>& expected, int32_t maxValue)
+{
+    ASSERT_EQ(tree.Size(), expected.size());
+    ASSERT_TRUE(std::equal(tree.cbegin(), tree.cend(), expected.cbegin(), expected.cend()));
+
+    for (int32_t value = -1; value <= maxValue + 1; value++)
+    {
+        auto lower = std::lower_bound(expected.begin(), expected.end(), value);
+        auto upper = std::upper_bound(expected.begin(), expected.end(), value);
+        ASSERT_EQ(std::distance(tree.cbegin(), tree.LowerBound(value)), std::distance(expected.begin(), lower));
+        ASSERT_EQ(std::distance(tree.cbegin(), tree.UpperBound(value)), std::distance(expected.begin(), upper));
+        ASSERT_EQ(tree.Find(value) != tree.cend(), lower != upper);
+    }
+}
+
+}
+
+TEST_F(PersistentRedBlackTreeTest, InsertRemoveTest)
+{
+    for (int32_t value : {9, 4, 11, 7, 8, 1, 5, 2})
+    {
+        ASSERT_EQ(*tree.Insert(value), value);
+        ASSERT_TRUE(std::is_sorted(tree.cbegin(), tree.cend()));
+        ASSERT_TRUE(tree.Find(value) != tree.end());
+    }
+    ASSERT_EQ(tree.Size(), 8);
+    ASSERT_EQ(tree.Min(), 1);
+    ASSERT_EQ(tree.Max(), 11);
+    ASSERT_FALSE(tree.Remove(3));
+
+    for (int32_t value : {4, 9, 1, 11, 7, 2, 8, 5})
+    {
+        ASSERT_TRUE(tree.Remove(value));
+        ASSERT_TRUE(tree.Find(value) == tree.end());
+        ASSERT_TRUE(std::is_sorted(tree.cbegin(), tree.cend()));
+    }
+    ASSERT_EQ(tree.Size(), 0);
+    ASSERT_TRUE(tree.begin() == tree.end());
+}
+
+TEST_F(PersistentRedBlackTreeTest, RandomOperationsTest)
+{
+    std::vector<int32_t> expected;
+    ApplyRandomOperations(tree, expected, 5000, 300);
+    ExpectSameAsSortedVector(tree, expected, 300);
+
+    std::vector<int32_t> ascending;                                 // Stos iteratora przepełniłby się
+    PersistentRedBlackTree<int32_t> sorted;                         // w niezrównoważonym drzewie
+    for (int32_t i = 0; i < 100000; i++)
+    {
+        sorted.Insert(i);
+        ascending.push_back(i);
+    }
+    ASSERT_TRUE(std::equal(sorted.cbegin(), sorted.cend(), ascending.cbegin(), ascending.cend()));
+    for (int32_t i = 0; i < 100000; i += 2)
+    {
+        ASSERT_TRUE(sorted.Remove(i));
+    }
+    ASSERT_EQ(*sorted.Find(99999), 99999);
+    ASSERT_EQ(std::distance(sorted.cbegin(), sorted.cend()), 50000);
+}
+
+TEST_F(PersistentRedBlackTreeTest, SnapshotTest)
+{
+    std::vector<PersistentRedBlackTree<int32_t>> snapshots;
+    std::vector<std::vector<int32_t>> expectedSnapshots;
+    std::vector<int32_t> expected;
+    for (int32_t i = 0; i < 20; i++)
+    {
+        ApplyRandomOperations(tree, expected, 200, 100);
+        snapshots.push_back(tree.Snapshot());
+        expectedSnapshots.push_back(expected);
+    }
+
+    for (size_t i = 0; i < snapshots.size(); i += 2)                // Zmiany migawek nie wpływają
+    {                                                               // na pozostałe
+        ApplyRandomOperations(snapshots[i], expectedSnapshots[i], 100, 100);
+    }
+    snapshots[3].Clear();
+    expectedSnapshots[3].clear();
+    snapshots[5] = snapshots[7];
+    expectedSnapshots[5] = expectedSnapshots[7];
+
+    ExpectSameAsSortedVector(tree, expected, 100);
+    for (size_t i = 0; i < snapshots.size(); i++)
+    {
+        ExpectSameAsSortedVector(snapshots[i], expectedSnapshots[i], 100);
+    }
+}
+
+TEST_F(PersistentRedBlackTreeTest, ReplaceTest)
+{
+    PersistentRedBlackTree<std::string> strings = {"d", "a", "c", "b", "e", "f"};
+    auto snapshot = strings.Snapshot();
+
+    ASSERT_TRUE(strings.Remove("c"));
+    ASSERT_TRUE(strings.Replace("d"));
+    ASSERT_FALSE(strings.Replace("x"));
+    strings.Insert("g");
+
+    std::string concatenated;
+    for (const auto& value : strings)
+    {
+        concatenated += value;
+    }
+    ASSERT_EQ(concatenated, "abdefg");
+
+    concatenated.clear();
+    for (const auto& value : snapshot)
+    {
+        concatenated += value;
+    }
+    ASSERT_EQ(concatenated, "abcdef");
+
+    PersistentRedBlackTree<int32_t, Utils::Greater<int32_t>> descending = {1, 5, 3, 4, 2};
+    ASSERT_EQ(descending.Min(), 5);
+    ASSERT_EQ(*descending.LowerBound(3), 3);
+    ASSERT_EQ(*descending.UpperBound(3), 2);
+
+    int32_t sum = 0;
+    for (auto value : descending.Range(4, 2))
+    {
+        sum += value;
+    }
+    ASSERT_EQ(sum, 9);
+    ASSERT_TRUE(descending.Range(2, 4).IsEmpty());
+}
+
+TEST_F(PersistentRedBlackTreeTest, SerializationTest)
+{
+    tree = {3, 1, 2, 5, 4};
+
+    std::stringstream stream;
+    stream << tree;
+
+    PersistentRedBlackTree<int32_t> read = {7};
+    stream >> read;
+    ASSERT_EQ(read.Size(), 5);
+    ASSERT_TRUE(std::equal(read.cbegin(), read.cend(), tree.cbegin(), tree.cend()));
+}
+
+TEST_F(PersistentRedBlackTreeTest, ConcurrentReadersTest)
+{
+    constexpr int32_t numberOfValues = 2000;
+    for (int32_t i = 0; i < numberOfValues; i++)
+    {
+        tree.Insert(i);
+    }
+    const auto snapshot = tree.Snapshot();
+
+    constexpr uint32_t numberOfThreads = 4;
+    DynamicArray<int64_t> sums(numberOfThreads, 0);
+    Utils::ParallelFor(numberOfThreads, [this, &snapshot, &sums](uint32_t thread) {
+        if (thread == 0)
+        {
+            for (int32_t i = 0; i < numberOfValues; i++)            // Pisarz zmienia współdzielone węzły,
+            {                                                       // czytelnicy widzą niezmienioną migawkę
+                tree.Remove(i);
+                tree.Insert(i + numberOfValues);
+            }
+            return;
+        }
+        for (int32_t repetition = 0; repetition < 50; repetition++)
+        {
+            auto copy = snapshot.Snapshot();
+            for (auto value : copy)
+            {
+                sums[thread] += value;
+            }
+        }
+    });
+
+    for (uint32_t thread = 1; thread < numberOfThreads; thread++)
+    {
+        ASSERT_EQ(sums[thread], 50 * int64_t {numberOfValues} * (numberOfValues - 1) / 2);
+    }
+    ASSERT_EQ(snapshot.Min(), 0);
+    ASSERT_EQ(tree.Min(), numberOfValues);
+    ASSERT_EQ(tree.Size(), numberOfValues);
+}
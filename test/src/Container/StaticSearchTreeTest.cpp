@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include "Containers/StaticSearchTree.h"
+#include "Utils/Utils.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+/**
+ * Compares bounds found by the tree with std::lower_bound and std::upper_bound for every value in [-1, maxValue + 1]
+ */
+template<typename T>
+void ExpectSameBounds(const T& tree, const std::vector<typename T::DataType>& expected, int32_t maxValue)
+{
+    ASSERT_EQ(tree.Size(), expected.size());
+    for (int32_t i = -1; i <= maxValue + 1; i++)
+    {
+        auto value = static_cast<typename T::DataType>(i);
+        auto lower = std::lower_bound(expected.begin(), expected.end(), value);
+        auto upper = std::upper_bound(expected.begin(), expected.end(), value);
+
+        ASSERT_EQ(tree.LowerBound(value) == nullptr, lower == expected.end());
+        if (lower != expected.end())
+        {
+            ASSERT_EQ(*tree.LowerBound(value), *lower);
+        }
+        ASSERT_EQ(tree.UpperBound(value) == nullptr, upper == expected.end());
+        if (upper != expected.end())
+        {
+            ASSERT_EQ(*tree.UpperBound(value), *upper);
+        }
+        ASSERT_EQ(tree.Contains(value), lower != upper);
+    }
+}
+
+template<typename T>
+void ExpectSameBoundsForSizes()
+{
+    for (size_t size : {0u, 1u, 2u, 15u, 16u, 17u, 100u, 1000u, 5000u})
+    {
+        std::vector<typename T::DataType> expected(size);
+        for (auto& value : expected)
+        {
+            value = static_cast<typename T::DataType>(Utils::GetRandomNumber<int32_t>(0, static_cast<int32_t>(size)));
+        }
+        std::sort(expected.begin(), expected.end());
+
+        ExpectSameBounds(T::FromSorted(expected.begin(), expected.end()), expected, static_cast<int32_t>(size));
+    }
+}
+
+}
+
+TEST(StaticSearchTreeTest, EytzingerTest)
+{
+    ExpectSameBoundsForSizes<StaticSearchTree<int32_t>>();
+    ExpectSameBoundsForSizes<StaticSearchTree<int64_t>>();
+    ExpectSameBoundsForSizes<StaticSearchTree<double>>();
+}
+
+TEST(StaticSearchTreeTest, STreeTest)
+{
+    ExpectSameBoundsForSizes<StaticSearchTree<int32_t, Utils::Less<int32_t>, StaticSearchTreeLayout::S_TREE>>();
+    ExpectSameBoundsForSizes<StaticSearchTree<int64_t, Utils::Less<int64_t>, StaticSearchTreeLayout::S_TREE>>();
+    ExpectSameBoundsForSizes<StaticSearchTree<double, Utils::Less<double>, StaticSearchTreeLayout::S_TREE>>();
+}
+
+TEST(StaticSearchTreeTest, ConstructionTest)
+{
+    DynamicArray<int32_t> values = {5, 1, 4, 2, 3, 7, 6};
+    StaticSearchTree<int32_t> tree(values);
+    ASSERT_EQ(tree.ToString(), "[4 2 6 1 3 5 7]");
+    ASSERT_EQ(*tree.Find(6), 6);
+    ASSERT_EQ(tree.Find(8), nullptr);
+
+    auto copy = tree;
+    tree = StaticSearchTree<int32_t>();
+    ASSERT_EQ(tree.Size(), 0);
+    ASSERT_EQ(tree.LowerBound(0), nullptr);
+    ASSERT_EQ(*copy.UpperBound(4), 5);
+
+    StaticSearchTree<int32_t, Utils::Greater<int32_t>, StaticSearchTreeLayout::S_TREE> descending(values);
+    ASSERT_EQ(*descending.LowerBound(10), 7);
+    ASSERT_EQ(*descending.UpperBound(4), 3);
+    ASSERT_EQ(descending.UpperBound(1), nullptr);
+
+    DynamicArray<std::string> words = {"pear", "apple", "plum", "fig"};
+    StaticSearchTree<std::string, Utils::Less<std::string>, StaticSearchTreeLayout::S_TREE> strings(words);
+    ASSERT_EQ(*strings.LowerBound("b"), "fig");
+    ASSERT_EQ(*strings.UpperBound("pear"), "plum");
+    ASSERT_TRUE(strings.Contains("apple"));
+    ASSERT_FALSE(strings.Contains("kiwi"));
+    ASSERT_EQ(strings.ToString(), "[apple fig pear plum]");
+}
@@ -2,6 +2,7 @@
 
 #include "Utils/Algorithms.h"
 #include "Containers/DynamicArray.h"
+#include "Utils/Pair.h"
 
 #include <algorithm>
 
@@ -52,4 +53,27 @@ TEST(AlgorithmsTest, QuickSortCustomStructureTest)
     std::is_sorted(array.begin(), array.end(), [] (const auto& a1, const auto& a2) {
         return a1.number < a2.number;
     });
+}
+
+TEST(AlgorithmsTest, MergeSortTest)
+{
+    DynamicArray<Utils::Pair<int32_t, int32_t>> array(1000);
+    for (int32_t i = 0; i < 1000; i++)
+    {
+        array[static_cast<size_t>(i)] = {Utils::GetRandomNumber<int32_t>(0, 50), i};
+    }
+    DynamicArray<Utils::Pair<int32_t, int32_t>> buffer(array.Size());
+
+    Utils::MergeSort(array.begin(), array.end(), buffer.begin(), [] (const auto& a1, const auto& a2) {
+        return a1.first < a2.first;
+    });
+
+    for (size_t i = 1; i < array.Size(); i++)
+    {
+        ASSERT_LE(array[i - 1].first, array[i].first);
+        if (array[i - 1].first == array[i].first)
+        {
+            ASSERT_LT(array[i - 1].second, array[i].second);
+        }
+    }
 }
\ No newline at end of file
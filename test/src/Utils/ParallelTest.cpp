@@ -0,0 +1,17 @@
+#include <gtest/gtest.h>
+
+#include "Utils/Parallel.h"
+
+TEST(ParallelTest, GetPartBeginTest)
+{
+    EXPECT_EQ(Utils::GetPartBegin(10u, 0, 3), 0u);
+    EXPECT_EQ(Utils::GetPartBegin(10u, 1, 3), 3u);
+    EXPECT_EQ(Utils::GetPartBegin(10u, 2, 3), 6u);
+    EXPECT_EQ(Utils::GetPartBegin(10u, 3, 3), 10u);
+    EXPECT_EQ(Utils::GetPartBegin(UINT32_MAX, 7, 7), UINT32_MAX);
+
+    const size_t size = 3 * static_cast<size_t>(UINT32_MAX) + 2;
+    EXPECT_EQ(Utils::GetPartBegin(size, 1, 3), static_cast<size_t>(UINT32_MAX));
+    EXPECT_EQ(Utils::GetPartBegin(size, 2, 3), 2 * static_cast<size_t>(UINT32_MAX) + 1);
+    EXPECT_EQ(Utils::GetPartBegin(size, 3, 3), size);
+}
\ No newline at end of file